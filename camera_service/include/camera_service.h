@@ -11,27 +11,61 @@
  * @brief Start the camera capture.
  *
  * The capture data will be available at the chan_camera_evt channel as soons
- * as it is ready.
+ * as it is ready, tagged with the request id.
  *
+ * @param request_id caller's id for the capture, echoed in its result.
  * @param timeout the time available for waiting the capture to start.
  * @return 0 if the capture started, negative otherwise.
  */
-int camera_api_capture(k_timeout_t timeout);
+int camera_api_capture(uint32_t request_id, k_timeout_t timeout);
+
+/** Longest plate text the camera can report, without the terminator. */
+#define CAMERA_PLATE_MAX_LEN 15
+
+/** Size of the SHA-256 digest attached to every capture. */
+#define CAMERA_PLATE_HASH_SIZE 32
 
 struct camera_data {
-	const char *plate;
-	const char *hash;
+	char plate[CAMERA_PLATE_MAX_LEN + 1];
+	uint8_t hash[CAMERA_PLATE_HASH_SIZE]; /* SHA-256 of plate, raw bytes */
 };
 
+/**
+ * @brief Get the number of plates the simulated camera can report.
+ *
+ * Entries [0, camera_api_valid_plate_count()) are well-formed plates, the
+ * remaining ones are misreads.
+ *
+ * @return the number of entries in the plate table.
+ */
+size_t camera_api_plate_count(void);
+
+/**
+ * @brief Get the number of well-formed plates in the plate table.
+ *
+ * @return the number of well-formed entries.
+ */
+size_t camera_api_valid_plate_count(void);
+
+/**
+ * @brief Read one entry of the plate table.
+ *
+ * @param index the entry, below camera_api_plate_count().
+ * @param out receives the plate text and its hash.
+ * @return 0 on success, -EINVAL if index is out of range.
+ */
+int camera_api_plate_get(size_t index, struct camera_data *out);
+
 struct msg_camera_evt {
 	enum {
 		MSG_CAMERA_EVT_TYPE_UNDEFINED,
 		MSG_CAMERA_EVT_TYPE_DATA,
 		MSG_CAMERA_EVT_TYPE_ERROR,
 	} type;
+	uint32_t request_id; /* From the camera_api_capture() call answered */
 	union {
 		int error_code;
-		const struct camera_data *captured_data;
+		struct camera_data captured_data;
 	};
 };
 
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 UFAL
+# SPDX-License-Identifier: Apache-2.0
+"""Generate the camera service plate table from a CSV source.
+
+Usage: gen_plate_table.py --csv plates.csv --output camera_plate_table.c
+                          [--synth N] [--seed S]
+
+Each plate is packed into 5 bytes (little-endian 40 bits): the 7 alphanumeric
+characters in radix 36 in bits 0..36 and the separator layout in bits 37..39.
+Plates that fit no layout (junk characters, odd lengths, lowercase) keep
+their text in a spill pool and store its offset instead. Hashes are stored as
+32 raw bytes. --synth appends N synthetic well-formed plates with their
+SHA-256, so large populations cost 37 bytes of flash each.
+"""
+
+import argparse
+import csv
+import hashlib
+import random
+import sys
+
+# Must match camera_plate_layouts[] in camera_plates.c
+LAYOUTS = ["XXXXXXX", "XX XXX XX", "XXXX XXX", "XXX XXXX"]
+LAYOUT_SPILL = 7
+VALUE_BITS = 37
+MAX_LEN = 15
+DIGITS = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+# Well-formed Mercosul shapes ('L' letter, 'N' digit) and their layout
+SYNTH_SHAPES = [
+    ("LLLNLNN", "XXXXXXX"),
+    ("LLNNNLL", "XX XXX XX"),
+    ("LLLLNNN", "XXXX XXX"),
+    ("NNNLLLL", "XXX XXXX"),
+]
+
+
+def layout_of(plate):
+    shape = "".join("X" if c in DIGITS else c for c in plate)
+    return LAYOUTS.index(shape) if shape in LAYOUTS else None
+
+
+def pack(plate, spill):
+    layout = layout_of(plate)
+    if layout is None:
+        value = len(spill)
+        spill.extend(plate.encode("ascii") + b"\0")
+        layout = LAYOUT_SPILL
+    else:
+        value = int("".join(c for c in plate if c != " "), 36)
+    return ((layout << VALUE_BITS) | value).to_bytes(5, "little")
+
+
+def synth_plates(count, seed, taken):
+    rng = random.Random(seed)
+    while count > 0:
+        shape, layout = rng.choice(SYNTH_SHAPES)
+        chars = iter(rng.choice(DIGITS[10:] if s == "L" else DIGITS[:10]) for s in shape)
+        plate = "".join(next(chars) if c == "X" else c for c in layout)
+        if plate not in taken:
+            taken.add(plate)
+            count -= 1
+            yield plate
+
+
+def hex_bytes(data):
+    return "{" + ",".join(f"0x{b:02x}" for b in data) + "}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--csv", required=True)
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--synth", type=int, default=0)
+    parser.add_argument("--seed", type=int, default=2025)
+    args = parser.parse_args()
+
+    valid, invalid = [], []
+    with open(args.csv, newline="", encoding="ascii") as f:
+        rows = csv.DictReader(line for line in f if not line.startswith("#"))
+        for row in rows:
+            plate, digest = row["plate"], bytes.fromhex(row["sha256"])
+            if len(plate) > MAX_LEN or len(digest) != 32:
+                sys.exit(f"{args.csv}: bad entry '{plate}'")
+            (valid if row["valid"] == "1" else invalid).append((plate, digest))
+
+    taken = {plate for plate, _ in valid + invalid}
+    for plate in synth_plates(args.synth, args.seed, taken):
+        valid.append((plate, hashlib.sha256(plate.encode("ascii")).digest()))
+    # The simulated camera draws from both lists
+    if not valid or not invalid:
+        sys.exit(f"{args.csv}: needs at least one valid=1 and one valid=0 plate")
+
+    entries = valid + invalid
+    spill = bytearray()
+    packed = [pack(plate, spill) for plate, _ in entries]
+    if len(spill) >= 1 << VALUE_BITS:
+        sys.exit("spill pool too large")
+    spill = spill or bytearray(1)  # C arrays cannot be empty
+
+    with open(args.output, "w", encoding="ascii") as out:
+        out.write("/* Generated by gen_plate_table.py from plates.csv. Do not edit. */\n")
+        out.write('#include "camera_service_priv.h"\n\n')
+        out.write(f"const uint32_t camera_plate_valid_count = {len(valid)};\n")
+        out.write(f"const uint32_t camera_plate_invalid_count = {len(invalid)};\n\n")
+        out.write(f"const uint8_t camera_plate_packed[{len(entries)}][CAMERA_PLATE_PACKED_SIZE] = {{\n")
+        out.writelines(f"\t{hex_bytes(p)},\n" for p in packed)
+        out.write("};\n\n")
+        out.write(f"const uint8_t camera_plate_hash[{len(entries)}][CAMERA_PLATE_HASH_SIZE] = {{\n")
+        out.writelines(f"\t{hex_bytes(d)},\n" for _, d in entries)
+        out.write("};\n\n")
+        out.write(f"const char camera_plate_spill[{len(spill)}] = {hex_bytes(spill)};\n")
+
+
+if __name__ == "__main__":
+    main()
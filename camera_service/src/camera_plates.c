@@ -0,0 +1,70 @@
+#include "camera_service_priv.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+/* Separator layouts of packed plates, 'X' marks a character. Must match
+ * LAYOUTS in scripts/gen_plate_table.py.
+ */
+static const char *const camera_plate_layouts[] = {
+	"XXXXXXX",
+	"XX XXX XX",
+	"XXXX XXX",
+	"XXX XXXX",
+};
+
+size_t camera_api_plate_count(void)
+{
+	return (size_t)camera_plate_valid_count + camera_plate_invalid_count;
+}
+
+size_t camera_api_valid_plate_count(void)
+{
+	return camera_plate_valid_count;
+}
+
+/* Write the text of a packed plate into out (CAMERA_PLATE_MAX_LEN + 1 bytes) */
+static void camera_plate_unpack(const uint8_t packed[CAMERA_PLATE_PACKED_SIZE], char *out)
+{
+	static const char radix36[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	uint64_t raw = 0;
+
+	for (int i = CAMERA_PLATE_PACKED_SIZE - 1; i >= 0; i--) {
+		raw = (raw << 8) | packed[i];
+	}
+
+	uint32_t layout = (uint32_t)(raw >> CAMERA_PLATE_VALUE_BITS);
+	uint64_t value = raw & ((1ULL << CAMERA_PLATE_VALUE_BITS) - 1ULL);
+
+	if (layout >= ARRAY_SIZE(camera_plate_layouts)) {
+		strncpy(out, camera_plate_spill + value, CAMERA_PLATE_MAX_LEN);
+		out[CAMERA_PLATE_MAX_LEN] = '\0';
+		return;
+	}
+
+	const char *tmpl = camera_plate_layouts[layout];
+	int len = (int)strlen(tmpl);
+
+	out[len] = '\0';
+	for (int i = len - 1; i >= 0; i--) {
+		if (tmpl[i] == 'X') {
+			out[i] = radix36[value % 36U];
+			value /= 36U;
+		} else {
+			out[i] = tmpl[i];
+		}
+	}
+}
+
+int camera_api_plate_get(size_t index, struct camera_data *out)
+{
+	if (out == NULL || index >= camera_api_plate_count()) {
+		return -EINVAL;
+	}
+
+	camera_plate_unpack(camera_plate_packed[index], out->plate);
+	memcpy(out->hash, camera_plate_hash[index], CAMERA_PLATE_HASH_SIZE);
+
+	return 0;
+}
@@ -8,11 +8,9 @@ struct msg_camera_cmd {
 		MSG_CAMERA_CMD_TYPE_CAPTURE,
 		MSG_CAMERA_CMD_TYPE_COUNT
 	} type;
+	uint32_t request_id;
 };
 
-const size_t valid_array_size = ARRAY_SIZE(valid_car_license_plates);
-const size_t invalid_array_size = ARRAY_SIZE(invalid_car_license_plates);
-
 ZBUS_CHAN_DEFINE(chan_camera_cmd, struct msg_camera_cmd, NULL, NULL,
 		 ZBUS_OBSERVERS(msub_camera_cmd),
 		 ZBUS_MSG_INIT(.type = MSG_CAMERA_CMD_TYPE_UNDEFINED));
@@ -22,9 +20,10 @@ ZBUS_CHAN_DEFINE(chan_camera_evt, struct msg_camera_evt, NULL, NULL, ZBUS_OBSERV
 
 ZBUS_MSG_SUBSCRIBER_DEFINE(msub_camera_cmd);
 
-int camera_api_capture(k_timeout_t timeout)
+int camera_api_capture(uint32_t request_id, k_timeout_t timeout)
 {
-	struct msg_camera_cmd msg = {.type = MSG_CAMERA_CMD_TYPE_CAPTURE};
+	struct msg_camera_cmd msg = {.type = MSG_CAMERA_CMD_TYPE_CAPTURE,
+				     .request_id = request_id};
 
 	return zbus_chan_pub(&chan_camera_cmd, &msg, timeout);
 }
@@ -51,7 +50,7 @@ void camera_thread(void *ptr1, void *ptr2, void *ptr3)
 			continue;
 		}
 
-		struct msg_camera_evt evt;
+		struct msg_camera_evt evt = {.request_id = cmd.request_id};
 
 		switch (cmd.type) {
 		case MSG_CAMERA_CMD_TYPE_CAPTURE: {
@@ -62,12 +61,14 @@ void camera_thread(void *ptr1, void *ptr2, void *ptr3)
 
 			if (random_key < 900) {
 				evt.type = MSG_CAMERA_EVT_TYPE_DATA;
-				evt.captured_data =
-					valid_car_license_plates + (random_key % valid_array_size);
+				(void)camera_api_plate_get(sys_rand32_get() %
+							   camera_plate_valid_count,
+							   &evt.captured_data);
 			} else if (900 <= random_key && random_key < 1000) {
 				evt.type = MSG_CAMERA_EVT_TYPE_DATA;
-				evt.captured_data = invalid_car_license_plates +
-						    (random_key % invalid_array_size);
+				(void)camera_api_plate_get(camera_plate_valid_count +
+								   (random_key % camera_plate_invalid_count),
+							   &evt.captured_data);
 			} else {
 				evt.type = MSG_CAMERA_EVT_TYPE_ERROR;
 				evt.error_code = -EBUSY;
@@ -94,4 +95,11 @@ void camera_thread(void *ptr1, void *ptr2, void *ptr3)
 	}
 }
 
-K_THREAD_DEFINE(camera_thread_id, 2048, camera_thread, NULL, NULL, NULL, 3, 0, 0);
+#if defined(CONFIG_CAMERA_SERVICE_DEFERRED_START)
+#define CAMERA_THREAD_START_DELAY SYS_FOREVER_MS
+#else
+#define CAMERA_THREAD_START_DELAY 0
+#endif
+
+K_THREAD_DEFINE(camera_thread_id, 2048, camera_thread, NULL, NULL, NULL, 3, 0,
+		CAMERA_THREAD_START_DELAY);
@@ -1,1208 +1,25 @@
 #ifndef _CAMERA_DATA_H_
 #define _CAMERA_DATA_H_
+#include <stdint.h>
 #include "camera_service.h"
 
-const struct camera_data valid_car_license_plates[] = {
-	{.plate = "EGG3D02",
-	 .hash = "0d6b4d62516fe9eeb9ce56c57a6559e21e02436d542af9aef03f322d32d408ed"},
-	{.plate = "CBJ6G17",
-	 .hash = "8c1c66e4077b110de1e28696f82043b2c810682c8c4618da0735bc25708f97d1"},
-	{.plate = "HCO7H89",
-	 .hash = "67dadca53551d924fb788e752bfe7af246ef64431f31b5ef1395e26aba51c43c"},
-	{.plate = "HFX1B53",
-	 .hash = "3b530c1c0c1c45aec19424d6311a008c618fc7063b67eebbf6f732932d085bae"},
-	{.plate = "JOT5F76",
-	 .hash = "24a9ddfb008392541800153d88a7ffa69a0283e9f5c98da65c7d0bb7baf333e0"},
-	{.plate = "MPC4E46",
-	 .hash = "2300bd2642fd99ce67f2ef4a460b98711c626a4dc65a90d5937bad0b200f03e8"},
-	{.plate = "ZUQ1B71",
-	 .hash = "2cebe19b5171fcd667f2510d7e40f1ccd0cb58d020ad68dde5fb9550be14954d"},
-	{.plate = "DYK6G81",
-	 .hash = "b8a42b996535bcef3f196f9a4829482bd9b1c8861b407933cd3abbecf79bc5a7"},
-	{.plate = "MJL1B37",
-	 .hash = "6e04faba9300d0f17b4e0290e1749c0db26aa8f7b719e03b4c50134c44c6f8f0"},
-	{.plate = "SOU8I24",
-	 .hash = "27ad5c8152fcfbecd5aa4e6263842ee1613771d4f2f6c19b5119c2a417ec231c"},
-	{.plate = "PWP4E07",
-	 .hash = "1dce9833c6db6fc9520f75f25ab8c5db7471934cdf01e49b9faaba5672bedebb"},
-	{.plate = "PTK1B55",
-	 .hash = "cc895536a28e2a1f3d2d04daf17fc51916cc082fae3a6c3cb9e5b90d6684e82b"},
-	{.plate = "DKH0A13",
-	 .hash = "81aae0f6d6a4a19f8ff1f267053027f258626929e9adf84fcfcf37cfa6cd904a"},
-	{.plate = "PUK2C30",
-	 .hash = "e8cf323fccff95749f38b1d3ab5d6367dea558088863bdd4334bb88a0254f914"},
-	{.plate = "LWA1B81",
-	 .hash = "a5b9e6c45bc8204a2c71a96938326d87754511f2391d04c4e99266f45e53fed3"},
-	{.plate = "AIV9J27",
-	 .hash = "f55ff021e2c2fc08bf317b4594c450f32eea81f130963e18fbdde3b77605c11b"},
-	{.plate = "TUL4E01",
-	 .hash = "234fe632aa3319f459e15c9b920fb48e0e53be4f77e544925c7ee2e461d7ad65"},
-	{.plate = "CNP9J54",
-	 .hash = "25b1a47f05cc7075dfea83957a936460329b15b67f21af5d50425fd25633485b"},
-	{.plate = "BZG2C29",
-	 .hash = "bdc90ccfa8ded4c0ed3c4f9622a7ef474e91b3299ecafdb1909877c5ce31285b"},
-	{.plate = "MYW6G49",
-	 .hash = "4510b4c19ac17abada09bd9ac82078ecf2cacf1108b2a409cad6c6561fdea533"},
-	{.plate = "ZFM3D18",
-	 .hash = "9e54e289523c0eda076af3da2327f1fd0d7176554aa6903ae2d9ae7241aa8d15"},
-	{.plate = "RUP0A62",
-	 .hash = "ad9e4a1f3060618e97fdfad016325ff255b46a05b7e16aeeba4dc3b95b08a792"},
-	{.plate = "TLO1B60",
-	 .hash = "6ba40eb05621560483bb92d308d8f5fea771597cc5c87aa81dbb2d5bdb6a9140"},
-	{.plate = "EPK3D03",
-	 .hash = "eb381b1ce5873ebb44e79912cacc5e77895d17e0fd525dc28e5f19f06613472e"},
-	{.plate = "JYE7H03",
-	 .hash = "d525a5df6e539fd04d360c45adcd138c2bfd9ab522a5068553d31da9e76d523c"},
-	{.plate = "VWH0A08",
-	 .hash = "ec0c0c7dfc936ae94a3605732224c376c35b8c2b7dbecad8016e0581e8f06d3b"},
-	{.plate = "YKC7H14",
-	 .hash = "1bd69cebd3faba4b9cb819804b1150826c578901afdbebaf44954a8e12a0a6d3"},
-	{.plate = "SCL1B36",
-	 .hash = "bffcbe4197ec7dec437e287634ee5f628aa81154f046d11a58795fc38c5332e6"},
-	{.plate = "PEI9J37",
-	 .hash = "76475783f3333d74ca3701c61bf90019502737139747ce095a4e70954858c7e3"},
-	{.plate = "DFR5F91",
-	 .hash = "47cb5e77799403d74ac91d1f1bb2196e5d3dae5133efbbed4aa69428a3f777a1"},
-	{.plate = "OAP5F19",
-	 .hash = "d0c97213c0c14d2856e06462b58c994fcbac853995381fe7fb2a840a1f773077"},
-	{.plate = "EBD5F51",
-	 .hash = "17b91810dc4a30f9b8c0c463f36d7e1794949ce43492013eebf0682af5a7bef6"},
-	{.plate = "ZUK8I42",
-	 .hash = "c5a6144486361c69f4cd3625b53de8d70e39a43c454bfb2d5f47e615369b617c"},
-	{.plate = "NHC9J68",
-	 .hash = "c36f805dded7f38f0564d8dd8b5eed66094cb9f9d2e9538c984c19714e60b153"},
-	{.plate = "AVC9J79",
-	 .hash = "81fe0f59001f1f5b450efafd9ec5db0c414535fa603754ca80b89e28a59b8152"},
-	{.plate = "GCW0A60",
-	 .hash = "3eaeb9184afd8dbe0dca2692c2d2f9855d9c6578b782a31470291a70379b472c"},
-	{.plate = "CTY7H48",
-	 .hash = "6fa07683bbeb560643baf6eb9b0f5934343ee168f195356b5ce831f494a374f8"},
-	{.plate = "QYD2C62",
-	 .hash = "fdfb643c8d804afd21d87fa66453aed6db887241308787062977cf2895b883f8"},
-	{.plate = "VDX2C03",
-	 .hash = "5a7a44553e97b206d1a84f00ac6c0cac70d992e07c2a198943aae63aea83bb5d"},
-	{.plate = "TEP9J01",
-	 .hash = "b56ef84de7de10433a59f2c7006d4dafb6f8271363d26aad4e768a1e662a0879"},
-	{.plate = "ONO3D09",
-	 .hash = "580cf5fa4152da3d9de349990d2085f89410e352eb134ed5702f115b9f862c84"},
-	{.plate = "UEN4E11",
-	 .hash = "e946ebf19019412bf9325a9871cf9e4183920ede9da8193447753df999b90b66"},
-	{.plate = "JZA0A63",
-	 .hash = "7809a80297d5e4cebe687327c29e5ce02ed282ebe46779cdd029360463ba470a"},
-	{.plate = "BTL5F56",
-	 .hash = "77a2ac5f4ca0072ce8b5d50618d357fbdddc4d596e4fb03bd5216c36cec842a9"},
-	{.plate = "LTN6G70",
-	 .hash = "adf4decdef0a0f1c96e2536db6a85914b3b308a0d771217be65ae8ded23cfdf7"},
-	{.plate = "QJA8I89",
-	 .hash = "f1f42b306d7db73dc280dc7c1b1ffe31c1896f31321826bf4cfaf0220479b2fe"},
-	{.plate = "IFF2C48",
-	 .hash = "2ff79e9ca600b53efc68f5134ae391c2c88d5ece9f203cae19a0e0e61c41cf57"},
-	{.plate = "AYR1B52",
-	 .hash = "ee7ea331070c209381958b7f0c9ce2ad5a39ad01e4cef08254ebd0a0edd5aa25"},
-	{.plate = "VUK1B99",
-	 .hash = "da7f76012ae90168d79d40ef379a85bcb10308321161c2d73197a5b18b27c5da"},
-	{.plate = "DGQ5F17",
-	 .hash = "f62b121b25134f290bffcdc73ee349763dbac4a63f446f78d676191f2a027fe0"},
-	{.plate = "EYI7H12",
-	 .hash = "172395ce0521ccab5dd284467bc7463577bbc93ddd93ac1b3988f272079bd5ea"},
-	{.plate = "OTN6G45",
-	 .hash = "c58d0d1d0aad1dfabba927297c6b5a74593cd0bccf696200f5f4a6e18196cd56"},
-	{.plate = "DHR7H28",
-	 .hash = "a0a07ec4e66d20e87766ef5a17bbccc38829ab74a4d9f8ac22550504b7937806"},
-	{.plate = "YRN2C83",
-	 .hash = "e70a21644c95a9f99bdbd9c549f750865e040108c35daa117c22760aa2a909cd"},
-	{.plate = "ZHN9J12",
-	 .hash = "5f1a117f179c993052279fa8cdb2d296ef2b573b58cd087a7ba5c5588f120ffd"},
-	{.plate = "YMK1B10",
-	 .hash = "3b25d234ec2c63bd0b885605c2d74f1dbdaab5dee5bd247679e6b2d7a0ee95f4"},
-	{.plate = "TMJ5F78",
-	 .hash = "fa862731eb9ba5c8aa1bf63821aea0a3be9684b0d3cf35432864a3269f37db9c"},
-	{.plate = "ETK1B73",
-	 .hash = "61ae324ec601294952fa0ec8fcd58186be5dff46a1bdea51557f4ce802d9ca5f"},
-	{.plate = "JSZ4E65",
-	 .hash = "288154c0979ba499bbf018f125c4ca9a7801f7f49af64393c12a4e21a705332a"},
-	{.plate = "FGL0A90",
-	 .hash = "155299e9cbb34a1a5d5aea1995505a8b7842e80745527ccd848e8f8fbbe7dfb9"},
-	{.plate = "ECB6G45",
-	 .hash = "7a6cb9aa1f14b74bf0dcada9f1abfde5e18f4585c734349c6debf39f53dfb9b5"},
-	{.plate = "ENX6G08",
-	 .hash = "aa4c76457754349476a13b07fc6c3293c0ee3fc8a308a926b7324c7cf37a1867"},
-	{.plate = "CTN3D98",
-	 .hash = "08e560a9d24c38ddddcee51828573a5eea848455f1762e2d72814b8287cbecdc"},
-	{.plate = "XUK4E55",
-	 .hash = "3d8d6d8e347ce39ce3e75ca57690f26107f154aa9ffaf72a531a30822960f466"},
-	{.plate = "SHJ5F86",
-	 .hash = "887ef00e3e2d37f60236261dfb2e14808abc855689e18723cba91b2daa87b71a"},
-	{.plate = "ZJT9J04",
-	 .hash = "fa5d46063192ac32f88e5ede42feb8af7aed654aa830a4772baf91a483cc2ce4"},
-	{.plate = "HGJ2C42",
-	 .hash = "7717f48e496a30c05124855102934738c55b1f33d4b5810594121e3f8d2161fe"},
-	{.plate = "EMI8I74",
-	 .hash = "26c783cdd4772692878f943b286846fa1530719de30f9d49363d20fa9d850027"},
-	{.plate = "PYE0A78",
-	 .hash = "9644baf5945c4ed12dfdcc5b34d42700673b8b8566da7fb363888fe4780573dd"},
-	{.plate = "HFE9J26",
-	 .hash = "407e95f3273f977b2347ecc1835f87bd08aa866e3086dbd4ddbee1c105f84054"},
-	{.plate = "BZV4E00",
-	 .hash = "1775737e31125142381cde702c8bf595b6440080bd02b9bbfdc689835f551211"},
-	{.plate = "YWL6G47",
-	 .hash = "d30b3c56a705a126f677a075e4c28b07b7dfb02b343ba0c5d1fdd76cd7328c6c"},
-	{.plate = "LBO6G77",
-	 .hash = "b20b36a88c6aa9417231e3ebc4ca10f4aed5fd0d50fbc8464f4df45bf8f9dcd2"},
-	{.plate = "YTC3D54",
-	 .hash = "c287245e8b972e99201d7cecc6fbda4e19d528e020788728df249f3b74008ded"},
-	{.plate = "IOQ2C75",
-	 .hash = "b9d8253065ed8c72c1ba50815ac53ad304e685e1f37acd414e2197a79887beb2"},
-	{.plate = "UHO5F44",
-	 .hash = "b58fe0f84db238f140498dc8cf30b903be19a119722b162ce04e43d982bd92c9"},
-	{.plate = "ELS5F80",
-	 .hash = "2d88c735cfa7b53c78cce3d2d0bec7bcfc64487182c79e20c7475dc48a536e05"},
-	{.plate = "NVS7H57",
-	 .hash = "97c98340d8c1e8b6daeced5b40ad350a3257f4469f7d5499f3d0637312a770fa"},
-	{.plate = "SMZ5F72",
-	 .hash = "d675ae33cd5e2ba103a43db461efdec582715f9f1c219a81d12fbf18736b915e"},
-	{.plate = "CQU9J11",
-	 .hash = "597e6ffcce7b0ff01624398802cc06364e2c58a253023f26cfb747c832d6b98a"},
-	{.plate = "VQU9J71",
-	 .hash = "e82949a657b516aa6188272ae2c4e4835dcc907f0f696debbdf3873eb497ff30"},
-	{.plate = "ZVA3D56",
-	 .hash = "a7e0ca8415d23005c062c3e0c0d4c8d3ddd49ba32eacf5b25974e654e436c424"},
-	{.plate = "YSO8I59",
-	 .hash = "af5a1b110189ca66283f7e04029b962915af4b5878fc1d27ca521bc568209be3"},
-	{.plate = "LPH7H72",
-	 .hash = "7d20328049433c449d30dd6e0535895c4b5592d3d93d97578a68eae29bd3c7ef"},
-	{.plate = "OPT1B40",
-	 .hash = "e71ab59a81c9eada5de2cd2dc1b883032dccc22cf114b904cc232211e888c85d"},
-	{.plate = "BNK3D37",
-	 .hash = "a49be24eac5604faf1a1c56bfa97161197c7cb5bd6ad0322316619036a417adf"},
-	{.plate = "JEX0A46",
-	 .hash = "4a8e080c06373bddd9b9591c4caaef72248a6908e7ea97a9056d8fef8b9bf15d"},
-	{.plate = "HZH7H63",
-	 .hash = "781e067de12f4d650fa4851c3598a770e1a0315458143c5d4cf2dfcb19cee546"},
-	{.plate = "LVJ2C62",
-	 .hash = "6eaa5bb7c6ed6f10c31ba17923e120ddad3d48e5a55a031ca0a0792512fae533"},
-	{.plate = "YKE1B79",
-	 .hash = "71e7f611ae9d2dff2617f809305801468bcf861bebad45c125aec3b070e805e4"},
-	{.plate = "LOZ8I54",
-	 .hash = "434b07dbff5da1b3a28c13bb61c336ae5c8f1d721279b824919680ce8f4fd8d7"},
-	{.plate = "HIY5F48",
-	 .hash = "8601663a0aa5d5813aa3f19ebe4482690158f29a4cdae9789309e0d47991909d"},
-	{.plate = "RSV6G34",
-	 .hash = "3a81f903a28f03d633a643f59bf66f0fd1a44141f51c6dd585a499e65c53cf76"},
-	{.plate = "QVK0A89",
-	 .hash = "57ba856104032247406f8f20274e4a067ebc519fc3d3a55f4f43c1fd4cef9a1d"},
-	{.plate = "OUE5F46",
-	 .hash = "a04830004d669980868dba8548ff4b0b38950cb9c22ee2d943b3b64e3222d2f0"},
-	{.plate = "MOQ2C19",
-	 .hash = "7409ecfeb692f89c5c78482050e61b47e43df98cc32a1373f031ed546f11213a"},
-	{.plate = "EHT8I98",
-	 .hash = "889452bb893d899316be8a48fb73ce40b81309f9f590c800503aad93c654e1a0"},
-	{.plate = "MYR8I22",
-	 .hash = "834af25df0e00ec549de087536fb0196d58360d4a21005511098a078203fe3c9"},
-	{.plate = "AAD4E38",
-	 .hash = "4dbe764643fb06d2259d3ca6e791b6914351d0074c954127ae8afa37b89d42e6"},
-	{.plate = "VZD4E72",
-	 .hash = "613b300d1619b1fb57eccac372bd21e7930ecfb261380733995c1fe4ce8afae0"},
-	{.plate = "TO 054 ZP",
-	 .hash = "15486839c17170863f28412fa5aa521cc8831d22cd466d6becafefe60d46570c"},
-	{.plate = "MZ 329 UV",
-	 .hash = "6878e79f48c4c3bb6274e671bc7a8ad7bb08bea6fb815c1da5c45ea106957129"},
-	{.plate = "IP 120 EE",
-	 .hash = "ca2c761d588cd2b84b577ea0811f749052c21ffe90d72ed73a57406a7295d196"},
-	{.plate = "XC 825 YK",
-	 .hash = "16c5fcc59952c5ecbd3a21f312d2d82fe03b9456167cdbba6e31d5f1ed2f4987"},
-	{.plate = "LR 319 AB",
-	 .hash = "596b9efdfd760b954a805fce99c62691d49320a73dbe8a17860b86f3e875b51d"},
-	{.plate = "DA 768 NC",
-	 .hash = "9d2d5d48043396fd0167712078bcd9ff9c0c138224bec224a2ecd89ba79780f7"},
-	{.plate = "AY 717 GV",
-	 .hash = "bbeeddc839d39b39133156d1d868e27f7ebea9f419a199019e556a92b891eabe"},
-	{.plate = "PX 371 JO",
-	 .hash = "ffc1cb11342133dead74f4e0f472daa27a8aedbb21c1e9659ae0fd35b0941201"},
-	{.plate = "WJ 969 CI",
-	 .hash = "5ded47c964754bbbbee9baf806113e8728ca937f8e21e8397259206dc52a5182"},
-	{.plate = "XF 105 RI",
-	 .hash = "213ad25e2fbde5e631eb43c58f0337de3f8f304f76b7a9b8ed4bbd395fa0a341"},
-	{.plate = "MJ 869 ZP",
-	 .hash = "8bf3d447a0ce809bc196956bc89b76b5be52041efa2fa86e061507718b3dfd78"},
-	{.plate = "XB 204 AH",
-	 .hash = "7d14962eedac76f9f178ae4d951653ee19df82083ef1f847bd556c8ce74d8e6b"},
-	{.plate = "XR 821 MN",
-	 .hash = "3a86178967729e8c4735fca4435cdc42cc6d7a473b2a7447988c9772f612bb5a"},
-	{.plate = "QK 964 JQ",
-	 .hash = "48874b7e40b28d1145df4711a66e01fa65beeb95718c0f12a530990d42a9b2e0"},
-	{.plate = "GU 151 JF",
-	 .hash = "2780f572e6749ebfb11a2526dab763ed15d7ee7ac273f9b7a52eaf3c1617f883"},
-	{.plate = "HM 393 UF",
-	 .hash = "77a6b7596c00ce1c541973e97e20ab5e8fc0d8743ad6ab0616fbc6862adaf734"},
-	{.plate = "KR 378 DM",
-	 .hash = "82fbcde762ffa6bd9d92984298e286c35ca1ff1dd512cc9b6d09c324344d1c8e"},
-	{.plate = "EV 734 DM",
-	 .hash = "e86b68867b2304342861e349281f2687a2ba1e2cefe5bc071e41bc3f0928c59e"},
-	{.plate = "GZ 184 TB",
-	 .hash = "8631df17caf6da662552305b5f9f7b84e1fa05200ae9ebe7dd51b58572924865"},
-	{.plate = "KE 423 EN",
-	 .hash = "a10bd11e453b57a2f5f9c0e722b2225e1d703b2fd3737d7b5d99f84230594012"},
-	{.plate = "ZO 822 TE",
-	 .hash = "27528555e738fd33d5ab9ecdbca2fda002d05674bd7036b6b8d597be0b98c56a"},
-	{.plate = "QC 731 AE",
-	 .hash = "fa078e1b97adab924823ba589839b01127bf13bb3813d7f7500881f4741a9d5f"},
-	{.plate = "CB 848 YJ",
-	 .hash = "462abcc3ad636381a12b02680d85a4b2640568a3f78cd70df6ecf49d516dec07"},
-	{.plate = "FD 614 EZ",
-	 .hash = "5e53732487059e8e480783b65cf5cce74d49eb2eca2b1e85dda4bfefa9eff013"},
-	{.plate = "DS 971 YK",
-	 .hash = "7007a52255d99657f2ab562e08275914b834325a74f2f2d173a3b3416ab9a9b1"},
-	{.plate = "BH 584 XO",
-	 .hash = "cc3b9089e494b0a56d49e879151723b46864523328b40aa13ddf7c8397f03ecc"},
-	{.plate = "BS 820 PZ",
-	 .hash = "a29df760f687fbb7a3e3bf4dfd73da987feeeb56ec9f3ffa1c146fbff53ddf00"},
-	{.plate = "TV 289 AE",
-	 .hash = "d0d6fc2468f05258c6406beeec30607aeb0e39edb9007644c05a6b5a34938b79"},
-	{.plate = "GK 239 HS",
-	 .hash = "3941f1329062fc1a2abe2ca3b3239b13be8498483f0b6ddefda5602b629c42c7"},
-	{.plate = "YY 315 JM",
-	 .hash = "964adfda9eff19e3b1a3d5694b9fdeeb9622bc8637de7651040802646de2c5dd"},
-	{.plate = "TP 652 XS",
-	 .hash = "188d555058b2da33ff9e0cd6a3551325691289c86754cee43ffab1c3b40af771"},
-	{.plate = "PJ 947 HA",
-	 .hash = "04280f71432288b41cc0d713558b257f5bb34744037478f5cb969f4a34cb33c8"},
-	{.plate = "RI 557 PV",
-	 .hash = "113bcf9419a8494be5063af3c3e41253a36eecd70d602ff4fbd852fa81850639"},
-	{.plate = "BV 005 XZ",
-	 .hash = "aa73e71ea95290bd7ad99cd2289c334858fd9624114c76a5cd9848f2fa8bb5e0"},
-	{.plate = "YH 569 KI",
-	 .hash = "32795a329a5cd7952e1dc8419ad40ac489a4962d51f0a4b8b474e63eade425b3"},
-	{.plate = "XY 727 CC",
-	 .hash = "5111d631150aff695418ac64da6db28b2c615c52379d0764b37b579ab15a0212"},
-	{.plate = "WS 873 PM",
-	 .hash = "f0ae25b604aa4719f265132377bf851f96d3b756a5716bf4e9584d3a8df37490"},
-	{.plate = "ZJ 569 KU",
-	 .hash = "97aa0914637ff43979d9bedf68785a1ac8ef4b68773f6fd34d1e919781f95d14"},
-	{.plate = "IL 665 DS",
-	 .hash = "31a0225941da80af14491f1481734033c96b3469c723bbb8f9a9ecd40c9f6ba8"},
-	{.plate = "SI 726 NS",
-	 .hash = "280f914d80283f2fb1e7fc11bded919882ae44078a6ab4199fc916ad218cd444"},
-	{.plate = "IM 689 LY",
-	 .hash = "61d5cd4560bdd123f0aa3a5196c467e33859570598268cb5e069439556206c03"},
-	{.plate = "BC 927 KY",
-	 .hash = "296b1c5869909def97549b5012dc03585dd9b154af0768ac465509f1a8fcd627"},
-	{.plate = "YK 871 OV",
-	 .hash = "a78a5865d0ee4c2759602a3af5fbeb7c65785ffa949c2e66de67b4f0308cee63"},
-	{.plate = "WY 586 PX",
-	 .hash = "9344045ac52dc1490274fdf0e865560837ba6863181211fb23168698b618a939"},
-	{.plate = "YR 931 KQ",
-	 .hash = "a5e60dec8a8ab8ee216bf61aa423cb9c9f82497dee571e43fd01b5eb774a6fd1"},
-	{.plate = "EQ 133 UE",
-	 .hash = "9d3c9baf4988ea81511d38d2006fe5e4f5f7a022d52930a5d5f6db2ef65af913"},
-	{.plate = "KT 187 PE",
-	 .hash = "9c5313180630130c457752f5d6546f146f9c3fbb6d0b599ab5f9d6bbc1eb4a90"},
-	{.plate = "DH 473 NE",
-	 .hash = "eadf2cb3112557368304435c5a3a8b603285751bdc6369c777dd4dcfb646a837"},
-	{.plate = "TF 168 YO",
-	 .hash = "0568478568d2e0edf7f0deed298d0362eab5babf4ced8bfdd00b82219c7a0fb4"},
-	{.plate = "LE 314 EB",
-	 .hash = "6eca0d4abdf3e1ccd877a39d05bb5374446c141e0146ab43ae4bbf7add4c84de"},
-	{.plate = "GB 269 QB",
-	 .hash = "e330d431859f2445b551dc206827aef4b91504bf5cc95ceb82f4b3565155c3a2"},
-	{.plate = "VB 022 YO",
-	 .hash = "d9bc85c5363653fed6560a5e0e3e4351f3722938897d7a1010b8be3a34358070"},
-	{.plate = "BT 035 LF",
-	 .hash = "46d05558566f6ba30f28ece5afee9dbf2b63301a4ddbe5fd6dd50e4c3279ccf4"},
-	{.plate = "NA 928 NQ",
-	 .hash = "1c8d6a49c88016073b83f2f1b1542d4c8e53eae28a3e8b0b20d51894a4e23249"},
-	{.plate = "VU 825 XZ",
-	 .hash = "e13d5e8fcecc0e0bd71ce064a35c721460c56efc7310d42c8eccb51618da0867"},
-	{.plate = "VC 835 GU",
-	 .hash = "fc5798ebf412209eaadaa62f4110eb8267e5b29eb0ed667361037b083e8e5951"},
-	{.plate = "AQ 703 TO",
-	 .hash = "5a7121bf81831e24a07035a85cdc42985293418d80e2d8332b83546e3676c22c"},
-	{.plate = "FO 636 UV",
-	 .hash = "b6e3ea5a8051f9670bf4c24e6542027f05bf05019b19a146aaa91507aea9f29d"},
-	{.plate = "TQ 780 YB",
-	 .hash = "f7f6387f36ee32002f8c641e384f76d163e685b5683c459708526f2cee349381"},
-	{.plate = "ST 178 MR",
-	 .hash = "b46abf759ebb76828235160333e09d71bfd94d6b03b5b4c903469fcec29fefd0"},
-	{.plate = "LM 310 IJ",
-	 .hash = "f3fd0f6990c70e5115fbde873e79a301abf1a0e6c0ed28879bcebdfa5bb17e74"},
-	{.plate = "AQ 965 ET",
-	 .hash = "61f796afcff94e07df5e5658fa01b0dfd93ae9da501fe17530dc561f4f095f82"},
-	{.plate = "XY 018 VF",
-	 .hash = "025a5781349f395995346169ed9126a4de93a57df3e0251b88815100d3752ef2"},
-	{.plate = "XR 258 ZF",
-	 .hash = "7bbb065b96c5f1399dfa10edb2bfdd5eb1568c750c7753c43b6be67697bcccc9"},
-	{.plate = "DJ 780 IB",
-	 .hash = "952ee9ce6ba2d71bba25eaf4774eb30a604e27ecb188a7b0333a5b54febc87b7"},
-	{.plate = "PW 650 TK",
-	 .hash = "a1090113990e8be3d7d4d32367dab3d0603f20205917958417a2ff31b8b35c26"},
-	{.plate = "AE 620 OQ",
-	 .hash = "1f1276e12417425b7542aca36d90192096084245c1c15a82410f1a06f6559b47"},
-	{.plate = "AO 643 KH",
-	 .hash = "e44d01f63f639e55779d2d46e71d1fd5838c5619a695778b1e859d8e29de4bc1"},
-	{.plate = "CU 367 QG",
-	 .hash = "4ed638db8ce9ad6424c56e0f1c4d1ed7f0c79b11c35a9ff7b4f51296fbf3b228"},
-	{.plate = "GR 977 PR",
-	 .hash = "6ddff42cadc0807ec0687ecad884d725b06a5cebbea81e551243735c94fac08d"},
-	{.plate = "OG 294 PV",
-	 .hash = "4606f80edd33a36d3cb76000570533a020f50fe4c0caaa4dbebb492f86be9b10"},
-	{.plate = "RA 419 AB",
-	 .hash = "22c2ba5d139cbfc94863940a0bd0dae31e1b751e1585cea4df804278994df93d"},
-	{.plate = "NF 694 OH",
-	 .hash = "e4d44bc67565a8d495331672e20171fa2f97f92356eb3b2eedd805d885ce97bd"},
-	{.plate = "MM 937 SE",
-	 .hash = "165864f385c775d29675c616bb64f905e2c9eb5cbca1178fde3ba5ff5b4457a7"},
-	{.plate = "TC 944 GW",
-	 .hash = "94b3b5241c749252d0eca968536ff9b8347377105c1c52a94cfb182c547f6678"},
-	{.plate = "LQ 796 SC",
-	 .hash = "bd8d3193851d62e09d540bee648fc0690f1d16ebbd78f1c509fd0b5504d4aa3e"},
-	{.plate = "MG 407 PC",
-	 .hash = "3b0b9d125b0dfe74fb8094300a028f26c1d0934197d137b79959791a2e6862cc"},
-	{.plate = "OU 417 QS",
-	 .hash = "7421fc546ddc1ee92a5a7d5f2a0289e59226d52069ca6fc1509b09cb5ffbf85b"},
-	{.plate = "QR 375 JZ",
-	 .hash = "85c245ea896ad8fc3c6d84ca23c04e21997c16ef12a25ae1d930a3408739e5a6"},
-	{.plate = "HF 879 NZ",
-	 .hash = "9fc4b25898537e09da0fcbf5949d862c89aaf6c5a8e763de8ecc69ad46d617c1"},
-	{.plate = "QN 361 WU",
-	 .hash = "43f594f89a2d1fbe13dee63ec244f93c7848f0a453962687fe41ead938c5c3e2"},
-	{.plate = "EB 566 QL",
-	 .hash = "02dd3a9e517be9e532daa715592cfb55c7db08be429a4d80dae2aaa539475251"},
-	{.plate = "OJ 964 ZV",
-	 .hash = "080493647b5281640cfaff49ee7b22b1d73095ac701e43160295d00f4b1ac81a"},
-	{.plate = "GE 878 SX",
-	 .hash = "f6bf1de5280ee8376294dc0cef1e0ad9ebbc34333a0bb89493abe57c4b460113"},
-	{.plate = "RZ 071 JN",
-	 .hash = "cba7762b349da3eff3c669b3924fdada92274826f904e24bffae2a3f847e3442"},
-	{.plate = "BO 157 BW",
-	 .hash = "aaf9fc4a965037b0f91847678f80fe5c885c8328e983372a39401acfb03513ad"},
-	{.plate = "EL 568 FU",
-	 .hash = "7f07f405c5eb036db55fc73a3d7168e9dca05f9503c340f0bd75a2a75a722907"},
-	{.plate = "SS 097 RH",
-	 .hash = "4fd66b3583274a4014cd9045e7932f3967dc7192fe053b720619be7c95565f87"},
-	{.plate = "SB 868 AF",
-	 .hash = "fe4e8339046c3d312c143fbacda6bc366cac0244f2a5d3f3ae3d554f9adf7814"},
-	{.plate = "LU 019 AR",
-	 .hash = "0f6a4b16be123f2948d3c8ba53cd98e311beaeab575a7dfebb78939a5e2c789f"},
-	{.plate = "UW 213 FD",
-	 .hash = "a7ceb91464bf11ce3d2a6bee86c017efe094c23c72c532d34be8e91730173fbe"},
-	{.plate = "QV 003 WE",
-	 .hash = "0bc10960f0c31bd9f5d35c662ea724846faf1153ca55701544c30326307838a8"},
-	{.plate = "ZB 142 VH",
-	 .hash = "1a927c01858f75a037f310d439b0c949f500513e787c88d780a98dfa42173f47"},
-	{.plate = "WF 399 ZM",
-	 .hash = "a75849ba513288060007d14de0e058d6f4f54a81cc2d834d732a605eaebd15f9"},
-	{.plate = "KH 174 BS",
-	 .hash = "9c9d780045cc780cc969b2a6c1325ea9c2aa0f6ffb4e0a8d5d712cab8c1da9ea"},
-	{.plate = "XP 712 UM",
-	 .hash = "5684de355b07f3ee563fffd29b7bfe6f0fc669f75336f4c220f24c0ca810b723"},
-	{.plate = "ZH 994 BQ",
-	 .hash = "156970d8809d00d059e58961282d19cf0e9e6c489b58ee15c5deb746c00cfb61"},
-	{.plate = "MI 264 GI",
-	 .hash = "61e3baca11c195f834d40ea62953b8417a38900bdab8d897acc1a546272c2090"},
-	{.plate = "LT 462 VH",
-	 .hash = "574021daf5d2698c5ac791d0e4de11be94a5bd8ef2a144928436143b5093018c"},
-	{.plate = "HP 131 RG",
-	 .hash = "32430e50d4452390a798b4517bb58fb248e28a91b755b2966fc5715b88042c0d"},
-	{.plate = "JJVU 814",
-	 .hash = "1ae4646533a34ae1a0dc594e888edf8f11514af57f1864dfbd22043126bfd757"},
-	{.plate = "VWTK 217",
-	 .hash = "6df7f23c1c480a4fcb7248f88c8a1e2bf7cd7cca6eaa2500ac71e08c9f217ab3"},
-	{.plate = "QPOK 039",
-	 .hash = "62bb7d0f7a5fc362fd0de3f7aafbde31dbdd8660564463a083e0e6e64c5aaf19"},
-	{.plate = "HTGO 881",
-	 .hash = "ec9769815d2aad14d100ccf3d7fd987a65ca7b3b1801862a53e103e70954a592"},
-	{.plate = "WARN 364",
-	 .hash = "d97de6a8ff4762df16c509c47ff7e210ec15769a1714f781e0f19eb004ac3f99"},
-	{.plate = "IHQC 555",
-	 .hash = "6ceace4a06ba3b059e2aef5f482bc1300ecf555c9784db8ab67444914ee6e8d8"},
-	{.plate = "NBFO 024",
-	 .hash = "b611a4612f18ee63f61c46823adac5e9cc8bff7dccf6414c92643e98d67c7553"},
-	{.plate = "AHXJ 786",
-	 .hash = "94dc5b8de64d38331f193e0c5e05169e1ec52b69c1cb0e7438aaffeab206a47d"},
-	{.plate = "UREW 724",
-	 .hash = "69b8c444f136b861a0e94eeefbed550b2bc81228fd482b790f6b3861c8ef7441"},
-	{.plate = "UEXQ 629",
-	 .hash = "c0d06c52db0f6a44eaad57bb9583ee47e995196283025481bede29489f270753"},
-	{.plate = "OZYA 414",
-	 .hash = "333d62ad5a110895baeb41a1fade76dee8e093881137b8c757f2036112ec50ab"},
-	{.plate = "GYKS 165",
-	 .hash = "27fea32c24534340076d8c843a79132461f635a475574bcddb13a1de2a0d43dc"},
-	{.plate = "ZVID 376",
-	 .hash = "90f534a86661d1150fb510664e9c775ac0c55b12a9d7747d0eb10771c8c532c6"},
-	{.plate = "JIOO 382",
-	 .hash = "b265c4f449c6485e700bcd9af48cb58d145210badf7b584e54b8ae56ef7a75dd"},
-	{.plate = "WBAN 307",
-	 .hash = "88091bf62cbc1a6a339e22a52e36c53e7a2e8375eb1245fb4f7f8a1339a188e5"},
-	{.plate = "ZITS 420",
-	 .hash = "abda08ac809a513942e6d31e02e04abcce1717289aa70578482e5788fb1ca6bf"},
-	{.plate = "FASI 592",
-	 .hash = "26d8d448153410d1b3674be0a08c45dc8780fd7c212eea39bf90c48d59965652"},
-	{.plate = "KQFP 001",
-	 .hash = "d4d60210b030522d75c22a168a9448816c32ad8e0754923404aba2ed9784ff2c"},
-	{.plate = "RAVK 394",
-	 .hash = "03ba3130427a3c4aec7b66e8515075656f437ba0adc31fab6b6c360e1826d1f8"},
-	{.plate = "ISBS 628",
-	 .hash = "af3382c2d513e06b5ef829106f576e97f5a786e07ba6c04801cef330ce69df44"},
-	{.plate = "BSGB 456",
-	 .hash = "39a7ae3be06b6fe2001ddab71e19f4fd998b9fee1d8953822b990e6d7f8f0884"},
-	{.plate = "EGYO 690",
-	 .hash = "567bcb8541eafd5bf279bcc3202cd54ab1abe69d3f2f9be1ebcd30b745926b8f"},
-	{.plate = "YLUS 273",
-	 .hash = "9aba0a8b50708cc832d24eda19b1db28a749230793435f112d982a6cd27b97d6"},
-	{.plate = "IADF 570",
-	 .hash = "add74e6036e1179f96b5356013e9bbffcc9682c4da37712ad20765bd0263734a"},
-	{.plate = "OLCM 665",
-	 .hash = "00e64d309641750ae3f24997c8db710656a0355695173dd6f99b5984bea72091"},
-	{.plate = "CCSG 180",
-	 .hash = "2274072732c7e33ac221f2ab9910fb016f7d2370f52f9d07198f565e5226e482"},
-	{.plate = "LTWL 839",
-	 .hash = "15b848c018f66b1d8e82277ccdd5ba0e946858f63e035a9baacebecac1e7e7a3"},
-	{.plate = "VWSB 863",
-	 .hash = "37cfdfc11a821a9853dbd7addbae79a2cbda2ceb1ca7df48487ce9869b415803"},
-	{.plate = "FUSW 040",
-	 .hash = "4959873e8dcead2b3dcf0a0e13b70421799d70da83dad1cbbfa9e49bd79010fa"},
-	{.plate = "BSYD 487",
-	 .hash = "c2c5f0f229309bc30a92ecdc127b506a2dd30d2d09be06d43b03e7c1cbb21880"},
-	{.plate = "ODKS 833",
-	 .hash = "24d87c5ee4fcb1e2433501823482d95dd70e7101b26706c647dc34308ad234c3"},
-	{.plate = "YIVM 472",
-	 .hash = "332d2f82a6c83f183ac43e94d6ea2a3b064c205fb5548502fdb79b66d5de5d3a"},
-	{.plate = "UYXW 750",
-	 .hash = "64793e1a537465e6dc33635ea8aca769f5136d3b42492b2799c6ab6394f805c2"},
-	{.plate = "EAUX 093",
-	 .hash = "27c213414bb9c5eda44d25c0052b3b4971fbe2a7eec85e725ca61f6ddd84a3ae"},
-	{.plate = "OWUJ 673",
-	 .hash = "ac9bbab9621a5f9ad38a630f804954aabb1ff2a2c4c348be431134852f00bd53"},
-	{.plate = "NITW 786",
-	 .hash = "6afd81f1a800fc40f14dfd49c888b8f2fd6af30231fad0eab8fafb4dc6d4c40a"},
-	{.plate = "PVVC 288",
-	 .hash = "130bc593e8902531cc7bd4d7f60e7f8a175aa8d2b3a46937e55998e5e47595bb"},
-	{.plate = "OTJY 364",
-	 .hash = "5917cc1110ec3e919298eb47f80b49c20555f59511a1202c6dae345ea4a7b0a9"},
-	{.plate = "EVDN 636",
-	 .hash = "9561033849a38858438cb347e1bb8923b9b9d37ab0382c2c69dbdf81ec63724f"},
-	{.plate = "KXDG 460",
-	 .hash = "a551b933b02aec68850e7f067a8440b8bbdad3445aa998e4a1dd459689fdd18a"},
-	{.plate = "SSGW 103",
-	 .hash = "5fb2e8810fd238ba9c6aa8b1f4b3da974659e71e10ab1131a76c023424625298"},
-	{.plate = "VYCR 196",
-	 .hash = "496d3789bc9089da6ce764359a3a371c814bf77f98e8abbefb3fb62f3ebccad2"},
-	{.plate = "KCVE 990",
-	 .hash = "25b194f68419929983836bcabae0541d0e4d6c9860ecb971c46b01d1e36a166c"},
-	{.plate = "OAKR 665",
-	 .hash = "e8c64984b2a8ce2604b7f1570f36175e26c1377df12a48e0ce46f0af8ac5e694"},
-	{.plate = "EVBY 667",
-	 .hash = "622adf601e6f57a7a85d0cd382d430869e16fc3f6d2da13f527327333b80a04f"},
-	{.plate = "EPYY 174",
-	 .hash = "9ccb2e9ac6d96ec6e5f91276ec2fbefcd799a87f9ac02925d07e5329fd09357b"},
-	{.plate = "YWTL 595",
-	 .hash = "a78fa409e472c65f7026a6d4f28666c8bf6f894dc0693ea74e007d817a9e8d26"},
-	{.plate = "WYCF 830",
-	 .hash = "dd653b4afcc973efdf9b30d5be91f9551c70ae9d6f1c8813c5cf8fd40171bd85"},
-	{.plate = "UIWT 149",
-	 .hash = "218b290f9cf7f9a0a00d1458a0d149d1bd439102ba7996a0d36da9ed9effe06d"},
-	{.plate = "LHQX 283",
-	 .hash = "2be4d3ebb138c68d87bd4aa9895e1fb11224bb384b83343880e33d73536cc415"},
-	{.plate = "379 WWJW",
-	 .hash = "bfda994e87195b0094c60e92c3b4a769fa7a01a138d9a4c0ffce357c924f6488"},
-	{.plate = "338 KFQQ",
-	 .hash = "0bc489cf3f64b9d15ff2a4c676484926be716e914c455d041a9e8ada2d353a56"},
-	{.plate = "176 QOUZ",
-	 .hash = "75b770b41af14b004d1c0cb55cc16edc4b8c8eeed34db995f8e8cd4795f6a498"},
-	{.plate = "837 GEDF",
-	 .hash = "b3cac896321fbd51e55a2c11e1b9672df3ec50e9e46848074446061d74bdf317"},
-	{.plate = "808 EAFZ",
-	 .hash = "f75d1e7a7c5591e115d316cf002fdc8a46c73a7a923d0c64b55a592b274464e7"},
-	{.plate = "204 KWUV",
-	 .hash = "118562b99aa9a44c362a12cb3d96d9a3cd7751e8feeed1794a41ed8e7b9470dc"},
-	{.plate = "976 QRHE",
-	 .hash = "1aa5993a1604de01b1ddfc723b00483fb3e593dbab57210c0eced9c06a718ec8"},
-	{.plate = "776 EZFE",
-	 .hash = "ce122abc089b877d5d04b392cc1f19b0ace9640ae4cfa24db941132382f43a3e"},
-	{.plate = "514 BOGT",
-	 .hash = "7b0b30f7ba10bb3a32ff0e189f0ed22f34dc5c0d594418b6386ad2a31ddc226b"},
-	{.plate = "917 EEIL",
-	 .hash = "d1f6ed29c9fd16a147e77c7af833310d0d74b84f0c28018a9544c2039b05dc20"},
-	{.plate = "712 YTQI",
-	 .hash = "a0b9132a9b9196d672795b67a427f37dafaab27371656fa51e69abe7faccae57"},
-	{.plate = "878 ZDUJ",
-	 .hash = "b3f0cbec63bff6439cfe4fdd177f7168e52751baa1bc62fa21e0b1acb1c8eccb"},
-	{.plate = "961 UJVJ",
-	 .hash = "c4e7bbd432da3cecc0f0bd566b5df804c2bb4349719a387aa642b3bcbef9da05"},
-	{.plate = "051 XEYZ",
-	 .hash = "cf5ee38e78500ee1d0ae4124718dc1b62f4abd9315352d789025493804630d97"},
-	{.plate = "726 FDOV",
-	 .hash = "d5209181fec3826c00c7ac8e891a951fe55de8300146a7020a1a9125a84ce6e8"},
-	{.plate = "881 ZBPR",
-	 .hash = "c61dd7d8540b9e9ce7dd0e387d5150f08dd48558ac7e9e366a6086ba3e20fcb0"},
-	{.plate = "586 SJKB",
-	 .hash = "e8e0fecea9772186e40db002d4b7b17c61bbe323b518c8b1380961dbe47b63c5"},
-	{.plate = "162 EUDN",
-	 .hash = "99d7e2e0767195db2b0b4c300e70bda34470d003b3abfded31732690704f6f11"},
-	{.plate = "919 LKZM",
-	 .hash = "a2900cdfd43407ae8530a6c07bae011c98692b6034755be0acc167aa2b987fb6"},
-	{.plate = "659 MWWP",
-	 .hash = "6f91e3eb45c18b998d7d93ec6bdc08279f35a040f6988c172e9c150ff027e849"},
-	{.plate = "873 XNCQ",
-	 .hash = "ac35a08e47ff8c24b3ae14cd14d75f629a723710eab01fe66f23f969527601fb"},
-	{.plate = "829 OVJO",
-	 .hash = "b0b81d8033caabf1efb9fc5b4cc6b2767dab53d46532b86f4b79aff6c0f57e27"},
-	{.plate = "764 FDIO",
-	 .hash = "08bf66d1f85f9a31a8439bf6d2b2bba67bf41fa08d927f9bb7b1b3fb4ff7e137"},
-	{.plate = "541 XATC",
-	 .hash = "c2b3c93bf5799c32d87ea92d04b4299d07f3e0dd4151fd6babeea43a1c239acd"},
-	{.plate = "293 GRDW",
-	 .hash = "c5e3cf73a48c19e3bfb5e1b32eaa6243b53774994eaa3086a1d693ce0423332e"},
-	{.plate = "533 JLLA",
-	 .hash = "32c2366aaf8fd3ace128fa2fb13eb0323e01b6d87d466247348436009ddf0d56"},
-	{.plate = "719 RCEE",
-	 .hash = "0a326c9199f6d70d5b66fae51ac64a7b646c3f187b6829a55843355307a15e99"},
-	{.plate = "137 ECTP",
-	 .hash = "95a19dc0ef72fdda46f36ab665224326db58f5b5e9116928c37ed7952a5a2422"},
-	{.plate = "581 LXQV",
-	 .hash = "ed9268359b7e1ca75cfb5f3b7a39206eb27269e164164da1fcc8a96ce2ea0fa6"},
-	{.plate = "417 WCXS",
-	 .hash = "d20427b9ac1a1e4f484efeb30b52250a0f911c82246d0c481ca69eee75db526c"},
-	{.plate = "463 HTXD",
-	 .hash = "48c175b7b0113d246621da444a1b3858c6ac0a3e6200dda63882f706532b7191"},
-	{.plate = "538 AATE",
-	 .hash = "d90e81c449d344a6e772fde23ef62721513de64875b8eebfb8e6ec665494de9b"},
-	{.plate = "125 BCVX",
-	 .hash = "ea1e6c3799a5c43bdd3433ff693ba89e18f5d466eb518666dfabc9957b9c1cf9"},
-	{.plate = "298 VYKK",
-	 .hash = "56aa7fa2e7eff68297e09e2bfaa6ded237b09ba6da79474d0943ef5ef5c0aeb4"},
-	{.plate = "454 FAIN",
-	 .hash = "2a5e4e96ea2a80c0759cfe8646a70066eac13616d5c71a62f73869a7888b81ea"},
-	{.plate = "547 ADCZ",
-	 .hash = "6bce6d1e344df10b6529b9fb93689198ae378a010ad91c1a7e463b1c95a0c7a7"},
-	{.plate = "627 WMHP",
-	 .hash = "c7c0b471b540e850a35f0724c24a5ef98cf56b5b14eeaa2f370b9549bd9fd61b"},
-	{.plate = "397 BPFG",
-	 .hash = "65320e9f3d86edf751171fc3c4db3551986bb51510cfbbd7e1742a145bf5bd39"},
-	{.plate = "177 PBAK",
-	 .hash = "822a9638dc8ea6e6cf92848b13cf6b9657bd4f4b3ab63007d04ec108aa59a775"},
-	{.plate = "664 RWOV",
-	 .hash = "60c04b08cbf0fbfc7386856ebffe87b1530e6f364ee8c89a7a6e97eea56fcbeb"},
-	{.plate = "870 VYZH",
-	 .hash = "fba587829b79421011f1b92b0d0f48f85c69957a0ceac3309b7c75621196b629"},
-	{.plate = "524 NWKR",
-	 .hash = "0b1e88b73d2083758f768810230fb9c36c827b52b8979762b1eb0bf89030349f"},
-	{.plate = "573 BVGW",
-	 .hash = "ea1670faab61e5d8d1d1df7205b81abe4c3fe1aedfad53cfeceeb300561a0b52"},
-	{.plate = "675 LNRV",
-	 .hash = "51f12ea15154f70cd626e71431125bc999a725002f19ff64a75ce9d82cc9d095"},
-	{.plate = "414 KDPC",
-	 .hash = "0db0d2e5c998686d7ae0fd61c937c671cdcddcd01901404cb24dd1042462292f"},
-	{.plate = "134 NJFG",
-	 .hash = "dada149ee79d138cc9fd115cdabd535a289c31c467ab33bede6c002a9c9e308e"},
-	{.plate = "711 TOYR",
-	 .hash = "46cdf2d087de5858f78f30ca2b3133c536ad6ebb0b1246b29b663284f88f0ac0"},
-	{.plate = "652 KSDZ",
-	 .hash = "675e85a048c917d3b38df56d0c400d54ea5011ef9e22490890103eb153b7a1df"},
-	{.plate = "793 PMSB",
-	 .hash = "e22137868f73d812c2a33c88c3761725c491a6de2866f2db09526df352e85336"},
-	{.plate = "590 VBEA",
-	 .hash = "aad7087ae0cceda64e598ba3c0b0a039983ba087938682e74238fa2f5f7e764f"}};
+/*
+ * Plate table generated at build time from data/plates.csv by
+ * scripts/gen_plate_table.py, as parallel arrays indexed by entry.
+ *
+ * Each packed plate is a little-endian 40-bit value: bits 0..36 hold the
+ * 7 alphanumeric characters in radix 36 and bits 37..39 the separator
+ * layout. CAMERA_PLATE_LAYOUT_SPILL entries instead hold the offset of
+ * their text in camera_plate_spill.
+ */
+#define CAMERA_PLATE_PACKED_SIZE  5
+#define CAMERA_PLATE_VALUE_BITS   37
+#define CAMERA_PLATE_LAYOUT_SPILL 7
 
-const struct camera_data invalid_car_license_plates[] = {
-	{.plate = "KHI7Y3E",
-	 .hash = "7d520441b3a84813ea4b4e774ddb99bc030186dd467f97e0a41c58a1e99e3f18"},
-	{.plate = "B7E1X46",
-	 .hash = "bb3d0092c2a45beae572a6f1f61c500ddf6d9c3a537eea6e841c9d7b898bbb25"},
-	{.plate = "MCB8G3R",
-	 .hash = "b011cab5bbaf33d377970cd1f9eafdf91b18407227f1851c7b7efe6557229f56"},
-	{.plate = "FNG9T7M",
-	 .hash = "edfb529482e2bd991ab5c12e63a0bbe9ad39e3c46ce4734958cba0326aff8035"},
-	{.plate = "0BN3I94",
-	 .hash = "e608b99ff34c28710334e7663bf63930bc74110556da40a833c889b76fd403f5"},
-	{.plate = "E8F1D17",
-	 .hash = "dc8f8fb5970dcc89edc078346af50a105b645d85a9e3e1394529d62a0d066e15"},
-	{.plate = "QBQ1TC5",
-	 .hash = "68ee8b44d4b15cd8f10bde5826c5bae554b83b05f195f4190ab4f2c6db73c94c"},
-	{.plate = "Z3T1C11",
-	 .hash = "5e713427e3c0486aeabe40997e9efa69fe416744963b07ca3ab3474765e1df2d"},
-	{.plate = "DC83L36",
-	 .hash = "ec9f09c361d4fa5a47c64b57cfac72833707c47cdaeeb357c624459ff38198bd"},
-	{.plate = "9FK8G94",
-	 .hash = "f5d343c948dbd717b8a93c90b59d003007f90103af1072153c20915709163c29"},
-	{.plate = "U8Q9Q25",
-	 .hash = "be9f554d9598d07f5773002948ca511da374671bcc5e0eb540f724aa33410242"},
-	{.plate = "J5Y8V79",
-	 .hash = "f8682952571f3d44bd14d872b6cd073509229e2291be0db233618e2480976b6e"},
-	{.plate = "QRS9Q5G",
-	 .hash = "82ce9178a2d1c88662f80da89c5aa674841233239e14aedab664e63156b8fbab"},
-	{.plate = "GCW3A6P",
-	 .hash = "4b9d21e59eb6c3fcc34ccdd9be844fc0d766203622a59d3e740bf8f33aedd13d"},
-	{.plate = "G9A5S07",
-	 .hash = "65c78fc0fbcacb76d8b6724e2313965673e6118faa3d725c75d3b74d6fed59ce"},
-	{.plate = "QIYXQ35",
-	 .hash = "6284708bfe45545b1b8479761587a32194d8094da7818f7223b59a58a431319f"},
-	{.plate = "SNW4F1V",
-	 .hash = "e1cac78dd099705e6a7ada4b619fdc29626a71f97de60dd9767947cbb78876fb"},
-	{.plate = "SR78J55",
-	 .hash = "1f861eec183ea7049820684878c639e36787305cba0e36e6e2b8dc037fdd41ce"},
-	{.plate = "ZDP9O4N",
-	 .hash = "419e7e2beba538ce4e15391d6489b41e066f3557258264a95e607ec849f4200e"},
-	{.plate = "JDMVV93",
-	 .hash = "417f0dcb949aac47773b36b0f3725ec3faf8d93bc51739d73c4e966f6a770858"},
-	{.plate = "D4W3B38",
-	 .hash = "3dce3bcd9b0534d74c6c9def9e50c66f6562a759f2546b448acfa2927ecca900"},
-	{.plate = "WFM0UZ1",
-	 .hash = "d09e962c57ae76c30074c03e57e6da2f513893c9cc52b54a87eb251b54e721e0"},
-	{.plate = "FA24B02",
-	 .hash = "e414ffe759feb6aa74f4576fc0e853d6dc3970e3ea4802b51ac5e6f0e37cb7e7"},
-	{.plate = "P8N0O95",
-	 .hash = "6bd6988625f89745cee880b263087a19b8631c2fe5f38d6e1df1faa813406515"},
-	{.plate = "SBCBC27",
-	 .hash = "8dada5ecc59caf6526c7f879bec499312c16c9b1cd06df73e8a976784261d655"},
-	{.plate = "XO44M60",
-	 .hash = "0228f01c873cabd58bdc21ad5091ee356c20aaf8d6bcfb56dd318fb36f837cdc"},
-	{.plate = "L2W9N10",
-	 .hash = "8806bf2ce92fb39fdc3a776d2d7167691e3b635335348f2beb54fe3ac54c64cb"},
-	{.plate = "OK96D68",
-	 .hash = "ddce0c1f677054f5e5a0f7aba8749b72d564ded76c07ecc0c11546faceaef76a"},
-	{.plate = "B2M8M15",
-	 .hash = "a49a980917da12097eb67bd5d997a422fdd2b56c7549bb595f156768abe847d0"},
-	{.plate = "FNY0AB6",
-	 .hash = "0ba2009a07f6da06f34516b5ccb01329b5ca0cfd472881b0231b760256f9b349"},
-	{.plate = "Z7W4L07",
-	 .hash = "1be4b239bdd8a2795f975f980730d80ed7d4c1bf1e2ff8f3e071f278192987c9"},
-	{.plate = "9PW2L98",
-	 .hash = "81b4b65c48ce9c5e02ed1a643ac0f34f50bd549fa4f4a27d9f948aedf095dcbb"},
-	{.plate = "ZV07Z98",
-	 .hash = "758326065f3905c9addaa91d4dc694dd16e8789362c7a550e6bbc6cbe1014f30"},
-	{.plate = "MWT0NS7",
-	 .hash = "ca7e547860bf087f2dced48e0d837d7ce81563b15ccad892ef2091f0976b7667"},
-	{.plate = "XDT6W2R",
-	 .hash = "9c902e1df86e8e987735d1655f10370124843daa550bcf7f321295c92ed420fe"},
-	{.plate = "4XB4R29",
-	 .hash = "c3af3a0581753cde714c25ade4fcb3df0d7ef4746c56638f460e39b33f4582b8"},
-	{.plate = "HY27N54",
-	 .hash = "9a96aa49d3fbad8624e736caf772e253eee0ff72940062464f3a41bd3600ea21"},
-	{.plate = "6HT0L40",
-	 .hash = "c9dfeeb10cb8fd647040e26d1921633871717f45133cc87aca4841bef7829eae"},
-	{.plate = "F6Y6N21",
-	 .hash = "27697c70187cd6953217d01d28311104d7485ad402aa7ff7fe38e406e19f3a1f"},
-	{.plate = "CNY5GM8",
-	 .hash = "e960f09726eea862f307cc4f5e5db658971a8a424f79ad92ef1e9d80be458bdf"},
-	{.plate = "TVK5R1C",
-	 .hash = "b9fb9201b90eca06cf0e751e849e7fe8a2f4d716c0d70b0e77350cf3e8d5ee0f"},
-	{.plate = "TZ98F43",
-	 .hash = "e84c26ae73860a5230d64afd1f6c1fec8d140fb0894ec09af1ad9fb8d3ba7268"},
-	{.plate = "IUADQ77",
-	 .hash = "af3af1c2baa9bb9d41bd8a8a8766806c1a8d06426feb198a3292b38961ea6d3c"},
-	{.plate = "3UO6V71",
-	 .hash = "eaa530aaeb3a36c95fdd8a2945730390be5eba9d643256484b89d53880fc13bf"},
-	{.plate = "HDC0757",
-	 .hash = "717d24b2f6b4763b3ad12acd44c74253e43549806cab53ea8bdbffb08fcf5af0"},
-	{.plate = "PIT6SJ1",
-	 .hash = "a75fcef07c618e2f77ed75dcc06ec0dd2cac4f5a0bc2e2741b92c3134225d88f"},
-	{.plate = "RHJJX30",
-	 .hash = "fbe7e8c8fa5e7cacd673b2ef0bd5fc39cc4a789ae7c0893f2076af93249e2c0f"},
-	{.plate = "FQN1875",
-	 .hash = "895648ca67ad479ba660f15c337e59206b2d033058a7322bc1d9de1d1ea7daf0"},
-	{.plate = "7NC1Y11",
-	 .hash = "deac87c138737a5cb62c74d32799f782e6af18c4aa3e01fd7efe35077f1adaf3"},
-	{.plate = "RGD9VW7",
-	 .hash = "c934b9a705bd3bb634561fa0b1fd52a9492d122c6944e60c47feb3dac3732a2b"},
-	{.plate = "GZ70H08",
-	 .hash = "04d7f5a3eb2ce8b567dc349904d11a708f5a02a389495c2ff2d682bdd376e4a2"},
-	{.plate = "HHA1240",
-	 .hash = "4df196b73d36d19dcae1d1021524789c5db6cf050d7879dc1e608fcde6ee3b77"},
-	{.plate = "QLZ2311",
-	 .hash = "c5be7c5475f7b6c9e37c4003df0638bc635a47b122470f59a4bed44699877249"},
-	{.plate = "CGOGG17",
-	 .hash = "4ba87973287c6ef360c37d6ff015f9e97456c802946f478d57ad44b2057c6fc3"},
-	{.plate = "5OX5S05",
-	 .hash = "12210408c75da2063808fe3d6f11b1e7e1db2f704cd376592b32c16ae27ed30d"},
-	{.plate = "EG88H14",
-	 .hash = "31416b2c3fbc62ea771036c4d79ab1f155b906a1d9687f82a8d5692cc2563ca1"},
-	{.plate = "RQ66X53",
-	 .hash = "42e98bdc13332bcd0c32b9cf6c1819d0eed6bd448c55ee351b44ada0781467da"},
-	{.plate = "T6M7C51",
-	 .hash = "30109b2bc80060c67b20d81052c989381e4429f50736774f6d75edc8c3e541df"},
-	{.plate = "E0W1X48",
-	 .hash = "dc19fd70081d653996d76d0b5f2b333a5c9aad2d0caaa389719348df087b4074"},
-	{.plate = "HVH6QG3",
-	 .hash = "a82e201f6c662acbd26fe4f5c3353f61655d1a256d0986735032d3360724f555"},
-	{.plate = "MEF9YJ6",
-	 .hash = "4c7ab80735b7d49bb6d6098f5f139b3448ab7f840f716a7c3dca0dca234ca8da"},
-	{.plate = "XTL5116",
-	 .hash = "182d91cabfdfee9d583c48ea836cdb17c42702246c1c8bdaa498ad343d38fc19"},
-	{.plate = "DCFEW27",
-	 .hash = "7f192d44a96a9795ad5ab482a6aee74bbe745af885ef7a7f0f9be595797bac62"},
-	{.plate = "5US7K92",
-	 .hash = "f9ee6650000ec6382fa35b0e85cb7e563d33458a0bd0d97e5cc25b571aa1c903"},
-	{.plate = "MJZHM62",
-	 .hash = "62a989193cc3333d866f273f5b639a5c88b8009a3006dad0c9e79fb0eba16dbb"},
-	{.plate = "QKQ4GG9",
-	 .hash = "ff0a3f04d07609d5598caa84b0656ff6f71270e71acbd7cb75a576bfe4d63910"},
-	{.plate = "7KH6I46",
-	 .hash = "05f5bb9af27aeadf49d049ba9c62c1924cbcb90ed70440aecb7608003263894f"},
-	{.plate = "BBU1W6E",
-	 .hash = "993638c2f9f8c32ca45e47430775f9e493b9b4e64ff0af78407c40b8985cecb1"},
-	{.plate = "7KS7C22",
-	 .hash = "03695d84c8c1f55bea0a6cc4ad61397893e7d6b1795026396fd1ee67c1793395"},
-	{.plate = "6OT9C74",
-	 .hash = "7257158645379882eafb0eeed22250a5bb9e0d925888eb6b58771f4dfa9d300b"},
-	{.plate = "D8U1E12",
-	 .hash = "1f02c9ac105220be2a2577d96549091b0330ec453b86625cf3f300131be9e7fb"},
-	{.plate = "9XH7L49",
-	 .hash = "1fe2a991c6154f6086af9f9f4d5fb51045706cbede3a2bc6f9ffa8e92f8bcaea"},
-	{.plate = "TCJSR58",
-	 .hash = "0cc0d1697b51c9eb6754ad1048c7b6350e262e4596a8611b4571b0cbf70e02b6"},
-	{.plate = "AIAPH73",
-	 .hash = "85f5e967aadb934649ef300e875a5fb657e34cb49450b01dc23b2c861b953bbd"},
-	{.plate = "BUH9Q8S",
-	 .hash = "2c3f5fbdaa062b357c48bbb97d94207da1842f2b17d21d3cc984daf1a4d7d693"},
-	{.plate = "CH78R58",
-	 .hash = "adf5ba6b04b3fef6ae1a4079ee67a0ddba5d3f577ebb342a02a0812ce8d07c5f"},
-	{.plate = "GFX5920",
-	 .hash = "d1a83e2e60f5e773948e5c1fa03e2381bfdcdc9e9bbf0d5f6bed9b1abfd1daef"},
-	{.plate = "5RG3U05",
-	 .hash = "f17f8a68433256a57294662ff7bab952603fb7bdda9db91470915bfe01551ab0"},
-	{.plate = "YV66F28",
-	 .hash = "a923964fb91966c46cd6805286c51ebefde9f4e425616a7bc9a8f5d9f1997685"},
-	{.plate = "YUEGI26",
-	 .hash = "a5bbb09a057e7d7c434905c5d20aa3f4200434021b2faad49eaf7ca6f74a131d"},
-	{.plate = "2MN6M63",
-	 .hash = "7926787385b50147aebf51a301d03f37d776d212bb850dc62880178104e1b819"},
-	{.plate = "OIG5K7C",
-	 .hash = "3aa4862c341f9936fa666c234c3b7b90e29f7459486d07ece628416e8e8156d6"},
-	{.plate = "FSESH70",
-	 .hash = "d3ea0cb202327e87a2f87a6aa90f4cfed738ee4cf39c9904afc4e4264788d4a3"},
-	{.plate = "AUA9RI5",
-	 .hash = "79cfcec907640c488fdbbebddf736536c486a9fa20c2eec3a35bc0f41d7640ef"},
-	{.plate = "EST3VL6",
-	 .hash = "a57d208724e19ad98c1edc2f391ae543d63f7232617596a85ad81d60d3720cdf"},
-	{.plate = "U5K1D15",
-	 .hash = "5e71b1f4d74f3e88b8f8339efb3af036a2d0d143bf4a9b5f5617e686dc9f2433"},
-	{.plate = "VBA5V8F",
-	 .hash = "7a26b26b1d1456572fb137d23bd90497abebf6fb4e570dbcc470bb18bca994e7"},
-	{.plate = "SES5G1M",
-	 .hash = "c88e379ed5c98cc11a705ac705a30347054649dee93ffb40d2cf775253615c8c"},
-	{.plate = "GXB0JY1",
-	 .hash = "3dea65616304f6aa52d3e88759bf0677c87193b7143fc0d3455687c0727514ff"},
-	{.plate = "AGG5279",
-	 .hash = "24d0c69c4e8d45a3aacc329c474be08a82be6efa1ecc721b4128987f4be3eb8b"},
-	{.plate = "EY79X83",
-	 .hash = "6c8a72b6bf00743e1071f0b5bc4e0dd89d942c1167067d4e4479aa27e01790f8"},
-	{.plate = "I0K4S63",
-	 .hash = "f2bb35d2221bd6a97ae442d772c3bdf9d8ff311242c84acd514e8258b8f92397"},
-	{.plate = "AZ46D93",
-	 .hash = "6ffba47bbc1698bada2515f39e9868127acf03486dc0b37ae8dc36e2a3956e58"},
-	{.plate = "MGF0637",
-	 .hash = "a9f6e244b44d50e0c29815ea72408578b3f087ffce4c4238d8daa4aa9c97d419"},
-	{.plate = "VWK8UI0",
-	 .hash = "2df564bfb7926145b09d2a931d4f1fa316e9967957523690209496a5390dd198"},
-	{.plate = "M1V8L20",
-	 .hash = "a53cfca767492f91a06cd1791a06da04267165682362c66a24b04e81b6082aab"},
-	{.plate = "ZMRRT28",
-	 .hash = "b97161b78a31f862bb73ae2cc7693f137232913c4eb957481a292dcef8cb543e"},
-	{.plate = "3WJ4L77",
-	 .hash = "d736a9b7899cb0511d8dbafd9489fe2df98fa4af1e478f20e8aa6228e778fc2e"},
-	{.plate = "SMW7844",
-	 .hash = "ce3381d0ebe8d40d98c59cff8f283a66e52fa59fe3ea3145dec50509cdd203aa"},
-	{.plate = "ZIBOD87",
-	 .hash = "48e4b107352df6029d5651a8c2ed78c3e5ff665fffc38d9bf91f83ae45e843ff"},
-	{.plate = "LQ 3H2 ZV",
-	 .hash = "5982ba4f7d49a3bdc6a2fd82d6142629bb056865f1bda87a324cbbb73c2a5eac"},
-	{.plate = "JJ 09O DZ",
-	 .hash = "d4996ed4e84669fe4ebe885d7efe0189ad407d3c2623de2b8fe1b27177b8c2f1"},
-	{.plate = "DA 74Q AN",
-	 .hash = "fea3432691bba126cacad52443f7e7459def92ec169e8787f8e1d595130d7862"},
-	{.plate = "JG O40 UZ",
-	 .hash = "b37d372c953fb33ea02409c1fc192f19e7aba345865a94e3e2c132669ac065c8"},
-	{.plate = "OX 71O VN",
-	 .hash = "abbca55d9886957e2734c76b59bb5126964574453e6497a942f2e522af3095b8"},
-	{.plate = "DM 6E0 DY",
-	 .hash = "63d4ab8227f303b1e05048b63b1b9fc050f0d166313a3491e37dbdb8cb49f29c"},
-	{.plate = "KQ 97I QS",
-	 .hash = "46873f4e06a17af9a63057b776950a744d25e7457129887f900d18c450d995e9"},
-	{.plate = "AP H56 CX",
-	 .hash = "c0e2bc5db405d50677ba1022827ce2f373b91238f412adbaecc37cfbc3e6f07f"},
-	{.plate = "MD S40 ZX",
-	 .hash = "83f1adcccb7c213c61faa757ae16fc93470b9259fc323d637b649fa6b2075553"},
-	{.plate = "C0 0S7 PY",
-	 .hash = "f1cd5c1378d59edf5d75d6b9d6a787250c931f0ea2d504ed7935499f552cc985"},
-	{.plate = "EU U28 CW",
-	 .hash = "028f92e017be168f006118bbb36445075bc5d5cf2b0a5444fbe3b0b35a2a98f9"},
-	{.plate = "Q1 7X0 ON",
-	 .hash = "eb85f51b956f3fab97fbb5cab18c31675979e65e5a272dddb87d2d72c954923b"},
-	{.plate = "V3 G66 MA",
-	 .hash = "835ca967c3f9bc28323f1cc6bcb2d1180782fd47ddc8fc226cc7c9c8dd6ad790"},
-	{.plate = "S6 27W YP",
-	 .hash = "456f0c8758e4556b669d7964efe6927cd62367ce98bf88b7c9d9388409855d2d"},
-	{.plate = "BW 4C4 U9",
-	 .hash = "78a777fee12189012f24fe81a4f59682c0baf616882750c307e41ed206f2e920"},
-	{.plate = "RY K02BK",
-	 .hash = "d044731a07d0e86f13eb4a0facf4568116e1eb50536de6645bd56664fb3e8dd1"},
-	{.plate = "LB0N7 LH",
-	 .hash = "8a5574e241beca35d02c085b9231e10c25f58efd8a56d5aa09ec68c4fe8baea7"},
-	{.plate = "UZ@48G FT",
-	 .hash = "1313f979a43304845025b76644a06d28c6a23b0866cddb1f19d5b9388e659c6a"},
-	{.plate = "VX O%1 QC",
-	 .hash = "30743299cd1e9699c6d85f1627c1ce5f6ff88a7f24959b7fc2d5010de000fae6"},
-	{.plate = "XM 8E1 LQ",
-	 .hash = "b84c5ca64b83fc1fc4ce39e3e5b6c5317c0d0fc8aeaba9582b04729e932a1623"},
-	{.plate = "VF DSK47 OG",
-	 .hash = "31880199ec56cce2f8f674c690256ca6b0045d8bca04278d54b4b1624c0dff1c"},
-	{.plate = "RA F70 XH",
-	 .hash = "b52302bb1752b8dd80e48ae52acd5e171fe340e92e75ec075b6389375dd1ede1"},
-	{.plate = "JI Y38 YO",
-	 .hash = "e8c8a73b71af0aa16dd6f4cf3a546c3ae6284c0426263355261f42ffcce799e6"},
-	{.plate = "NE 8B2 RB",
-	 .hash = "a5b6005bf8f4ca72d51de3b42d2d4a89e73ab7140a0a3b49b8541331f041cdd0"},
-	{.plate = "LL 1G8 LA",
-	 .hash = "15587e861f7a45204345e75782b94a71e4506d6923093da27c14111dbe0bc06d"},
-	{.plate = "DH 95B UM",
-	 .hash = "f186df1620b31699d1d52ffb2d5bb6a63b3323cd9a45aad552ba5194293b60f5"},
-	{.plate = "MK 9S6 WF",
-	 .hash = "e3d62a42dcb857eb42b844efae0d6c589da36b3570d2ac12af292f802fbc9984"},
-	{.plate = "AJ 6S1 MY",
-	 .hash = "b70a3c806dc31b2edb98ee81367af4014542e38683a62df24dbc46bb653e01a8"},
-	{.plate = "FH T75 IQ",
-	 .hash = "02d70bbe93f528ec87ed49fffae99c32b9de3a83774647476a3a3787522f5c2f"},
-	{.plate = "KL 3W6 IU",
-	 .hash = "37c818bd59829bca1791b7cd8016465b44d15d538a6ef091571ce3a93295fc00"},
-	{.plate = "WC 9V0 PF",
-	 .hash = "46fe55367e07ac0e3ac63943d476f2b2ce37b9de1638a1ac84b3105d52a9bf91"},
-	{.plate = "OH 1Q7 MV",
-	 .hash = "f3bed798ef6b0710c32cae00d38962e919183d38a31e63062fc7a8425bd84830"},
-	{.plate = "QJ 7G9 QE",
-	 .hash = "88f74aabe15110ce596fa62f732d8156e298985f603f6e7748c33dc10580af6a"},
-	{.plate = "GZ 94M VS",
-	 .hash = "668b33b0e96d8c1c074318bdfd93f1e382b8dea78a46e833ba901674fd6b34e4"},
-	{.plate = "IH S53 YW",
-	 .hash = "31301c08cd82a3667347c42dc5c99f3d7f57f8d3651513fa07c341f4202ecf73"},
-	{.plate = "LN 85J GY",
-	 .hash = "c8ea7cc66074f7ee417828c8e3ed0cc649776e091001e574a822befc7c8cb8b2"},
-	{.plate = "VV K87 YK",
-	 .hash = "af4fa7afca16fc921ef004fac7fa693407d83bdf5e00d895ed6a67f66b7c1a5a"},
-	{.plate = "YD S51 EX",
-	 .hash = "e5ea37573d434f39e60f2266b4644deaf648cb05c32a4c43bc573073dc42791a"},
-	{.plate = "QI 0P6 YK",
-	 .hash = "4efa933e8630623b64c41bdc4f32c518b557e599541a84c9f916a8109f09ccdd"},
-	{.plate = "MZ 7R1 TD",
-	 .hash = "e8662d88a7f354e748be80a92a39eed9010c17524c7530a0033c2adda0728d82"},
-	{.plate = "JK 9F1 XT",
-	 .hash = "880c329468b16ecfa9a230f952efe30fa3d48305ae498cb5429029a5e952034d"},
-	{.plate = "GX 05M UK",
-	 .hash = "dad3c63400198b64bbfc729b47b804efeb78748eb090a8f1db36abb676d1c310"},
-	{.plate = "BO S81 FA",
-	 .hash = "c708a8796d3e7b7ad28fe0ef8e8710dfe73d30c479838b2eddbc0de7ff536a10"},
-	{.plate = "LF 8B3 ZO",
-	 .hash = "a8967686ebb552d63f3a712dbb5a74d74df5896a3caac5f1212817e5b815054a"},
-	{.plate = "JR I92 FQ",
-	 .hash = "30006fc20272121a9c57514a4d0ef8a75219914a739aeb6db253f9976b852fa4"},
-	{.plate = "DQ X43 AK",
-	 .hash = "febb7fd17a13dccdc184b51ef2682d9e4478ee44faed4704327e4ca480c787d8"},
-	{.plate = "WG X43 CD",
-	 .hash = "cdf8b38c5b7456acb675d8516c008b9a09af7678fa7c1b49b581e71399216764"},
-	{.plate = "ZF E23 DS",
-	 .hash = "eebe6ac590681ad3fe9796b01c13ae034f386f77bd6fce18f31ed423fb982756"},
-	{.plate = "CQ 5F7 VD",
-	 .hash = "d976fd2b34167a7cb12c08ea0e5d3abc0375da071da84a6f04089dc485be936b"},
-	{.plate = "TJ 40N CA",
-	 .hash = "66e5a019fef114e4d4113b9ccf7ec4a48f2516c8ae566123412f81666e2f1e88"},
-	{.plate = "TS E26 HB",
-	 .hash = "336b3f92c29e7369e3b7c1d47ca175d6d72a656ffd78da3e911c16fdfa4d8288"},
-	{.plate = "WV 8C7 RA",
-	 .hash = "7bbe6c83c7e5302d5343acfef15a4ead389dd0c86008ca0f88e3ba580d8d9ae0"},
-	{.plate = "ZP 54P PH",
-	 .hash = "2ca27732aafff3193dc3170cb5987ae9960b93d41ff441aee7d7ef1265cd3551"},
-	{.plate = "GT E43 TH",
-	 .hash = "93f6e131fa2eee99f9da7763d065bd7e96e9d664b482fddffa5a50d5575281b3"},
-	{.plate = "TT 73P KT",
-	 .hash = "45d0edb18db51fd94cd2f34fc65dc3f5dab3ab684bcf943423ce76eb5af29459"},
-	{.plate = "SE 44R SX",
-	 .hash = "8dc99c00743578236e26ae25c57a0c1af8fd5a1b43f89cfde2b5552ff6985bc9"},
-	{.plate = "DL 45S LB",
-	 .hash = "237e15974b2da5d3cc107a1a7865393231af4382e4945ddfafd9d95a3c5d9875"},
-	{.plate = "IZ 90Q ZE",
-	 .hash = "654dc62a97755fe20dab3e81cf37100deb89143cd037aa95ae5504104a17abe8"},
-	{.plate = "KW F24 UW",
-	 .hash = "7e6c69e100096cff7a9699c414833390f07b65f8e3150598165a2c6772f34b7b"},
-	{.plate = "WD 9X1 EC",
-	 .hash = "61fb56362eb03c5c72db92aa7dfe2c0793b501d2acde9f7b07121d82891b3d82"},
-	{.plate = "FQ 7C9 CO",
-	 .hash = "0361f3dae5b23a048fafb8595ba484e53fcc1e618973b436b61b08cce1088f9f"},
-	{.plate = "ZJ 2Z8 RU",
-	 .hash = "0fca51cfab5fceb4b816ae1585fcbe0651083e4d0c45ffc53b20ca25eebbfe29"},
-	{.plate = "WK C59 YU",
-	 .hash = "52b35aaed170e664cecda0e79951ec50517249bfc17679db17b4c02a069560af"},
-	{.plate = "JT 2V8 OD",
-	 .hash = "05723b3037272847e2f474db41e9ae576ff61f1438f14d012f9b938aa09e7184"},
-	{.plate = "QP 6J2 BI",
-	 .hash = "f3c1ba0f6560869b8e602281c1da978f8347474d0741c401ec061dde3f20e77d"},
-	{.plate = "GT F04 PN",
-	 .hash = "ac98ae06a55afcbf3156e3a53801ab0c9642b9a094fb2ffac0cc3798ecae2674"},
-	{.plate = "LG 9I6 AN",
-	 .hash = "55cc757aeabc76d5840b5750d2154b6dd33e7c450164f65eee39de7936132fb8"},
-	{.plate = "UB 0O1 KD",
-	 .hash = "b7107aac526bbc63656762acd97a3a6990a7ee7e6ad2bf1c9e7a93f72a36096c"},
-	{.plate = "BA 67Q PE",
-	 .hash = "817c64b94c469b62f62afc86ef3fe2dd2140be1a5d6480aa98da4a3f8ae50ddc"},
-	{.plate = "AX F77 GF",
-	 .hash = "db9ba0a989a6b921ee8ca631f23af3bf4d735c2e6113d264cb47c37b744e6f7a"},
-	{.plate = "RI B82 MO",
-	 .hash = "a48ba8a8c7c5e737ba4c68e463489908ebab2c372cbc814bb4fe0236510d161b"},
-	{.plate = "SP 1U2 KQ",
-	 .hash = "1df9a0d6cc4384102a92ea12656ecdc1cb0f27e138729562cc448e15f3f0f3aa"},
-	{.plate = "PG 7H3 XT",
-	 .hash = "1eaecc39097e407ad97702ce095c050aebc56a5744a4cb2b11684cee2b4d2ead"},
-	{.plate = "NV 14U BP",
-	 .hash = "4c8cbc061c90a8db0a60eccb772d57e38dd520b6d332602e8d3644c17c606dc3"},
-	{.plate = "DT 83I NK",
-	 .hash = "a6e1176f294e4c932b1915fc4b80813c4f22674cddd130810e2516a6a546629b"},
-	{.plate = "BH 1L1 US",
-	 .hash = "78aa7665ffe1decbd964885bba296a712c35c916cb0d3f4786047ac264d0fc6c"},
-	{.plate = "ZS 1S3 AE",
-	 .hash = "81ff5d737eacb41086e18c7a28a0f3979cc7a64c85ae727c64de0ddba69697f3"},
-	{.plate = "WJ 46L IY",
-	 .hash = "1e0b52b6013e95f30b093b12889d6ca97a317a43069d9b4056497ce9f7193472"},
-	{.plate = "XE 7B1 TE",
-	 .hash = "59fd394b255d784f10d390dd2da5356e4014d866ef6a7544759acefb96c41cab"},
-	{.plate = "BI 68P TR",
-	 .hash = "afb07ed8c4cddd19f78ee05652ccca88ed2c76798b473bfdeea989baa1227537"},
-	{.plate = "SI J64 KE",
-	 .hash = "ab5b3e5491d56c59d6f0d021f447ae329620a68efabadb34b3faba4fb1e99ba7"},
-	{.plate = "TT 19F NH",
-	 .hash = "18a823b42db3ff4cfd1cb9e42529b77ac67d88f6d9f5048625510d3af99a7664"},
-	{.plate = "AK 0S8 UA",
-	 .hash = "6d900e3b2aed54fd8ea95f7a2e52e7a242594be9e0dce6a0976299b942a55926"},
-	{.plate = "IY 3L0 VA",
-	 .hash = "5fd04d04c86f76e53ea478607e8948e69856edb7111f83e4a3ec93cf5796e723"},
-	{.plate = "CA 76I IW",
-	 .hash = "2cdcea0a2443f7d960215d051da307a510cf8e93ba9c55ce300bdf512f2d6f64"},
-	{.plate = "XX 08F VY",
-	 .hash = "d7011a648d7db48dce0f22327a1244894047567b59feb6037b8efbc356e4ce7c"},
-	{.plate = "ZQ 8Z8 UI",
-	 .hash = "5b1d8beebda883237266de736f2e187d37d0aa120c7834a88788686c39b8a188"},
-	{.plate = "EO 5L3 OC",
-	 .hash = "8b3205267874183af69484882df474721d11655223fc5faec46e1edac28c637a"},
-	{.plate = "KM 8B4 DT",
-	 .hash = "64f905eac64458abf59ca7a950f876ada712a9a140abc77f413857cf5c692cdc"},
-	{.plate = "ZZ E72 AA",
-	 .hash = "c560440f898e1be9d3bdf74ce21351635b6517ccf82476e0184ad6159dddd9dc"},
-	{.plate = "GC 19K JQ",
-	 .hash = "73eb68f779e1f9ee5a6593e55e260dcfa85d3740e25f16b93cca8b01f5a40877"},
-	{.plate = "HG 67Z TV",
-	 .hash = "cc374a0137a4d2a5f91836b21ac07bdff3eb3aae4b187339975078a46ee7fb0c"},
-	{.plate = "PU 27Y NO",
-	 .hash = "c80b5113d699c902e06ba471d92acec72f9fbe55971c993984189267d5b5e252"},
-	{.plate = "RK B01 RJ",
-	 .hash = "802f9de41d32f991ba0390f5f295f1194b717aa7c177b0f0842472939fb48b6a"},
-	{.plate = "FC S37 DN",
-	 .hash = "cfad1a1e4d0924a79a0077f19399e69be2225be58f1aa0a80fd058d8b36021fc"},
-	{.plate = "HD 8D4 AR",
-	 .hash = "8632f3cc57d91a2cca5e0a3a8f2da31726fa43afc3413af182109bc1c7633676"},
-	{.plate = "AG 62D PS",
-	 .hash = "acca424999695d35356f9e8a025a12ab86e9cfd3ee3b5c2c308e3a6316890a1d"},
-	{.plate = "BL F51 WM",
-	 .hash = "707a9ec0aebcdd79a84867ac4c52cf71d888cbecae9af3f23966bdc7cebdaa6c"},
-	{.plate = "YY U38 IJ",
-	 .hash = "7aaaca0fd546ae23fc31b494f69a79d46e92e1266df33fb3c7df7856c40bf2b7"},
-	{.plate = "AX H18 KH",
-	 .hash = "917b4bebb66b3411a77ba01d1c3051e30547c7f0db024e7c41e8f58e69f3683d"},
-	{.plate = "CC1C 888",
-	 .hash = "8901c7438808f8f1d24afa2441cb30b3472231e32c2fd8c7641b66118865fa8d"},
-	{.plate = "I2II 111",
-	 .hash = "0c71eb7da38590237ce32ba5be8a2b05861b47d2b6884c507e150b3ca4bc8fa6"},
-	{.plate = "F0FF 111",
-	 .hash = "2e2ef606718dd23b79e3a2f95e7a3ff1abf2bd2ae909dd3c1a224331b36b1582"},
-	{.plate = "BB9B 666",
-	 .hash = "b90fee328049e8d3242abb93fd2143dc0ad7be2d0d53e79e821bdeaebe882e08"},
-	{.plate = "2OOO 111",
-	 .hash = "a9e29b3ed3da1f3414f2e12f720a38ced576401dc8345020ea8d660407587897"},
-	{.plate = "VVV7 888",
-	 .hash = "6705958f7d8cbbb47947714abd6018b7a664d83240b1c486b423c48b6cdfaeed"},
-	{.plate = "QQQ0 444",
-	 .hash = "9abad5945cb61a2a3eaec52cefe1d3bdb28019e9828ecdda62fcccb5560ec260"},
-	{.plate = "XXX5 555",
-	 .hash = "896f259097531fd69ef76103fe00b0de65eca86e6ec4a85dd2ee24d9f868c973"},
-	{.plate = "2QQQ 111",
-	 .hash = "602bfacd47048b042b14289e23160059a6ad211d288f855678e0ae8bf2dcce2c"},
-	{.plate = "P7PP 333",
-	 .hash = "b5774c20942b404af4135c400af09c0113e541591518bd333a552666c89579b7"},
-	{.plate = "RR9R 999",
-	 .hash = "49ad6b68e76d47977c1095fc50718fd237f405b6aa1cf599386cf05446724ce6"},
-	{.plate = "UUU3 888",
-	 .hash = "2cfd4ec4064090104f4372cf51eb8ab69dad94561aca0da13bd25e1f90a170a8"},
-	{.plate = "8CCC 444",
-	 .hash = "864308cec261c39a6ac9bc800ad3cbebb5215fb0b4798b7628dc4695fedd8fee"},
-	{.plate = "KKK4 444",
-	 .hash = "1c94955971418cd7f9d6d1369ffcc3b9c7a4a9b72bce820b5ebd64a1f2bef70e"},
-	{.plate = "OOO4 111",
-	 .hash = "91a75de15fc47a99dfbe29591369873920b76ce71d2cbabf9fd33fce51c35fcb"},
-	{.plate = "AA4A 222",
-	 .hash = "115ae4230bb562b891391a3421d49147454ede9b0b4ce268a05ec756b5a4ccae"},
-	{.plate = "GGG7 000",
-	 .hash = "9abc57cde737f12226a941176575ae6fb5d5381c5e91f15fb4809d3bde149c33"},
-	{.plate = "0PPP 4R4",
-	 .hash = "1a3675c328aff79784b43420fb07071611c9bb68fb33a6876d44e910d7f9f204"},
-	{.plate = "CCC5 2&2",
-	 .hash = "76e2c5146b62df7a2b3dde6936d3994b1e5cd96f97a015c44a17a18eb7f4d597"},
-	{.plate = "XX7X 22F",
-	 .hash = "0235cc01cf6fd72c73a741502326b3d62669af8896dbc30a73f57d3a84c252ae"},
-	{.plate = "V7VV 111",
-	 .hash = "181f231aa0818d954026124946f8f2d897bb0cbf00bc4f994777f17b850bfb97"},
-	{.plate = "Z8ZZ 222",
-	 .hash = "1b31953bff4694c57e94fd956c5307f430c8097e0be55a4cd492d2052b751f1c"},
-	{.plate = "0NNN 555",
-	 .hash = "813e65a9d03651c9731cf64c63e0c7ae5f2fa5b61e85463c806c33a4039ac8e7"},
-	{.plate = "EE6E 111",
-	 .hash = "8092915e8dcd8e135b244e29e6eb23a71e9cfd326a2e7e5f08ebdad6835beb6f"},
-	{.plate = "ZZ0Z 111",
-	 .hash = "30d451137a7122d893ed2f1ab5951ae0d94f2096930d0a46c8523ddb9326f3e0"},
-	{.plate = "6HHH 666",
-	 .hash = "4d0ee335f67dc16d2b162b015484ed27bc319160d0113acfe622ccf1ca57ff1e"},
-	{.plate = "3III 222",
-	 .hash = "97088587b2cef911734c37e015a6f1ad792876178f0b1049d787ab5eae008043"},
-	{.plate = "CCC2 888",
-	 .hash = "8893ea78c2cf2a805445525c29d8c67db1bed4bfddcdd7cce9d962d08346d203"},
-	{.plate = "9XXX 999",
-	 .hash = "3c30a3e3889a4d623b5d7a7393731ebe27d72d94cc9052356226b3101829e9cf"},
-	{.plate = "DD0D 111",
-	 .hash = "0c60013afefaf7786ed4a4f0c9dc8a9aafb0a09d7ea82a425a979b88e5fe9da6"},
-	{.plate = "B3BB 111",
-	 .hash = "c014ac59faf8c149ec40b697094002651a0406956236c1559c82733464025083"},
-	{.plate = "6GGG 111",
-	 .hash = "03b7070647300d582d5bcd869ddeefe7d02bb9ca07991a25c2e9ca5c81f46fd2"},
-	{.plate = "DDD@ 111",
-	 .hash = "43a97b728f5e86d6da8a0121affa2b817b7d595d6d9d3d7b464a2dc088cb8ff0"},
-	{.plate = "UU9U 000",
-	 .hash = "6de2190f794139af7e864b630ed2284eafe0c1fa128bb3bc6693082a58745d00"},
-	{.plate = "VVV0 555",
-	 .hash = "cb5c71b5677549157b5e8900aab7b4519c513bb75b3398d7a8d93201204e2315"},
-	{.plate = "7ZZZ 333",
-	 .hash = "46acb0433971bf578b8b1e4ba8ca8ba6ee29ba6245ef10336bc64d52eda1e4db"},
-	{.plate = "8JJJ 000",
-	 .hash = "cda699d76fd1bd7af931b99cd281ed3e826566474791dbec6c1f8d8d749d6ba3"},
-	{.plate = "WW8W 666",
-	 .hash = "8fd6609146cb280c7c432d3fbe41db93c752713d8f0b30a7bf0e8c4198036799"},
-	{.plate = "R9RR 444",
-	 .hash = "d9d996991ad004c5cb3fd16b35a9d1b7c9673c797bd0423fd7ac63a5cba34244"},
-	{.plate = "ZZ6Z 000",
-	 .hash = "1e973ce0a2cb0665fec8609df219d61066248a4afa3411042c3eabffc1680732"},
-	{.plate = "RR0R 666",
-	 .hash = "284727b65fc28b7166ec6ed8dd5fdadb8417f6b154726ad61bbd168db2f35c48"},
-	{.plate = "LLL1 666",
-	 .hash = "c5f3651f2bfaeafa7f1f934d9be2f6ab19fc4abc79d341a299280b4bbf010a90"},
-	{.plate = "FF0F 222",
-	 .hash = "b3007dbd5fa0e5d0e91335613e5bec6f8ecfd013701a42538886023ac5d57eb3"},
-	{.plate = "N4NN 000",
-	 .hash = "032072892c6e1c982b70fff3500cec1145c589ec594728d029a14d71b4143647"},
-	{.plate = "HH9H 777",
-	 .hash = "0653d4c51e940d849d0a214720eb296bd812558641e1ad43dce1a2b60fcbbad2"},
-	{.plate = "JJ6J 999",
-	 .hash = "d608bd37d1145466d83a84b6200fc0d6281be746446fea41dfa0be318e03f332"},
-	{.plate = "HHH1 333",
-	 .hash = "b1e6184e75941b706f931a2250a05170084768dc7b9c79a59a0eee8f9502e5b3"},
-	{.plate = "4MMM 333",
-	 .hash = "0c3a18a001f3677c5a5e14092abdac01896111cea56b95fdd5c79fc13c4c12d0"},
-	{.plate = "RRR3 111",
-	 .hash = "5ca287b3b329f8035819ce4b8ccd6b9dcdea64d568a0f4a53289de234207d471"},
-	{.plate = "0III 666",
-	 .hash = "853ec8db1b9eb1a8e1db37019fdf2dc6975940ff74153cdcd0be50feaa0c4403"},
-	{.plate = "999 L8LL",
-	 .hash = "33a50a0451d60c6894f0e1f2348da52fd7473f203183bedcac51ba231c763126"},
-	{.plate = "000 III5",
-	 .hash = "4fb5e11bd804b5dc08e5309a958af0daf81d1eaeb7d77087318157e50ea108b5"},
-	{.plate = "666 N8NN",
-	 .hash = "2bf2a46c692198b7cf19752402c80703ff6255b2dd7883e34f3e49713ff5f2df"},
-	{.plate = "333 HH9H",
-	 .hash = "db7ff9c270ede99325b63248d3860dba04a83b976ea03d7f2d5ea9af398cdfef"},
-	{.plate = "000 4YYY",
-	 .hash = "b1f8ed488962d0a668f88c4a8f7c928f83d8cae9bc7065947f3ae8758dcdbf97"},
-	{.plate = "555 5AAA",
-	 .hash = "f674f951a6216bbe7d685e0a1dfece87a599c82965fe4eb06dc7004f4a9855b0"},
-	{.plate = "999 C3CC",
-	 .hash = "af86b30c172923a17d259f8b7a10e36a790ab1450ea3962bedfed183cf4ff2c1"},
-	{.plate = "666 Y1YY",
-	 .hash = "0a4a2b17823e2ba237ae6efe8a45fd62a23da1014e94279f5c97eadea9200599"},
-	{.plate = "999 QQ8Q",
-	 .hash = "e53eb0fe42a26b655bbd898020001c6cad2c8b49a41d75a9c1fffe6b7bb471d1"},
-	{.plate = "222 HH4H",
-	 .hash = "dbf0e92a511cff5a1365423ea428709808c8d205a8d00ad07834f75f8fa7be09"},
-	{.plate = "444 GG9G",
-	 .hash = "6f7ebc6f2a1446f7f1fdbae47241f4a69c6dd4c174a4ae70f2a7c6addff5159f"},
-	{.plate = "!11 4TTT",
-	 .hash = "f4ef8c63a11a6ab8be0735340dfc57a57873cd2e28d1f8964ae5d1f853b92864"},
-	{.plate = "222 MMM3",
-	 .hash = "4c7a87feba216f8fdda2eefbc199895adc216edf75e037bf0738542c3a00b391"},
-	{.plate = "777 RRR7",
-	 .hash = "ba66df2984a837647ff21ecf5a6c3c83566877689e6c4a0ce9d23145e1c34402"},
-	{.plate = "&33 3III",
-	 .hash = "1ec2032f4240f28fa7b7a2c1cc27ce3c72aa486c476140cdcc1a46db23c60071"},
-	{.plate = "*66 0UUU",
-	 .hash = "4c8fac6d7cdd6e7273d0f1c83c2556190d66b8462aa0e04617767bd047e4d0f5"},
-	{.plate = "222 8BBB",
-	 .hash = "dbc6bdac50ea64f9c5498ed15aba09fc79451ff1ba4de15dc5c8da5e26e9d189"},
-	{.plate = "666 NNN8",
-	 .hash = "b6a92007ec4d98e89cd8447081b8aa578e8519b63b5df4dba76b16403d900347"},
-	{.plate = "000 XXX8",
-	 .hash = "04b59498a2d10508eb48045cc6456f553c66e2c611b7a31b3ded3d9ef0bee620"},
-	{.plate = "000D9DD",
-	 .hash = "84546807d375d4553d2df4bf9e886324e4928d1e81698adab19f4d4e9217130b"},
-	{.plate = "666LL6L",
-	 .hash = "37963b8d5a4131b41ab8006c298a0b39041bf89310431ae0217d730aec7fbf9e"},
-	{.plate = "555V6VV",
-	 .hash = "67027c982f20fba38450221e415c272d9d99c4539f69fc933496579aa0a1c643"},
-	{.plate = "555 CCC5",
-	 .hash = "c8b6ee343616dae7bef9ab4b3b5092e5c0a8b362fa4b91733e70563c3865f0ee"},
-	{.plate = "888 U6UU",
-	 .hash = "f96bbac48c073069a2aa00c659bc205294e300d76c0f49b3221f23fa623ef1d8"},
-	{.plate = "999 YYY3",
-	 .hash = "d97808b6c1a6c55e5f668e9f165a3eb309a246210b66af1cddf7f8b4fabc20f1"},
-	{.plate = "66 VVV4",
-	 .hash = "dcc19a85a0a532213af9003fee157c02d9d0099bab720dd6e9009e9910557107"},
-	{.plate = "444 JJJ6",
-	 .hash = "5dd8d1ffd9f58bd90d762154a3fbb656b10d54f9d5d0d1368611c80cce11b161"},
-	{.plate = "7 3BBB",
-	 .hash = "2c18e6fe679f71a8e9dadb23512178e60610feb1653c75c5015bf30d3f9f23ba"},
-	{.plate = "000 DD",
-	 .hash = "be35455360565129b7548d640d9fbd13350269fa8930b15f91b4a23415430f06"},
-	{.plate = "333 RR4",
-	 .hash = "0a442963f8cc37f5177ac756f01e665c37569978b679da3d8bb42c2617ed21e0"},
-	{.plate = "777 HH2",
-	 .hash = "d223eaaa1644e07e0d4c1522887e336dfcc57168861c9f1bb0e105160bdb0cfb"},
-	{.plate = "111 VVV",
-	 .hash = "4b4a9a01fd51d7460f04b86ccd972fc987dbcea1c980070c7deccde454f94828"},
-	{.plate = "222 D9DD",
-	 .hash = "7b958bde037113224780e51bb22c998d6c89442a0f0c399ceefee9689aa82c55"},
-	{.plate = "333 QQQ3",
-	 .hash = "6e3a5489b8f0100f574581318386ecef412872e378119fa53f0493dc172b1524"},
-	{.plate = "000 UUU8",
-	 .hash = "6d99eb8b30d3b07a94f5d1e089d8ba2ae2cf7b40ac0fc129cffb76454a7716bc"},
-	{.plate = "888Z",
-	 .hash = "7e4f95e5c9ecb172758be421bdc15295212c10f4223cc0474cab8e870cbd9c21"},
-	{.plate = "444 2JJJ",
-	 .hash = "975f540c375228a2d70c7ae068d9bba5f467b4d070fcb8a6cafa48d09d154191"},
-	{.plate = "999 9RRR",
-	 .hash = "f04d5bcf5ada8455f283eb6ee5ea000fad631034a5048cc0e2d4efb9d1b0d1c2"},
-	{.plate = "000 5HHH",
-	 .hash = "72fd0514af84deb59932b3de7ce61c09b1d335615c418158c7f0da23b4bcc2e1"},
-	{.plate = "999GG",
-	 .hash = "7a3d5bf893ef08e269ef875d154822c5fe23c3d93b7cd1d72cee20a03d621b29"},
-	{.plate = "JJ", .hash = "a058aadeba20bd23199f4a800749166e977f9bd04c9cafd678a0d355d4a4d323"},
-	{.plate = "888 4CCC",
-	 .hash = "d8c8ac8cfc0d1ad3ed4c6c57de6d984014063954c5db754c51063c5b6ccf0f83"},
-	{.plate = "888 DDD6",
-	 .hash = "1cea2e30de4bdb6d7aa5c28ad768f5fb9eb7c4fdb87ba65688c19157125c20ab"},
-	{.plate = "111 II5I",
-	 .hash = "b9aad8a9f63e6aa6f30a40978c8f467e8dd6f781d5b56c9a1c7e6ffa34f8789f"},
-	{.plate = "888 EEE5",
-	 .hash = "563576c4dc158b050478ac63884063e1aec655d951f2f7d9a428dd01b9e903e8"},
-	{.plate = "777 YYY1",
-	 .hash = "36c670ae45121b697e0ce86dae187afe77d6716da45b0efe56aabbf7c9cf8656"},
-	{.plate = "000 QQQ4",
-	 .hash = "aee3e7cf6e307e8997a8fecf2907e80bc8565e2a54507a1887b44b616e0545c2"},
-	{.plate = "333 RRR5",
-	 .hash = "ebf43afd1aedd235ec0970de55c625f6fcd48292aafa2b85bd79c7a37aeec3cd"},
-	{.plate = "222 8PPP",
-	 .hash = "8869061ed9de52d244ec6f17b28ef93ce7da5c66e12e64753d480ccd276fc3b5"},
-	{.plate = "888 PPP2",
-	 .hash = "7829de0396faef8e51da8cec47d8fa39d0f7c1fbad11a369114c7dbb621c0d35"}};
+extern const uint32_t camera_plate_valid_count;
+extern const uint32_t camera_plate_invalid_count;
+extern const uint8_t camera_plate_packed[][CAMERA_PLATE_PACKED_SIZE];
+extern const uint8_t camera_plate_hash[][CAMERA_PLATE_HASH_SIZE];
+extern const char camera_plate_spill[];
 
 #endif // !_CAMERA_DATA_H_
@@ -0,0 +1,49 @@
+#ifndef AXLE_CLASS_H
+#define AXLE_CLASS_H
+#include <zephyr/kernel.h>
+#include "common.h"
+
+/* > Measurements a tree node can test */
+enum axle_feature {
+    AXLE_FEATURE_AXLES,     /* Axle count */
+    AXLE_FEATURE_SPACING_1, /* First to second axle, cm */
+    AXLE_FEATURE_SPACING_2, /* Second to third axle, cm */
+};
+
+/** Child value of a leaf: the class it assigns */
+#define AXLE_CLASS_LEAF(vclass) (0x80U | (uint8_t)(vclass))
+
+/* > Classification tree node: go to le if feature <= threshold, else gt */
+struct axle_class_node {
+    uint8_t feature;
+    uint8_t le;
+    uint8_t gt;
+    uint16_t threshold;
+};
+
+/**
+ * @brief Classifies a vehicle from its axles by walking the class tree
+ * (at most four comparisons).
+ * @param axle_count The number of axles.
+ * @param spacing_cm The spacings from each axle to the next, front to back;
+ *        at least CONFIG_RADAR_MAX_AXLES - 1 entries.
+ * @return The vehicle class.
+ */
+vehicle_class_t axle_classify(uint32_t axle_count, const uint16_t *spacing_cm);
+
+/**
+ * @brief Gets the short name of a vehicle class, as used by the shell and
+ * the settings keys.
+ * @param vclass The vehicle class.
+ * @return The name, "unknown" for anything out of range.
+ */
+const char *vehicle_class_name(vehicle_class_t vclass);
+
+/**
+ * @brief Looks a vehicle class up by its short name.
+ * @param name The name.
+ * @return The class, or VEHICLE_CLASS_COUNT if no class has that name.
+ */
+vehicle_class_t vehicle_class_from_name(const char *name);
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef BLOCK_RING_H
+#define BLOCK_RING_H
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/*
+ * Ring of fixed-size sample blocks between one producer (the ADC) and one
+ * consumer. Blocks never move: the producer fills the block it claimed in
+ * place and the consumer reads it in place, so a block costs two index
+ * updates and no copy. Lock-free; the caller wakes the other side.
+ */
+
+/* > Block ring; count must be a power of two */
+struct block_ring {
+    uint16_t *buf;     /* count blocks of len samples */
+    size_t len;
+    uint32_t count;
+    atomic_t head;     /* Blocks committed */
+    atomic_t tail;     /* Blocks released */
+};
+
+/**
+ * @brief Initializes an empty ring.
+ * @param r The ring.
+ * @param buf Storage for @p count blocks of @p len samples.
+ * @param len Samples per block.
+ * @param count Blocks; a power of two.
+ */
+static inline void block_ring_init(struct block_ring *r, uint16_t *buf, size_t len,
+                                   uint32_t count)
+{
+    __ASSERT((count & (count - 1U)) == 0U, "block count must be a power of two");
+    r->buf = buf;
+    r->len = len;
+    r->count = count;
+    atomic_set(&r->head, 0);
+    atomic_set(&r->tail, 0);
+}
+
+/**
+ * @brief Producer: gets the next free block.
+ * @param r The ring.
+ * @return The block, or NULL if the consumer holds every block.
+ */
+static inline uint16_t *block_ring_claim(struct block_ring *r)
+{
+    uint32_t head = (uint32_t)atomic_get(&r->head);
+
+    if (head - (uint32_t)atomic_get(&r->tail) >= r->count) {
+        return NULL;
+    }
+    return &r->buf[(head & (r->count - 1U)) * r->len];
+}
+
+/**
+ * @brief Producer: hands the claimed block, now filled, to the consumer.
+ * @param r The ring.
+ */
+static inline void block_ring_commit(struct block_ring *r)
+{
+    (void)atomic_inc(&r->head);
+}
+
+/**
+ * @brief Consumer: gets the oldest filled block.
+ * @param r The ring.
+ * @return The block, or NULL if none is filled.
+ */
+static inline const uint16_t *block_ring_peek(struct block_ring *r)
+{
+    uint32_t tail = (uint32_t)atomic_get(&r->tail);
+
+    if (tail == (uint32_t)atomic_get(&r->head)) {
+        return NULL;
+    }
+    return &r->buf[(tail & (r->count - 1U)) * r->len];
+}
+
+/**
+ * @brief Consumer: returns the block from block_ring_peek() to the producer.
+ * @param r The ring.
+ */
+static inline void block_ring_release(struct block_ring *r)
+{
+    (void)atomic_inc(&r->tail);
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/zbus/zbus.h>
+#include "plate_id.h"
 
 /* > Vehicle Types */
 typedef enum {
@@ -11,13 +12,56 @@ typedef enum {
     VEHICLE_UNKNOWN
 } vehicle_type_t;
 
+/* > Vehicle Classes, from the axle count and spacings, refined by the loop signature */
+typedef enum {
+    VEHICLE_CLASS_UNKNOWN,
+    VEHICLE_CLASS_MOTORCYCLE,
+    VEHICLE_CLASS_CAR,
+    VEHICLE_CLASS_CAR_TRAILER,
+    VEHICLE_CLASS_VAN,         /* Two axles like a car; told apart by the loop */
+    VEHICLE_CLASS_BUS,
+    VEHICLE_CLASS_TRUCK_2,
+    VEHICLE_CLASS_TRUCK_3,
+    VEHICLE_CLASS_TRUCK_4,
+    VEHICLE_CLASS_TRUCK_5PLUS, /* Five axles or more */
+    VEHICLE_CLASS_COUNT
+} vehicle_class_t;
+
+/**
+ * @brief Gets the light/heavy type of a vehicle class.
+ * @param vclass The vehicle class.
+ * @return VEHICLE_LIGHT up to a van, VEHICLE_HEAVY for buses
+ *         and trucks, VEHICLE_UNKNOWN otherwise.
+ */
+static inline vehicle_type_t vehicle_class_type(vehicle_class_t vclass)
+{
+    if (vclass == VEHICLE_CLASS_UNKNOWN || vclass >= VEHICLE_CLASS_COUNT) {
+        return VEHICLE_UNKNOWN;
+    }
+    return (vclass <= VEHICLE_CLASS_VAN) ? VEHICLE_LIGHT : VEHICLE_HEAVY;
+}
+
 /* > Data from Sensor Thread to Main Thread */
 typedef struct {
     int64_t timestamp_start;
     int64_t timestamp_end;
+    int64_t timestamp_last_axle; /* Last axle over the start sensor */
     uint32_t duration_ms;
     uint32_t axle_count;
     vehicle_type_t type;
+    vehicle_class_t vclass;
+    /* Distance from each axle to the next, front to back; 0 past the last */
+    uint16_t axle_spacing_cm[CONFIG_RADAR_MAX_AXLES - 1];
+    /* Loop-array fit (CONFIG_RADAR_SPEED_FIT); speed 0 when not fitted */
+    uint32_t fit_speed_ckmh;
+    int32_t fit_accel_mm_s2;
+    uint8_t fit_confidence;
+    uint8_t lane;
+    /* Weigh-in-motion (CONFIG_RADAR_WIM), front to back; gross 0 when not weighed */
+    uint16_t axle_weight_kg[CONFIG_RADAR_MAX_AXLES];
+    uint32_t gross_weight_kg;
+    /* Doppler radar (CONFIG_RADAR_DOPPLER); 0 when no target stood out */
+    uint32_t doppler_speed_ckmh;
 } sensor_data_t;
 
 /* > Display Status */
@@ -32,8 +76,9 @@ typedef struct {
     uint32_t speed_kmh;
     uint32_t limit_kmh;
     vehicle_type_t type;
+    vehicle_class_t vclass;
     display_status_t status;
-    char plate[10];
+    plate_id_t plate;
     uint32_t axle_count;
     uint32_t warning_kmh;
 } display_data_t;
@@ -46,7 +91,7 @@ typedef struct {
 
 /* > ZBUS: Camera Result */
 typedef struct {
-    char plate[10];
+    plate_id_t plate;
     bool valid_read; // If the camera successfully read a plate
 } camera_result_t;
 
@@ -67,6 +112,14 @@ extern struct k_msgq display_msgq;
  */
 bool validate_plate(const char *plate);
 
+/**
+ * @brief Validates a Mercosul plate and returns the country it matched.
+ * Separators (' ', '-', '_') are ignored and letters are case-insensitive.
+ * @param plate The plate number to validate.
+ * @return The matched country, PLATE_COUNTRY_NONE if the plate is invalid.
+ */
+plate_country_t validate_plate_country(const char *plate);
+
 /**
  * @brief Calculates the Speed in km/h based on the distance and duration.
  * @param distance_mm The distance in millimeters.
@@ -0,0 +1,105 @@
+#ifndef DECISION_TABLE_H
+#define DECISION_TABLE_H
+#include <zephyr/kernel.h>
+#include "common.h"
+
+/*
+ * Enforcement decision precomputed from the policy. Short transits (fast
+ * vehicles) map straight to their speed; longer ones binary-search the
+ * duration at which each low speed ends. The status is two comparisons
+ * against the class thresholds. Either way the per-vehicle path has no
+ * division, which Cortex-M0-class cores do in software. Results are
+ * identical to calculate_speed() and enforcement_decide().
+ */
+
+/** Durations, in ms, decided by a single direct lookup */
+#define DECISION_DIRECT_MS CONFIG_RADAR_DECISION_DIRECT_MS
+/** Longest sensor distance a table can cover */
+#define DECISION_MAX_DISTANCE_MM 20000U
+/** Speeds below the direct range: calculate_speed(max distance, DIRECT_MS) */
+#define DECISION_TAIL_SPEEDS \
+    ((36U * DECISION_MAX_DISTANCE_MM) / (10U * DECISION_DIRECT_MS) + 1U)
+
+/** One set of limits per vehicle class */
+#define DECISION_CLASSES VEHICLE_CLASS_COUNT
+
+/* > Limits of one vehicle class */
+struct decision_class {
+    uint32_t limit_kmh;
+    uint32_t warning_kmh;
+};
+
+/* > Decision table for one sensor distance and set of limits */
+struct decision_table {
+    /* Speed by duration */
+    uint32_t direct[DECISION_DIRECT_MS];
+    /* tail_max_ms[s]: longest duration measured as s km/h or more */
+    uint32_t tail_max_ms[DECISION_TAIL_SPEEDS];
+    uint32_t tail_speeds;   /* Valid entries in tail_max_ms, from 1 */
+    struct decision_class classes[DECISION_CLASSES];
+};
+
+/**
+ * @brief Builds a decision table.
+ * @param table The table to fill.
+ * @param distance_mm The sensor distance, at most DECISION_MAX_DISTANCE_MM.
+ * @param classes The limits of each class, indexed by vehicle_class_t.
+ */
+void decision_table_build(struct decision_table *table, uint32_t distance_mm,
+                          const struct decision_class classes[DECISION_CLASSES]);
+
+/**
+ * @brief Classifies a speed against the limits of a class.
+ * @param c The class.
+ * @param speed_kmh The speed.
+ * @return The status, as enforcement_decide() returns it.
+ */
+static inline display_status_t decision_status(const struct decision_class *c,
+                                               uint32_t speed_kmh)
+{
+    if (speed_kmh > c->limit_kmh) {
+        return STATUS_INFRACTION;
+    }
+    return (speed_kmh >= c->warning_kmh) ? STATUS_WARNING : STATUS_NORMAL;
+}
+
+/**
+ * @brief Decides a vehicle from its transit duration.
+ * @param table The table.
+ * @param duration_ms The time between the start and end sensors.
+ * @param vclass The vehicle class.
+ * @param speed_kmh Receives the speed, as calculate_speed() computes it.
+ * @param limit_kmh Receives the limit of the vehicle's class.
+ * @return The status, as enforcement_decide() returns it.
+ */
+static inline display_status_t decision_lookup(const struct decision_table *table,
+                                               uint32_t duration_ms, vehicle_class_t vclass,
+                                               uint32_t *speed_kmh, uint32_t *limit_kmh)
+{
+    const struct decision_class *c =
+        &table->classes[(vclass < DECISION_CLASSES) ? vclass : VEHICLE_CLASS_UNKNOWN];
+
+    *limit_kmh = c->limit_kmh;
+    if (duration_ms < DECISION_DIRECT_MS) {
+        *speed_kmh = table->direct[duration_ms];
+        return decision_status(c, *speed_kmh);
+    }
+
+    /* Largest s with duration_ms <= tail_max_ms[s]; tail_max_ms decreases */
+    uint32_t lo = 0;
+    uint32_t hi = table->tail_speeds;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi + 1U) / 2U;
+
+        if (duration_ms <= table->tail_max_ms[mid]) {
+            lo = mid;
+        } else {
+            hi = mid - 1U;
+        }
+    }
+    *speed_kmh = lo;
+    return decision_status(c, lo);
+}
+
+#endif
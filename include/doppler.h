@@ -0,0 +1,86 @@
+#ifndef DOPPLER_H
+#define DOPPLER_H
+#include <zephyr/kernel.h>
+
+/*
+ * Doppler speed from a frame of IQ samples of a CW radar. The frame is
+ * windowed (Hann), transformed by a fixed-point radix-2 FFT and the
+ * strongest bin past the clutter around DC is interpolated between its
+ * neighbours, so the speed resolves well below one bin. Positive
+ * frequencies are approaching vehicles. Tables are built once per frame
+ * size; a frame costs no allocation and no floating point.
+ */
+
+/** Largest frame, in samples */
+#define DOPPLER_MAX_POINTS 1024U
+
+/* > One complex sample or bin, Q15 */
+struct doppler_iq {
+    int16_t i;
+    int16_t q;
+};
+
+/* > Speed read from one frame */
+struct doppler_result {
+    uint32_t speed_ckmh;  /* 0.01 km/h */
+    uint32_t freq_hz_q8;  /* Interpolated Doppler shift, Q8 Hz */
+    uint32_t snr;         /* Peak bin power over the mean of the others */
+    bool approaching;
+};
+
+/* > Transform of one frame size, with its work buffer */
+struct doppler {
+    uint16_t points;
+    uint8_t log2_points;
+    uint16_t min_bin;        /* Bins nearer DC are clutter */
+    uint32_t sample_rate_hz;
+    uint64_t ckmh_per_hz_q24; /* Speed of 1 Hz of shift, Q24 ckm/h */
+    int16_t window[DOPPLER_MAX_POINTS];
+    struct doppler_iq twiddle[DOPPLER_MAX_POINTS / 2U]; /* e^(-2 pi i k / points) */
+    struct doppler_iq work[DOPPLER_MAX_POINTS];
+};
+
+/**
+ * @brief Builds the window and twiddle tables of a frame size.
+ * @param d The transform.
+ * @param points Frame size, a power of two from 16 to DOPPLER_MAX_POINTS.
+ * @param sample_rate_hz IQ sampling rate.
+ * @param carrier_mhz Radar carrier frequency.
+ * @param min_kmh Slowest speed reported; slower bins are clutter.
+ * @return 0 on success, -EINVAL for an unsupported size or rate.
+ */
+int doppler_init(struct doppler *d, uint16_t points, uint32_t sample_rate_hz,
+                 uint32_t carrier_mhz, uint32_t min_kmh);
+
+/**
+ * @brief In-place FFT, scaled by 1/points so it cannot overflow.
+ * @param d The transform.
+ * @param x The samples in, the bins out.
+ */
+void doppler_fft(const struct doppler *d, struct doppler_iq *x);
+
+/**
+ * @brief Reads the speed of the strongest target in a frame.
+ * @param d The transform; its work buffer is overwritten.
+ * @param frame d->points IQ samples.
+ * @param min_snr Weakest peak accepted, as bin power over the mean of the others.
+ * @param out Receives the speed.
+ * @return 0 on success, -ENODATA if no bin past the clutter stands out.
+ */
+int doppler_measure(struct doppler *d, const struct doppler_iq *frame, uint32_t min_snr,
+                    struct doppler_result *out);
+
+/**
+ * @brief Fuses the Doppler speed with the loop speed of the same vehicle.
+ * @param loop_ckmh Loop speed, from the transit or the loop fit; 0 if none.
+ * @param doppler_ckmh Doppler speed; 0 if none.
+ * @param max_disagree_percent Largest difference, in percent of the loop
+ *        speed, for the two to be the same vehicle.
+ * @param doppler_weight_percent Weight of the Doppler speed in the fusion.
+ * @return The fused speed; the loop speed alone if they disagree, as the
+ *         beam may have seen another vehicle.
+ */
+uint32_t doppler_fuse_ckmh(uint32_t loop_ckmh, uint32_t doppler_ckmh,
+                           uint32_t max_disagree_percent, uint32_t doppler_weight_percent);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef DOPPLER_SYNTH_H
+#define DOPPLER_SYNTH_H
+#include <zephyr/kernel.h>
+#include <math.h>
+#include "doppler.h"
+
+/*
+ * Synthetic CW radar returns, for the traffic simulator and the tests: one
+ * target as a complex tone, with the DC offset of the mixer and uniform
+ * noise. An approaching target turns the phase forward.
+ */
+
+/**
+ * @brief Doppler shift of a target.
+ * @param kmh Radial speed; negative when receding.
+ * @param carrier_mhz Radar carrier frequency.
+ * @return The shift, in Hz.
+ */
+static inline double doppler_synth_hz(double kmh, uint32_t carrier_mhz)
+{
+    return 2.0 * (kmh / 3.6) * carrier_mhz * 1e6 / 299792458.0;
+}
+
+/**
+ * @brief Uniform noise from a xorshift state.
+ * @param state Nonzero state; advanced.
+ * @param noise Largest magnitude.
+ * @return A value in [-noise, noise].
+ */
+static inline int32_t doppler_synth_noise(uint32_t *state, uint16_t noise)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (int32_t)(*state % (2U * noise + 1U)) - noise;
+}
+
+/**
+ * @brief Samples one target.
+ * @param frame Receives the samples.
+ * @param n Number of samples.
+ * @param shift_hz Doppler shift; negative when receding.
+ * @param sample_rate_hz IQ sampling rate.
+ * @param amplitude Tone amplitude, in counts.
+ * @param dc Offset added to both channels.
+ * @param noise Largest noise added to each channel, in counts.
+ * @param state Noise state, nonzero; advanced.
+ */
+static inline void doppler_synth_frame(struct doppler_iq *frame, size_t n, double shift_hz,
+                                       uint32_t sample_rate_hz, int16_t amplitude, int16_t dc,
+                                       uint16_t noise, uint32_t *state)
+{
+    for (size_t i = 0; i < n; i++) {
+        double phase = 2.0 * M_PI * shift_hz * (double)i / sample_rate_hz + 0.7;
+        int32_t ni = doppler_synth_noise(state, noise);
+        int32_t nq = doppler_synth_noise(state, noise);
+
+        frame[i].i = (int16_t)CLAMP(lround(amplitude * cos(phase)) + dc + ni, INT16_MIN,
+                                    INT16_MAX);
+        frame[i].q = (int16_t)CLAMP(lround(amplitude * sin(phase)) + dc + nq, INT16_MIN,
+                                    INT16_MAX);
+    }
+}
+
+#endif
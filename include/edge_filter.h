@@ -0,0 +1,123 @@
+#ifndef EDGE_FILTER_H
+#define EDGE_FILTER_H
+#include <zephyr/kernel.h>
+
+/*
+ * Debounce of one sensor input. Loops and piezo strips ring and chatter:
+ * a pulse counts as an axle only if it lasts at least the minimum width,
+ * and pulses starting within the refractory period of the last accepted
+ * one are dropped. Works on 32-bit cycle timestamps taken in the GPIO ISR,
+ * which every timer driver provides; only differences are used, so the
+ * counter may wrap as long as a refractory period fits in it. Every
+ * rejection is counted instead of logged.
+ */
+
+/* > Filter counters */
+struct edge_filter_stats {
+    uint32_t accepted;
+    uint32_t short_pulses; /* Narrower than the minimum width */
+    uint32_t refractory;   /* Started too soon after an accepted pulse */
+};
+
+enum edge_filter_state {
+    EDGE_FILTER_LOW,
+    EDGE_FILTER_HIGH,   /* Measuring a pulse that started at rise_cyc */
+    EDGE_FILTER_MASKED, /* Ignoring a pulse rejected as refractory */
+};
+
+/* > Edge filter of one input */
+struct edge_filter {
+    uint32_t min_pulse_cyc;
+    uint32_t refractory_cyc;
+    uint32_t rise_cyc;   /* Start of the current or last accepted pulse */
+    uint32_t accept_cyc; /* Start of the last accepted pulse */
+    enum edge_filter_state state;
+    bool accepted_any;
+    struct edge_filter_stats stats;
+};
+
+/**
+ * @brief Initializes a filter, counters cleared.
+ * @param f The filter.
+ * @param min_pulse_cyc Shortest pulse accepted; 0 accepts on the rising edge.
+ * @param refractory_cyc Dead time after the start of an accepted pulse.
+ */
+static inline void edge_filter_init(struct edge_filter *f, uint32_t min_pulse_cyc,
+                                    uint32_t refractory_cyc)
+{
+    *f = (struct edge_filter){
+        .min_pulse_cyc = min_pulse_cyc,
+        .refractory_cyc = refractory_cyc,
+        .state = EDGE_FILTER_LOW,
+    };
+}
+
+/**
+ * @brief Feeds one edge to the filter.
+ * @param f The filter.
+ * @param level The input level after the edge.
+ * @param cyc The cycle count when the edge was seen.
+ * @return True if this edge completes an accepted pulse; the pulse started
+ *         at f->rise_cyc.
+ */
+static inline bool edge_filter_edge(struct edge_filter *f, bool level, uint32_t cyc)
+{
+    if (level) {
+        if (f->state == EDGE_FILTER_MASKED) {
+            return false;
+        }
+        if (f->accepted_any && cyc - f->accept_cyc < f->refractory_cyc) {
+            f->state = EDGE_FILTER_MASKED;
+            f->stats.refractory++;
+            return false;
+        }
+        /* A rise while high means the fall was missed: restart the pulse */
+        f->state = EDGE_FILTER_HIGH;
+        f->rise_cyc = cyc;
+        if (f->min_pulse_cyc > 0U) {
+            return false;
+        }
+    } else {
+        enum edge_filter_state prev = f->state;
+
+        f->state = EDGE_FILTER_LOW;
+        if (prev == EDGE_FILTER_MASKED || (prev == EDGE_FILTER_HIGH && f->min_pulse_cyc == 0U)) {
+            return false;
+        }
+        /* A fall with no rise seen is a pulse too short for the ISR */
+        if (prev == EDGE_FILTER_LOW || cyc - f->rise_cyc < f->min_pulse_cyc) {
+            f->stats.short_pulses++;
+            return false;
+        }
+    }
+
+    f->accept_cyc = f->rise_cyc;
+    f->accepted_any = true;
+    f->stats.accepted++;
+    return true;
+}
+
+/* > Noise counters of a lane's sensor pair */
+struct sensor_noise {
+    struct edge_filter_stats start;
+    struct edge_filter_stats end;
+};
+
+/**
+ * @brief Sets the debounce of a lane's sensors; counters are kept.
+ * @param lane The lane.
+ * @param min_pulse_us Shortest pulse accepted; 0 accepts on the rising edge.
+ * @param refractory_us Dead time after the start of an accepted pulse.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int sensor_filter_configure(uint8_t lane, uint32_t min_pulse_us, uint32_t refractory_us);
+
+/**
+ * @brief Reads the noise counters of a lane's sensors.
+ * @param lane The lane.
+ * @param out Receives the counters.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int sensor_noise_get(uint8_t lane, struct sensor_noise *out);
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef ENFORCEMENT_H
+#define ENFORCEMENT_H
+
+#include <stdint.h>
+#include "common.h"
+#include "policy.h"
+
+struct msg_camera_evt;
+
+/* > Enforcement Telemetry Counters */
+struct enforcement_counters {
+    uint64_t light;
+    uint64_t heavy;
+    uint64_t normal;
+    uint64_t warning;
+    uint64_t infraction;
+    uint64_t hotlist_hits;
+};
+
+/**
+ * @brief Classifies a measured speed against the limit of its vehicle class.
+ * @param policy The pinned enforcement policy.
+ * @param speed_kmh The measured speed.
+ * @param vclass The vehicle class.
+ * @param limit_kmh Receives the limit that applies to @p vclass.
+ * @return STATUS_INFRACTION above the limit, STATUS_WARNING from the warning
+ *         threshold up, STATUS_NORMAL otherwise.
+ */
+static inline display_status_t enforcement_decide(const struct radar_policy *policy,
+                                                  uint32_t speed_kmh, vehicle_class_t vclass,
+                                                  uint32_t *limit_kmh)
+{
+    uint32_t limit = policy_limit_kmh(policy, vclass);
+
+    *limit_kmh = limit;
+    if (speed_kmh > limit) {
+        return STATUS_INFRACTION;
+    }
+    if (speed_kmh >= policy_warning_kmh(policy, vclass)) {
+        return STATUS_WARNING;
+    }
+    return STATUS_NORMAL;
+}
+
+/**
+ * @brief Subscribes to the camera events, loads the enforcement policy and
+ * initializes the per-vehicle consumers (hotlist, speed statistics,
+ * time-series store, lane pool).
+ * Must run once before the enforcement thread handles any vehicle.
+ */
+void enforcement_init(void);
+
+/**
+ * @brief Handles one vehicle measured by the sensor pair: computes its speed,
+ * updates the counters, refreshes the display and requests a capture when
+ * the vehicle is in infraction (or always, under section control).
+ * Runs on the pool workers under CONFIG_RADAR_ENFORCEMENT_POOL, several
+ * lanes at once.
+ * @param s_data The measurement.
+ */
+void enforcement_handle_measurement(const sensor_data_t *s_data);
+
+/**
+ * @brief Handles a camera capture result: verifies the plate, records the
+ * infraction and checks the hotlist.
+ * @param evt The camera event.
+ */
+void enforcement_handle_camera(const struct msg_camera_evt *evt);
+
+/**
+ * @brief Reads the enforcement telemetry counters.
+ * @param out Receives the counters.
+ */
+void enforcement_get_counters(struct enforcement_counters *out);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef FLOW_METRICS_H
+#define FLOW_METRICS_H
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+
+/* > Loop-detector metrics of one lane over one interval */
+struct flow_snapshot {
+    int64_t start_ms;
+    uint32_t interval_ms;
+    uint8_t lane;
+    uint32_t volume;             /* Vehicles in the interval */
+    uint32_t flow_veh_h;         /* Volume scaled to vehicles per hour */
+    uint32_t mean_headway_ms;    /* Front to front, 0 without a pair */
+    uint32_t mean_gap_ms;        /* Rear to front, 0 without a pair */
+    uint16_t occupancy_permille; /* Time the start sensor was occupied */
+};
+
+/**
+ * @brief ZBUS channel carrying interval snapshots (struct flow_snapshot),
+ * one message per lane per interval.
+ */
+ZBUS_CHAN_DECLARE(flow_metrics_chan);
+
+/**
+ * @brief Clears every lane. No writer may run concurrently.
+ * @param now_ms Start of the first interval.
+ */
+void flow_metrics_reset(int64_t now_ms);
+
+/**
+ * @brief Accounts a vehicle crossing the start sensor.
+ * Lock-free and ISR-safe; each lane must have a single writer.
+ * @param lane The lane, below CONFIG_RADAR_LANE_COUNT.
+ * @param front_ms First axle over the start sensor.
+ * @param rear_ms Last axle over the start sensor.
+ * @return 0 on success, -EINVAL for an unknown lane or reversed times.
+ */
+int flow_metrics_vehicle(uint8_t lane, int64_t front_ms, int64_t rear_ms);
+
+/**
+ * @brief Takes a lane's metrics since the previous snapshot and restarts them.
+ * @param lane The lane.
+ * @param now_ms The end of the interval.
+ * @param out Receives the snapshot.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int flow_metrics_snapshot(uint8_t lane, int64_t now_ms, struct flow_snapshot *out);
+
+/**
+ * @brief Snapshots every lane and publishes the results on flow_metrics_chan.
+ * @param now_ms The end of the interval.
+ */
+void flow_metrics_publish(int64_t now_ms);
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef HOTLIST_H
+#define HOTLIST_H
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include "plate_id.h"
+
+/*
+ * Hotlist blob layout (little-endian):
+ *   struct hotlist_header
+ *   Bloom filter, 2^bloom_log2_bits bits
+ *   count plates packed with plate_id_pack40(), strictly increasing
+ */
+#define HOTLIST_MAGIC                0x4C544F48U /* "HOTL" */
+#define HOTLIST_VERSION              1U
+#define HOTLIST_BLOOM_BITS_PER_ENTRY 10U /* ~1% false positives with 7 hashes */
+#define HOTLIST_BLOOM_HASHES         7U
+#define HOTLIST_BLOOM_MIN_LOG2_BITS  6U
+#define HOTLIST_BLOOM_MAX_LOG2_BITS  31U
+
+/* > Hotlist blob header */
+struct hotlist_header {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t bloom_hashes;
+    uint8_t bloom_log2_bits;
+    uint32_t count;
+    uint32_t sequence; /* Higher wins when two flash partitions hold a list */
+} __packed;
+
+/**
+ * @brief Upper bound of the blob size produced by hotlist_build() for n plates.
+ */
+#define HOTLIST_BLOB_MAX_SIZE(n)                                                   \
+    (sizeof(struct hotlist_header) + 8U +                                          \
+     ((size_t)(n) * HOTLIST_BLOOM_BITS_PER_ENTRY * 2U) / 8U +                      \
+     (size_t)(n) * PLATE_ID_PACKED_SIZE)
+
+/* > Alert published on hotlist_alert_chan when a read matches the hotlist */
+struct hotlist_alert {
+    plate_id_t plate;
+    int64_t timestamp_ms;
+    uint32_t speed_kmh;
+};
+
+/**
+ * @brief ZBUS channel carrying hotlist alerts (struct hotlist_alert).
+ */
+ZBUS_CHAN_DECLARE(hotlist_alert_chan);
+
+/**
+ * @brief Builds a hotlist blob from a set of plates.
+ * @param ids The plates; sorted and de-duplicated in place.
+ * @param n The number of plates.
+ * @param sequence The sequence number stored in the header.
+ * @param buf The output buffer (HOTLIST_BLOB_MAX_SIZE(n) bytes is enough).
+ * @param buf_len The size of the output buffer.
+ * @param out_len Receives the size of the blob.
+ * @return 0 on success, -EINVAL on bad arguments, -ENOMEM if buf is too small.
+ */
+int hotlist_build(plate_id_t *ids, size_t n, uint32_t sequence, uint8_t *buf, size_t buf_len,
+                  size_t *out_len);
+
+/**
+ * @brief Validates a hotlist blob and swaps it in atomically.
+ * Lookups running during the swap finish on the previous list. When this
+ * returns, the previously loaded blob is no longer referenced and may be
+ * freed. The blob itself is used in place and must outlive the list.
+ * @param blob The hotlist blob.
+ * @param len The size of the blob.
+ * @return 0 on success, -EINVAL if the blob is malformed.
+ */
+int hotlist_load(const void *blob, size_t len);
+
+/**
+ * @brief Loads (or reloads) the hotlist from its default storage.
+ * native_sim memory-maps CONFIG_RADAR_HOTLIST_FILE; other targets use the
+ * memory-mapped hotlist_partition / hotlist_b_partition flash partitions,
+ * taking the valid one with the highest sequence number.
+ * @return 0 on success, negative errno otherwise.
+ */
+int hotlist_load_default(void);
+
+/**
+ * @brief Checks whether a plate is on the hotlist.
+ * Never blocks: a Bloom filter answers most negatives, a binary search over
+ * the packed plate array confirms hits.
+ * @param id The plate to check.
+ * @return True if the plate is on the hotlist.
+ */
+bool hotlist_contains(plate_id_t id);
+
+/**
+ * @brief Gets the number of plates in the loaded hotlist.
+ * @return The number of plates, 0 if no list is loaded.
+ */
+size_t hotlist_count(void);
+
+#endif
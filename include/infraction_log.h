@@ -2,6 +2,7 @@
 #define INFRACTION_LOG_H
 #include <zephyr/kernel.h>
 #include "common.h"
+#include "sha256.h"
 
 /* > Infraction Record */
 typedef struct infraction_record {
@@ -10,9 +11,22 @@ typedef struct infraction_record {
     uint32_t speed_kmh;
     uint32_t limit_kmh;
     bool valid_read;
-    char plate[10];
+    uint8_t vclass; /* vehicle_class_t; fits in the padding before plate */
+    plate_id_t plate;
+    uint32_t seq; /* Assigned by infraction_log_add(), counts every record */
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+    /* SHA-256(previous digest || serialized record); all zero before chaining */
+    uint8_t digest[SHA256_DIGEST_SIZE];
+#endif
 } infraction_record_t;
 
+/* > Signed chain checkpoint: covers records 0..count-1 */
+struct infraction_log_checkpoint {
+    uint32_t count;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    uint8_t mac[SHA256_DIGEST_SIZE]; /* HMAC-SHA256(key, count || digest) */
+};
+
 /**
  * @brief Adds an infraction record to the log.
  * @param record The infraction record to add.
@@ -34,6 +48,61 @@ size_t infraction_log_get_recent(size_t max_records, infraction_record_t *out_re
  * @param valid_reads The count of valid reads.
  * @param invalid_reads The count of invalid reads.
  */
-void infraction_log_get_counters(uint32_t *light_count, uint32_t *heavy_count, uint32_t *valid_reads, uint32_t *invalid_reads);
+void infraction_log_get_counters(uint64_t *light_count, uint64_t *heavy_count, uint64_t *valid_reads, uint64_t *invalid_reads);
+
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+/**
+ * @brief Chains every pending record in the caller's context.
+ * Normally the low-priority chain worker does this; call it before
+ * exporting or verifying the log to get a complete chain.
+ */
+void infraction_log_chain_sync(void);
+
+/**
+ * @brief Computes the chain digest of a record.
+ * @param prev The digest of the previous record (all zero for seq 0).
+ * @param record The record.
+ * @param digest Receives the digest.
+ */
+void infraction_log_chain_digest(const uint8_t prev[SHA256_DIGEST_SIZE],
+                                 const infraction_record_t *record,
+                                 uint8_t digest[SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Re-walks a chain segment.
+ * @param prev The digest preceding the segment (all zero if it starts at seq 0).
+ * @param records The records, oldest first, with consecutive sequence numbers.
+ * @param count The number of records.
+ * @param bad_index If not NULL, receives the index of the first bad record.
+ * @return 0 if the segment is intact, -EBADMSG otherwise.
+ */
+int infraction_log_chain_verify(const uint8_t prev[SHA256_DIGEST_SIZE],
+                                const infraction_record_t *records, size_t count,
+                                size_t *bad_index);
+
+/**
+ * @brief Copies the chained records still in the log and verifies them.
+ * When the oldest copied record is not the first ever, it anchors the walk.
+ * @param buf Scratch buffer for the records.
+ * @param max_records The size of the buffer.
+ * @param bad_index If not NULL, receives the index in buf of the first bad record.
+ * @return The number of records copied on success, -EBADMSG if the chain is broken.
+ */
+int infraction_log_verify_recent(infraction_record_t *buf, size_t max_records, size_t *bad_index);
+
+/**
+ * @brief Gets the latest signed checkpoint.
+ * @param out Receives the checkpoint.
+ * @return 0 on success, -ENOENT if no checkpoint was signed yet.
+ */
+int infraction_log_get_checkpoint(struct infraction_log_checkpoint *out);
+
+/**
+ * @brief Checks the signature of a checkpoint.
+ * @param checkpoint The checkpoint.
+ * @return True if the MAC matches.
+ */
+bool infraction_log_checkpoint_verify(const struct infraction_log_checkpoint *checkpoint);
+#endif
 
 #endif
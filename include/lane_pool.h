@@ -0,0 +1,56 @@
+#ifndef LANE_POOL_H
+#define LANE_POOL_H
+#include <zephyr/kernel.h>
+#include "common.h"
+
+/** Priority of the pool workers, just below the enforcement thread. */
+#define LANE_POOL_PRIORITY 1
+
+/**
+ * @brief Handles one measurement on a pool worker.
+ * Measurements of one lane are handled one at a time, in submission order;
+ * different lanes run concurrently.
+ * @param s_data The measurement.
+ */
+typedef void (*lane_pool_handler_t)(const sensor_data_t *s_data);
+
+/* > Pool Statistics */
+struct lane_pool_stats {
+    uint32_t submitted;
+    uint32_t processed;
+    uint32_t steals;    /* Lanes run by a worker other than their home */
+};
+
+/**
+ * @brief Starts the CONFIG_RADAR_ENFORCEMENT_WORKERS workers.
+ * Lane l is homed on worker l % CONFIG_RADAR_ENFORCEMENT_WORKERS; on SMP
+ * builds with CONFIG_RADAR_SMP_PINNING worker w runs on the CPU after
+ * CONFIG_RADAR_CPU_CONTROL, w CPUs over.
+ * @param handler Called for every submitted measurement.
+ * @return 0 on success, -EALREADY if the pool is already running.
+ */
+int lane_pool_init(lane_pool_handler_t handler);
+
+/**
+ * @brief Queues a measurement on its lane and wakes the lane's home worker
+ * (or an idle one, when the home worker is busy, to steal the lane).
+ * Single producer: only one thread may submit.
+ * @param s_data The measurement; its lane selects the queue.
+ * @return 0 on success, -EINVAL for an unknown lane, -ENOBUFS if the lane
+ *         queue is full.
+ */
+int lane_pool_submit(const sensor_data_t *s_data);
+
+/**
+ * @brief Tells whether every submitted measurement has been handled.
+ * @return true when the pool is idle.
+ */
+bool lane_pool_idle(void);
+
+/**
+ * @brief Reads the pool statistics.
+ * @param out Receives the statistics.
+ */
+void lane_pool_get_stats(struct lane_pool_stats *out);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef LOOP_ADC_H
+#define LOOP_ADC_H
+#include <zephyr/kernel.h>
+#include "loop_signature.h"
+
+/*
+ * ADC front end of the inductive loops. A sampler thread reads one block
+ * of CONFIG_RADAR_LOOP_ADC_BLOCK samples per lane into one half of a
+ * double buffer while a processor thread runs the signature detectors
+ * over the other half, as a DMA ping-pong would. The last vehicle of each
+ * lane waits there until the sensor thread takes it.
+ */
+
+/* > Sampler counters */
+struct loop_adc_stats {
+    uint32_t blocks;   /* Blocks processed */
+    uint32_t overruns; /* Blocks the sampler had to wait for */
+    uint32_t vehicles; /* Signatures closed, every lane */
+};
+
+/**
+ * @brief Takes the last signature of a lane, if it is recent.
+ * @param lane The lane.
+ * @param since_ms Oldest end time accepted, in uptime ms.
+ * @param out Receives the signature.
+ * @return 0 on success, -ENODATA if the lane has no loop or no new
+ *         signature ended at or after @p since_ms.
+ */
+int loop_adc_take(uint8_t lane, int64_t since_ms, struct loop_signature *out);
+
+/**
+ * @brief Gets the sampler counters.
+ * @param out Receives the counters.
+ */
+void loop_adc_stats_get(struct loop_adc_stats *out);
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef LOOP_SIGNATURE_H
+#define LOOP_SIGNATURE_H
+#include <zephyr/kernel.h>
+#include "common.h"
+
+/*
+ * Vehicle signature of an inductive loop, sampled by ADC. The detector
+ * tracks the idle level of the loop, opens a vehicle when the signal
+ * rises a threshold above it and closes it once the signal stayed low for
+ * a hold time, accumulating the features on the way: one pass, fixed
+ * point, a few operations per sample. With the speed from the sensors the
+ * features become the magnetic length and the fill of the profile, and a
+ * small tree tells a van from a car.
+ */
+
+/** Samples between the two ends of a slope measurement */
+#define LOOP_SIG_SLOPE_LAG 4U
+
+/* > Features of one vehicle */
+struct loop_signature {
+    uint64_t end_sample;   /* Last sample over the off threshold */
+    uint32_t samples;      /* Occupancy, onset to end_sample */
+    uint32_t area;         /* Sum of the signal over the occupancy */
+    uint16_t peak;         /* Largest signal, counts above the idle level */
+    uint16_t rise;         /* Steepest rise over LOOP_SIG_SLOPE_LAG samples */
+    uint16_t fall;         /* Steepest fall, likewise */
+};
+
+enum loop_sig_state {
+    LOOP_SIG_IDLE,
+    LOOP_SIG_VEHICLE,
+};
+
+/* > Detector of one loop */
+struct loop_sig_detector {
+    uint32_t baseline_q8;  /* Idle level, Q8, followed while idle */
+    uint16_t on_counts;    /* Onset, above the idle level */
+    uint16_t off_counts;   /* End, once below for hold samples */
+    uint16_t hold;
+    uint16_t lag[LOOP_SIG_SLOPE_LAG]; /* Last signal values, for the slopes */
+    uint64_t sample;       /* Samples fed so far */
+    uint32_t below;        /* Consecutive samples under off_counts */
+    uint32_t below_area;   /* Their signal, taken back if the vehicle ends */
+    enum loop_sig_state state;
+    bool primed;           /* Baseline taken from the first sample */
+    struct loop_signature cur;
+};
+
+/**
+ * @brief Called for each vehicle the detector closes.
+ * @param sig The signature, valid during the call.
+ * @param arg The argument given to loop_signature_feed().
+ */
+typedef void (*loop_signature_cb_t)(const struct loop_signature *sig, void *arg);
+
+/**
+ * @brief Initializes an idle detector; the first sample sets the idle level.
+ * @param det The detector.
+ * @param on_counts Rise over the idle level that opens a vehicle.
+ * @param hold Samples under half of @p on_counts that close it.
+ */
+void loop_signature_init(struct loop_sig_detector *det, uint16_t on_counts, uint16_t hold);
+
+/**
+ * @brief Feeds a block of samples.
+ * @param det The detector.
+ * @param samples The samples of this loop, @p stride apart (interleaved lanes).
+ * @param n Number of samples of this loop.
+ * @param stride Distance between consecutive samples, in elements.
+ * @param cb Called for each vehicle closed in the block.
+ * @param arg Argument for @p cb.
+ * @return The number of vehicles closed.
+ */
+uint32_t loop_signature_feed(struct loop_sig_detector *det, const uint16_t *samples, size_t n,
+                             size_t stride, loop_signature_cb_t cb, void *arg);
+
+/**
+ * @brief Classifies a signature.
+ * @param sig The signature.
+ * @param sample_us Sampling interval of its loop.
+ * @param speed_mm_s Speed of the vehicle, from the sensors.
+ * @return The class; VEHICLE_CLASS_UNKNOWN without a speed or a signal.
+ */
+vehicle_class_t loop_signature_classify(const struct loop_signature *sig, uint32_t sample_us,
+                                        uint32_t speed_mm_s);
+
+/**
+ * @brief Combines the axle class with the loop class. Axles count, the
+ * loop tells bodies apart: a car by its axles that the loop sees as a van
+ * is a van, and a vehicle whose axles were missed takes the loop class.
+ * @param axles The class from axle_classify().
+ * @param loop The class from loop_signature_classify().
+ * @return The class of the vehicle.
+ */
+vehicle_class_t loop_signature_fuse(vehicle_class_t axles, vehicle_class_t loop);
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef LOOP_SYNTH_H
+#define LOOP_SYNTH_H
+#include <zephyr/kernel.h>
+
+/*
+ * Synthetic loop waveforms, for the ADC emulator and the tests. A vehicle
+ * is a metal profile along its length; the loop responds with the profile
+ * averaged over the part of the vehicle above it.
+ */
+
+/* > Metal profile of a synthetic vehicle, in ADC counts */
+struct loop_synth_vehicle {
+    uint16_t length_cm;
+    uint16_t nose_cm;     /* Front over which the metal builds up */
+    uint16_t front_cm;    /* Heavier front (engine, cab) behind the nose */
+    uint16_t front_amp;
+    uint16_t body_amp;
+    uint16_t gap_at_cm;   /* Start of a gap without metal; 0 for none */
+    uint16_t gap_cm;
+};
+
+/* > Reference vehicles */
+static const struct loop_synth_vehicle loop_synth_motorcycle = { 210, 20, 80, 220, 120, 0, 0 };
+static const struct loop_synth_vehicle loop_synth_car = { 450, 60, 150, 700, 450, 0, 0 };
+static const struct loop_synth_vehicle loop_synth_van = { 560, 20, 100, 600, 560, 0, 0 };
+static const struct loop_synth_vehicle loop_synth_bus = { 1200, 10, 0, 320, 320, 0, 0 };
+static const struct loop_synth_vehicle loop_synth_truck = { 1650, 30, 250, 450, 300, 300, 120 };
+
+/**
+ * @brief Metal of a vehicle at a distance from its front.
+ * @param v The vehicle.
+ * @param s_cm The distance, in cm.
+ * @return The metal, in counts.
+ */
+static inline uint32_t loop_synth_metal(const struct loop_synth_vehicle *v, int32_t s_cm)
+{
+    if (s_cm < 0 || s_cm >= v->length_cm ||
+        (v->gap_cm != 0U && s_cm >= v->gap_at_cm && s_cm < v->gap_at_cm + v->gap_cm)) {
+        return 0;
+    }
+    if (s_cm < v->nose_cm) {
+        return (uint32_t)v->front_amp * (uint32_t)s_cm / v->nose_cm;
+    }
+    return (s_cm < v->nose_cm + v->front_cm) ? v->front_amp : v->body_amp;
+}
+
+/**
+ * @brief Loop response with the front of a vehicle at a position.
+ * @param v The vehicle.
+ * @param front_cm Front of the vehicle from the leading edge of the loop.
+ * @param loop_cm Loop length along the lane.
+ * @return The signal above the idle level, in counts.
+ */
+static inline uint16_t loop_synth_response(const struct loop_synth_vehicle *v,
+                                           int32_t front_cm, uint16_t loop_cm)
+{
+    uint32_t sum = 0;
+
+    /* The vehicle point s lies at front_cm - s, over the loop if in [0, loop_cm) */
+    for (int32_t s = MAX(front_cm - (int32_t)loop_cm + 1, 0); s <= front_cm; s++) {
+        sum += loop_synth_metal(v, s);
+    }
+    return (uint16_t)(sum / loop_cm);
+}
+
+/**
+ * @brief Samples a vehicle crossing a loop.
+ * @param v The vehicle.
+ * @param speed_mm_s Its speed.
+ * @param sample_us Sampling interval.
+ * @param loop_cm Loop length along the lane.
+ * @param baseline Idle level of the loop.
+ * @param first Sample index at which the front reaches the loop.
+ * @param out Receives the samples.
+ * @param n Number of samples, from index 0.
+ */
+static inline void loop_synth_samples(const struct loop_synth_vehicle *v, uint32_t speed_mm_s,
+                                      uint32_t sample_us, uint16_t loop_cm, uint16_t baseline,
+                                      int64_t first, uint16_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        int64_t front_cm = ((int64_t)i - first) * sample_us * speed_mm_s / 10000000;
+
+        out[i] = baseline + loop_synth_response(v, (int32_t)front_cm, loop_cm);
+    }
+}
+
+/**
+ * @brief Samples needed for a vehicle to clear a loop.
+ * @param v The vehicle.
+ * @param speed_mm_s Its speed.
+ * @param sample_us Sampling interval.
+ * @param loop_cm Loop length along the lane.
+ * @return The samples from the front reaching the loop to the rear leaving it.
+ */
+static inline uint32_t loop_synth_span(const struct loop_synth_vehicle *v, uint32_t speed_mm_s,
+                                       uint32_t sample_us, uint16_t loop_cm)
+{
+    return (uint32_t)(((uint64_t)(v->length_cm + loop_cm) * 10000000U) /
+                      ((uint64_t)speed_mm_s * sample_us)) + 1U;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef PCPU_COUNTER_H
+#define PCPU_COUNTER_H
+#include <zephyr/kernel.h>
+
+/*
+ * Event counter sharded per CPU. Each CPU adds to its own 64-bit slot, on
+ * a cache line of its own under SMP, so increments never bounce a line
+ * between cores and never take a lock; readers sum the slots. Totals are
+ * 64-bit and do not wrap in the life of the device.
+ */
+
+#if defined(CONFIG_SMP)
+#define PCPU_COUNTER_CPUS CONFIG_MP_MAX_NUM_CPUS
+/** Slot alignment: one cache line, so CPUs never share one */
+#define PCPU_COUNTER_ALIGN 64
+#else
+#define PCPU_COUNTER_CPUS 1
+#define PCPU_COUNTER_ALIGN 8
+#endif
+
+/* > One CPU's share of a counter */
+struct pcpu_counter_slot {
+    uint64_t value;
+} __aligned(PCPU_COUNTER_ALIGN);
+
+/* > Sharded counter; zero-initialized storage is a zero count */
+struct pcpu_counter {
+    struct pcpu_counter_slot slots[PCPU_COUNTER_CPUS];
+};
+
+/**
+ * @brief Adds to a counter. Lock-free and ISR-safe.
+ * @param c The counter.
+ * @param n The amount to add.
+ */
+static inline void pcpu_counter_add(struct pcpu_counter *c, uint64_t n)
+{
+#if defined(CONFIG_SMP)
+    /* Atomic, so a thread migrated after reading its CPU id stays exact;
+     * the slot is almost always the local one, so the line stays put.
+     */
+    __atomic_fetch_add(&c->slots[arch_curr_cpu()->id].value, n, __ATOMIC_RELAXED);
+#else
+    unsigned int key = arch_irq_lock();
+
+    c->slots[0].value += n;
+    arch_irq_unlock(key);
+#endif
+}
+
+/**
+ * @brief Adds one to a counter. Lock-free and ISR-safe.
+ * @param c The counter.
+ */
+static inline void pcpu_counter_inc(struct pcpu_counter *c)
+{
+    pcpu_counter_add(c, 1U);
+}
+
+/**
+ * @brief Reads a counter: the sum of every CPU's slot.
+ * Concurrent increments may or may not be included.
+ * @param c The counter.
+ * @return The total.
+ */
+static inline uint64_t pcpu_counter_get(const struct pcpu_counter *c)
+{
+#if defined(CONFIG_SMP)
+    uint64_t sum = 0;
+
+    for (unsigned int cpu = 0; cpu < PCPU_COUNTER_CPUS; cpu++) {
+        sum += __atomic_load_n(&c->slots[cpu].value, __ATOMIC_RELAXED);
+    }
+    return sum;
+#else
+    /* A 64-bit load is two loads on 32-bit cores: keep it whole */
+    unsigned int key = arch_irq_lock();
+    uint64_t sum = c->slots[0].value;
+
+    arch_irq_unlock(key);
+    return sum;
+#endif
+}
+
+/**
+ * @brief Clears a counter. No increment may run concurrently.
+ * @param c The counter.
+ */
+static inline void pcpu_counter_reset(struct pcpu_counter *c)
+{
+    for (unsigned int cpu = 0; cpu < PCPU_COUNTER_CPUS; cpu++) {
+        c->slots[cpu].value = 0U;
+    }
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef PLATE_BATCH_H
+#define PLATE_BATCH_H
+#include <zephyr/kernel.h>
+#include "common.h"
+
+/**
+ * @brief Validates many plates in one call.
+ * Each slot holds a NUL-terminated plate (as in the radar message structs).
+ * The kernel is selected at compile time: AVX2/SSE2 on x86, 64-bit SWAR on
+ * other targets, or the scalar reference when CONFIG_RADAR_PLATE_BATCH_SIMD
+ * is disabled. Every kernel returns exactly what validate_plate_country()
+ * returns for each slot.
+ * @param plates The plate slots to validate.
+ * @param n The number of slots.
+ * @param out_country Output array of n entries receiving the plate_country_t
+ *        of each slot (PLATE_COUNTRY_NONE for invalid plates).
+ * @return The number of valid plates.
+ */
+size_t validate_plates_batch(const char (*plates)[PLATE_STR_SIZE], size_t n,
+                             uint8_t *out_country);
+
+/**
+ * @brief Gets the name of the batch kernel compiled in.
+ * @return "avx2", "sse2", "swar" or "scalar".
+ */
+const char *validate_plates_batch_kernel(void);
+
+#endif
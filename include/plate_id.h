@@ -0,0 +1,147 @@
+#ifndef PLATE_ID_H
+#define PLATE_ID_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Size of a NUL-terminated plate string carried in bulk plate slots */
+#define PLATE_STR_SIZE 10
+
+/* > Size of the canonical plate text produced by plate_id_to_str() */
+#define PLATE_TEXT_SIZE 8
+
+/* > Plate country, as matched by the Mercosul plate validator */
+typedef enum {
+    PLATE_COUNTRY_NONE,
+    PLATE_COUNTRY_BR,
+    PLATE_COUNTRY_AR,
+    PLATE_COUNTRY_UY,
+    PLATE_COUNTRY_PY_CAR,
+    PLATE_COUNTRY_PY_MOTO,
+    PLATE_COUNTRY_BO
+} plate_country_t;
+
+/**
+ * @brief Canonical plate identifier.
+ * Bits 0..36 hold the 7 significant characters packed in radix 36
+ * ('0'-'9' -> 0-9, 'A'-'Z' -> 10-35, first character most significant) and
+ * bits 56..63 hold the plate_country_t. Separators and letter case are not
+ * kept, so two reads of the same plate always produce the same value.
+ */
+typedef uint64_t plate_id_t;
+
+/* > No plate / invalid read */
+#define PLATE_ID_NONE ((plate_id_t)0)
+
+#define PLATE_ID_VALUE_BITS    37U
+#define PLATE_ID_VALUE_MASK    ((1ULL << PLATE_ID_VALUE_BITS) - 1ULL)
+#define PLATE_ID_COUNTRY_SHIFT 56U
+
+/**
+ * @brief Validates a plate and encodes it as a plate_id_t in a single pass.
+ * Meant to be called once, where the plate is captured.
+ * @param plate The plate text (separators and lowercase accepted).
+ * @return The plate identifier, PLATE_ID_NONE if the plate is invalid.
+ */
+plate_id_t plate_id_from_str(const char *plate);
+
+/**
+ * @brief Writes the canonical text of a plate (e.g. "ABC1D23").
+ * For display and export only; the pipeline compares identifiers.
+ * @param id The plate identifier.
+ * @param buf The output buffer.
+ * @param len The size of the output buffer (at least PLATE_TEXT_SIZE).
+ * @return 0 on success, -EINVAL for PLATE_ID_NONE, -ENOMEM if buf is too small.
+ */
+int plate_id_to_str(plate_id_t id, char *buf, size_t len);
+
+/**
+ * @brief Checks whether an identifier holds a valid plate.
+ * @param id The plate identifier.
+ * @return True if the identifier holds a plate.
+ */
+static inline bool plate_id_is_valid(plate_id_t id)
+{
+    return id != PLATE_ID_NONE;
+}
+
+/**
+ * @brief Gets the country of a plate identifier.
+ * @param id The plate identifier.
+ * @return The country, PLATE_COUNTRY_NONE for PLATE_ID_NONE.
+ */
+static inline plate_country_t plate_id_country(plate_id_t id)
+{
+    return (plate_country_t)(id >> PLATE_ID_COUNTRY_SHIFT);
+}
+
+/**
+ * @brief Hashes a plate identifier (Fibonacci hashing, one multiply).
+ * @param id The plate identifier.
+ * @return A 32-bit hash with well-mixed high bits.
+ */
+static inline uint32_t plate_id_hash(plate_id_t id)
+{
+    return (uint32_t)((id * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+/* > Size of a plate identifier packed by plate_id_pack40() */
+#define PLATE_ID_PACKED_SIZE 5U
+
+/**
+ * @brief Gets the 40-bit key of a plate identifier (country in bits 37..39).
+ * Keys sort in the same order as identifiers.
+ * @param id The plate identifier.
+ * @return The 40-bit key.
+ */
+static inline uint64_t plate_id_key40(plate_id_t id)
+{
+    return ((id >> PLATE_ID_COUNTRY_SHIFT) << PLATE_ID_VALUE_BITS) | (id & PLATE_ID_VALUE_MASK);
+}
+
+/**
+ * @brief Rebuilds a plate identifier from its 40-bit key.
+ * @param key The 40-bit key.
+ * @return The plate identifier.
+ */
+static inline plate_id_t plate_id_from_key40(uint64_t key)
+{
+    return ((key >> PLATE_ID_VALUE_BITS) << PLATE_ID_COUNTRY_SHIFT) | (key & PLATE_ID_VALUE_MASK);
+}
+
+/**
+ * @brief Packs a plate identifier into 5 bytes (little-endian 40-bit key).
+ * @param id The plate identifier.
+ * @param out The output bytes.
+ */
+static inline void plate_id_pack40(plate_id_t id, uint8_t out[PLATE_ID_PACKED_SIZE])
+{
+    uint64_t key = plate_id_key40(id);
+
+    for (size_t i = 0; i < PLATE_ID_PACKED_SIZE; i++) {
+        out[i] = (uint8_t)(key >> (8U * i));
+    }
+}
+
+/**
+ * @brief Reads the 40-bit key stored by plate_id_pack40().
+ * @param in The packed bytes.
+ * @return The 40-bit key.
+ */
+static inline uint64_t plate_id_packed_key40(const uint8_t in[PLATE_ID_PACKED_SIZE])
+{
+    return (uint64_t)in[0] | ((uint64_t)in[1] << 8) | ((uint64_t)in[2] << 16) |
+           ((uint64_t)in[3] << 24) | ((uint64_t)in[4] << 32);
+}
+
+/**
+ * @brief Unpacks a plate identifier stored by plate_id_pack40().
+ * @param in The packed bytes.
+ * @return The plate identifier.
+ */
+static inline plate_id_t plate_id_unpack40(const uint8_t in[PLATE_ID_PACKED_SIZE])
+{
+    return plate_id_from_key40(plate_id_packed_key40(in));
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef PLATE_SIGNATURE_H
+#define PLATE_SIGNATURE_H
+#include <stdint.h>
+
+/* > Number of significant characters in a Mercosul plate (separators excluded) */
+#define PLATE_SIGNIFICANT_CHARS 7U
+
+/* > Character classes used by the plate validator */
+#define PLATE_CLASS_INVALID   0U
+#define PLATE_CLASS_DIGIT     1U
+#define PLATE_CLASS_LETTER    2U
+#define PLATE_CLASS_SEPARATOR 3U
+
+/**
+ * @brief Builds the signature of a 7-character plate pattern.
+ * Bit i of the signature is set when character i is a letter ('L') and
+ * clear when it is a digit ('N'), so a plate maps to one 7-bit value.
+ */
+#define PLATE_SIG(c0, c1, c2, c3, c4, c5, c6)                                      \
+    ((((c0) == 'L') ? 0x01U : 0U) | (((c1) == 'L') ? 0x02U : 0U) |                 \
+     (((c2) == 'L') ? 0x04U : 0U) | (((c3) == 'L') ? 0x08U : 0U) |                 \
+     (((c4) == 'L') ? 0x10U : 0U) | (((c5) == 'L') ? 0x20U : 0U) |                 \
+     (((c6) == 'L') ? 0x40U : 0U))
+
+/* > Number of distinct plate signatures */
+#define PLATE_SIG_COUNT 128U
+
+/**
+ * @brief Character class of every byte value (PLATE_CLASS_*).
+ */
+extern const uint8_t plate_char_class[256];
+
+/**
+ * @brief Country (plate_country_t) matched by each plate signature,
+ * PLATE_COUNTRY_NONE for signatures no Mercosul pattern accepts.
+ */
+extern const uint8_t plate_signature_country[PLATE_SIG_COUNT];
+
+#endif
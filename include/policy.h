@@ -0,0 +1,131 @@
+#ifndef POLICY_H
+#define POLICY_H
+#include <zephyr/kernel.h>
+#include "common.h"
+#include "snapshot.h"
+#include "decision_table.h"
+
+/* > Enforcement policy values, as configured */
+struct radar_policy_values {
+    uint32_t limit_light_kmh;
+    uint32_t limit_heavy_kmh;
+    uint32_t warning_percent;   /* Share of the limit that turns the display yellow */
+    uint32_t distance_mm;       /* Between the start and end sensors */
+    /* Per-class limits; 0 takes the light or heavy limit of the class */
+    uint32_t class_limit_kmh[VEHICLE_CLASS_COUNT];
+};
+
+/* > Published policy: immutable once visible to readers */
+struct radar_policy {
+    struct snapshot_obj snap;
+    struct radar_policy_values v;
+    struct decision_table table; /* Built from v when published */
+};
+
+/**
+ * @brief Pins the current policy. Lock-free and copy-free; readers never
+ * block writers for longer than they hold the policy.
+ * @return The policy, never NULL (the Kconfig defaults until set).
+ */
+const struct radar_policy *policy_acquire(void);
+
+/**
+ * @brief Unpins a policy obtained from policy_acquire().
+ * @param policy The policy.
+ */
+void policy_release(const struct radar_policy *policy);
+
+/**
+ * @brief Gets the limits of a vehicle class.
+ * @param policy The pinned policy.
+ * @param vclass The vehicle class; out-of-range classes count as unknown.
+ * @return The limit and warning threshold of the class.
+ */
+static inline const struct decision_class *policy_class(const struct radar_policy *policy,
+                                                        vehicle_class_t vclass)
+{
+    return &policy->table.classes[(vclass < VEHICLE_CLASS_COUNT) ? vclass :
+                                  VEHICLE_CLASS_UNKNOWN];
+}
+
+/**
+ * @brief Gets the speed limit of a vehicle class.
+ * @param policy The pinned policy.
+ * @param vclass The vehicle class.
+ * @return The limit in km/h.
+ */
+static inline uint32_t policy_limit_kmh(const struct radar_policy *policy, vehicle_class_t vclass)
+{
+    return policy_class(policy, vclass)->limit_kmh;
+}
+
+/**
+ * @brief Gets the warning threshold of a vehicle class.
+ * @param policy The pinned policy.
+ * @param vclass The vehicle class.
+ * @return The lowest speed shown as a warning, in km/h.
+ */
+static inline uint32_t policy_warning_kmh(const struct radar_policy *policy,
+                                          vehicle_class_t vclass)
+{
+    return policy_class(policy, vclass)->warning_kmh;
+}
+
+/**
+ * @brief Decides a vehicle from its transit duration with the policy's
+ * decision table: no division on the per-vehicle path.
+ * @param policy The pinned policy.
+ * @param duration_ms The time between the start and end sensors.
+ * @param vclass The vehicle class.
+ * @param speed_kmh Receives the speed.
+ * @param limit_kmh Receives the limit that applies to @p vclass.
+ * @return The status, as enforcement_decide() returns it for that speed.
+ */
+static inline display_status_t policy_decide(const struct radar_policy *policy,
+                                             uint32_t duration_ms, vehicle_class_t vclass,
+                                             uint32_t *speed_kmh, uint32_t *limit_kmh)
+{
+    return decision_lookup(&policy->table, duration_ms, vclass, speed_kmh, limit_kmh);
+}
+
+/**
+ * @brief Decides a vehicle whose speed was measured some other way.
+ * @param policy The pinned policy.
+ * @param speed_kmh The speed.
+ * @param vclass The vehicle class.
+ * @param limit_kmh Receives the limit that applies to @p vclass.
+ * @return The status, as enforcement_decide() returns it for that speed.
+ */
+static inline display_status_t policy_decide_speed(const struct radar_policy *policy,
+                                                   uint32_t speed_kmh, vehicle_class_t vclass,
+                                                   uint32_t *limit_kmh)
+{
+    const struct decision_class *c = policy_class(policy, vclass);
+
+    *limit_kmh = c->limit_kmh;
+    return decision_status(c, speed_kmh);
+}
+
+/**
+ * @brief Validates and publishes new policy values, then persists them
+ * when CONFIG_RADAR_POLICY_SETTINGS is enabled. Thread context only.
+ * @param values The new values.
+ * @return 0 on success, -EINVAL if a value is out of range, or the
+ *         negative error of the settings backend (the policy still applies).
+ */
+int policy_update(const struct radar_policy_values *values);
+
+/**
+ * @brief Reads the current policy values.
+ * @param out Receives the values.
+ */
+void policy_get(struct radar_policy_values *out);
+
+/**
+ * @brief Loads the stored policy from the settings subsystem, if enabled,
+ * and publishes it. Without stored values the Kconfig defaults remain.
+ * @return 0 on success, negative error code from the settings subsystem.
+ */
+int policy_init(void);
+
+#endif
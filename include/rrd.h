@@ -0,0 +1,74 @@
+#ifndef RRD_H
+#define RRD_H
+#include <zephyr/kernel.h>
+
+/*
+ * Round-robin time-series store for the telemetry counters.
+ * Three fixed-memory tiers (seconds, minutes, quarter hours); every closed
+ * bucket is rolled into the next tier as it closes, so no tier is ever
+ * recomputed and a query costs the same whatever the history length.
+ */
+
+/* > Counters kept per bucket */
+enum rrd_metric {
+    RRD_VEHICLE_LIGHT,
+    RRD_VEHICLE_HEAVY,
+    RRD_STATUS_NORMAL, /* Status counters follow display_status_t order */
+    RRD_STATUS_WARNING,
+    RRD_STATUS_INFRACTION,
+    RRD_CAMERA_VALID,
+    RRD_CAMERA_INVALID,
+    RRD_METRIC_COUNT
+};
+
+/* > Resolutions */
+enum rrd_tier {
+    RRD_TIER_SECOND,  /* 1 s buckets, CONFIG_RADAR_RRD_SECONDS of them */
+    RRD_TIER_MINUTE,  /* 1 min buckets, CONFIG_RADAR_RRD_MINUTES of them */
+    RRD_TIER_QUARTER, /* 15 min buckets, CONFIG_RADAR_RRD_QUARTERS of them */
+    RRD_TIER_COUNT
+};
+
+/**
+ * @brief Clears the store.
+ * @param now_ms The current time; buckets are aligned to multiples of their width.
+ */
+void rrd_init(int64_t now_ms);
+
+/**
+ * @brief Adds to a counter in the current second.
+ * @param metric The counter.
+ * @param now_ms The event time; older than the current second counts as now.
+ * @param n The amount to add.
+ */
+void rrd_add(enum rrd_metric metric, int64_t now_ms, uint32_t n);
+
+/**
+ * @brief Closes every bucket that ended before now_ms, rolling it up.
+ * @param now_ms The current time.
+ */
+void rrd_advance(int64_t now_ms);
+
+/**
+ * @brief Gets the bucket width of a tier.
+ * @param tier The tier.
+ * @return The width in ms, 0 for an unknown tier.
+ */
+uint32_t rrd_bucket_ms(enum rrd_tier tier);
+
+/**
+ * @brief Reads one counter from the buckets of a tier starting in [from_ms, to_ms).
+ * Only closed buckets still held by the tier are returned.
+ * @param tier The tier.
+ * @param metric The counter.
+ * @param from_ms The start of the time range.
+ * @param to_ms The end of the time range.
+ * @param out The array to store the values, oldest first.
+ * @param max The capacity of out.
+ * @param first_ms Receives the start of the first bucket copied (may be NULL).
+ * @return The number of values copied, or -EINVAL.
+ */
+int rrd_query(enum rrd_tier tier, enum rrd_metric metric, int64_t from_ms, int64_t to_ms,
+              uint32_t *out, size_t max, int64_t *first_ms);
+
+#endif
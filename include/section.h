@@ -0,0 +1,60 @@
+#ifndef SECTION_H
+#define SECTION_H
+#include <zephyr/kernel.h>
+#include "plate_id.h"
+
+/*
+ * Section-control (average speed) engine.
+ * Entry reads wait in a hash table keyed by plate until the vehicle is read
+ * at the exit site or its maximum travel time runs out. A timing wheel
+ * expires stale reads in amortized O(1). Not thread-safe: callers serialize.
+ */
+
+/**
+ * @brief Clears every in-flight read.
+ */
+void section_init(void);
+
+/**
+ * @brief Records a vehicle passing the entry site.
+ * A second entry read of the same plate replaces the first.
+ * @param plate The plate read at the entry.
+ * @param entry_ms The read time (site-independent timebase, ms).
+ * @return 0 on success, -EINVAL for an invalid plate, -ETIMEDOUT if the read
+ *         is already older than the maximum travel time, -ENOSPC if full.
+ */
+int section_entry(plate_id_t plate, int64_t entry_ms);
+
+/**
+ * @brief Matches a vehicle passing the exit site and forgets its entry read.
+ * @param plate The plate read at the exit.
+ * @param exit_ms The read time (ms).
+ * @param entry_ms Receives the matching entry time.
+ * @return 0 on a match, -ENOENT if the plate has no in-flight entry read at
+ *         or before @p exit_ms (a newer one is kept), -ETIMEDOUT if the entry
+ *         read is older than the maximum travel time (it is dropped).
+ */
+int section_exit(plate_id_t plate, int64_t exit_ms, int64_t *entry_ms);
+
+/**
+ * @brief Drops entry reads older than the maximum travel time.
+ * @param now_ms The current time (ms).
+ * @return The number of reads dropped.
+ */
+size_t section_expire(int64_t now_ms);
+
+/**
+ * @brief Gets the number of in-flight entry reads.
+ * @return The number of reads waiting for their exit.
+ */
+size_t section_in_flight(void);
+
+/**
+ * @brief Computes the average speed over the section.
+ * @param entry_ms The entry read time.
+ * @param exit_ms The exit read time.
+ * @return The average speed in km/h, 0 if the times are not increasing.
+ */
+uint32_t section_average_kmh(int64_t entry_ms, int64_t exit_ms);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef SECTION_CONTROL_H
+#define SECTION_CONTROL_H
+#include <zephyr/kernel.h>
+#include "common.h"
+#include "plate_id.h"
+
+/**
+ * @brief Gets the time base shared by both section sites.
+ * @return Milliseconds on the shared clock.
+ */
+int64_t section_control_now_ms(void);
+
+/**
+ * @brief Handles a valid plate read at this site.
+ * The entry site forwards it to the exit site; the exit site matches it
+ * with its entry read and logs an infraction if the average speed over
+ * the section exceeds the limit.
+ * @param plate The plate read by the camera.
+ * @param read_ms The time the vehicle crossed the sensors (shared clock).
+ * @param vclass The vehicle class.
+ */
+void section_control_on_read(plate_id_t plate, int64_t read_ms, vehicle_class_t vclass);
+
+#endif
@@ -2,6 +2,7 @@
 #define SENSOR_FSM_H
 #include <zephyr/kernel.h>
 #include "common.h"
+#include "axle_class.h"
 
 /* > Heuristics for dynamic axle window calculation */
 #define SENSOR_FSM_MIN_AXLE_WINDOW_MS   200U
@@ -18,23 +19,17 @@ struct sensor_fsm {
     enum sensor_state state;
     int64_t start_time;
     int64_t end_time;
+    int64_t last_axle_time;
+    int64_t axle_time[CONFIG_RADAR_MAX_AXLES]; /* Start-sensor edge of each axle */
     uint32_t axle_count;
     bool speed_measured;
     uint32_t axle_window_ms;
+    uint32_t distance_mm; /* Between the start and end sensors */
+    uint8_t lane; /* Lane covered by this sensor pair */
 };
 
 typedef struct sensor_fsm sensor_fsm_t;
 
-/**
- * @brief Classifies the vehicle type based on the number of axles.
- * @param axle_count The number of axles.
- * @return The vehicle type.
- */
-static inline vehicle_type_t classify_axles(uint32_t axle_count)
-{
-    return (axle_count <= 2) ? VEHICLE_LIGHT : VEHICLE_HEAVY;
-}
-
 /**
  * @brief Initializes the sensor FSM.
  * @param fsm Pointer to the sensor FSM.
@@ -44,9 +39,12 @@ static inline void sensor_fsm_init(struct sensor_fsm *fsm)
     fsm->state = SENSOR_IDLE;
     fsm->start_time = 0;
     fsm->end_time = 0;
+    fsm->last_axle_time = 0;
     fsm->axle_count = 0;
     fsm->speed_measured = false;
     fsm->axle_window_ms = CONFIG_RADAR_AXLE_TIMEOUT_MS;
+    fsm->distance_mm = CONFIG_RADAR_SENSOR_DISTANCE_MM;
+    fsm->lane = 0;
 }
 
 /**
@@ -84,11 +82,15 @@ static inline void sensor_fsm_handle_start(struct sensor_fsm *fsm, int64_t times
         fsm->state = SENSOR_ACTIVE;
         fsm->start_time = timestamp_ms;
         fsm->end_time = 0;
-        fsm->axle_count = 1;
+        fsm->axle_count = 0;
         fsm->speed_measured = false;
-    } else {
-        fsm->axle_count++;
     }
+    /* Axles past the array are counted, not timed */
+    if (fsm->axle_count < CONFIG_RADAR_MAX_AXLES) {
+        fsm->axle_time[fsm->axle_count] = timestamp_ms;
+    }
+    fsm->axle_count++;
+    fsm->last_axle_time = timestamp_ms;
 }
 
 /**
@@ -102,13 +104,91 @@ static inline bool sensor_fsm_handle_end(struct sensor_fsm *fsm, int64_t timesta
         fsm->end_time = timestamp_ms;
         fsm->speed_measured = true;
         uint32_t duration_ms = (uint32_t)(fsm->end_time - fsm->start_time);
-        uint32_t speed_kmh = calculate_speed(CONFIG_RADAR_SENSOR_DISTANCE_MM, duration_ms);
+        uint32_t speed_kmh = calculate_speed(fsm->distance_mm, duration_ms);
         fsm->axle_window_ms = sensor_fsm_compute_axle_window(speed_kmh);
         return true;
     }
     return false;
 }
 
+/**
+ * @brief Gets the time a vehicle takes to move a distance at its measured
+ * speed, with the slowdown margin.
+ * @param fsm Pointer to the sensor FSM, with the speed measured.
+ * @param length_cm The distance.
+ * @return The time, in ms.
+ */
+static inline int64_t sensor_fsm_time_to_cover(const struct sensor_fsm *fsm, uint32_t length_cm)
+{
+    uint64_t duration_ms = (uint64_t)(fsm->end_time - fsm->start_time);
+    uint64_t t_ms = ((uint64_t)length_cm * 10U * duration_ms) / fsm->distance_mm;
+
+    return (int64_t)((t_ms * (100U + CONFIG_RADAR_AXLE_CLOSE_MARGIN_PERCENT)) / 100U);
+}
+
+/**
+ * @brief Predicts the latest time another axle of the current vehicle can
+ * reach the start sensor: within the longest axle spacing of the last
+ * axle, and within the longest vehicle of the first.
+ * @param fsm Pointer to the sensor FSM, with the speed measured.
+ * @return The deadline, in ms since boot.
+ */
+static inline int64_t sensor_fsm_axle_deadline(const struct sensor_fsm *fsm)
+{
+    int64_t next_axle = fsm->last_axle_time +
+                        sensor_fsm_time_to_cover(fsm, CONFIG_RADAR_AXLE_MAX_SPACING_CM);
+    int64_t vehicle_end = fsm->start_time +
+                          sensor_fsm_time_to_cover(fsm, CONFIG_RADAR_VEHICLE_MAX_LENGTH_CM);
+
+    return MIN(next_axle, vehicle_end);
+}
+
+/**
+ * @brief Gets how long to wait for another axle before finalizing: the
+ * axle window, cut short once the speed is known and no further axle is
+ * possible (CONFIG_RADAR_AXLE_PREDICTIVE_CLOSE).
+ * @param fsm Pointer to the sensor FSM.
+ * @param now_ms The current time.
+ * @return The delay, in ms from @p now_ms; 0 to finalize at once.
+ */
+static inline uint32_t sensor_fsm_close_delay_ms(const struct sensor_fsm *fsm, int64_t now_ms)
+{
+    if (!IS_ENABLED(CONFIG_RADAR_AXLE_PREDICTIVE_CLOSE) || !fsm->speed_measured) {
+        return fsm->axle_window_ms;
+    }
+
+    int64_t deadline = sensor_fsm_axle_deadline(fsm);
+
+    if (deadline <= now_ms) {
+        return 0;
+    }
+    return (uint32_t)MIN(deadline - now_ms, (int64_t)fsm->axle_window_ms);
+}
+
+/**
+ * @brief Converts the axle timestamps into axle spacings, using the speed
+ * measured between the sensors.
+ * @param fsm Pointer to the sensor FSM, with the speed measured.
+ * @param spacing_cm Receives CONFIG_RADAR_MAX_AXLES - 1 spacings; the ones
+ *        past the last timed axle are 0.
+ */
+static inline void sensor_fsm_axle_spacings(const struct sensor_fsm *fsm, uint16_t *spacing_cm)
+{
+    uint32_t timed = MIN(fsm->axle_count, (uint32_t)CONFIG_RADAR_MAX_AXLES);
+    uint64_t duration_ms = (uint64_t)(fsm->end_time - fsm->start_time);
+
+    for (uint32_t i = 0; i < CONFIG_RADAR_MAX_AXLES - 1; i++) {
+        uint64_t cm = 0;
+
+        if (i + 1U < timed) {
+            /* distance_mm over duration_ms is the speed in mm/ms */
+            uint64_t dt_ms = (uint64_t)(fsm->axle_time[i + 1U] - fsm->axle_time[i]);
+            cm = (dt_ms * fsm->distance_mm) / (duration_ms * 10U);
+        }
+        spacing_cm[i] = (uint16_t)MIN(cm, (uint64_t)UINT16_MAX);
+    }
+}
+
 /**
  * @brief Finalizes the sensor measurement.
  * @param fsm Pointer to the sensor FSM.
@@ -125,9 +205,19 @@ static inline bool sensor_fsm_finalize(struct sensor_fsm *fsm, sensor_data_t *ou
     if (fsm->speed_measured && fsm->end_time > fsm->start_time) {
         out_data->timestamp_start = fsm->start_time;
         out_data->timestamp_end = fsm->end_time;
+        out_data->timestamp_last_axle = fsm->last_axle_time;
         out_data->duration_ms = (uint32_t)(fsm->end_time - fsm->start_time);
         out_data->axle_count = fsm->axle_count;
-        out_data->type = classify_axles(fsm->axle_count);
+        sensor_fsm_axle_spacings(fsm, out_data->axle_spacing_cm);
+        out_data->vclass = axle_classify(fsm->axle_count, out_data->axle_spacing_cm);
+        out_data->type = vehicle_class_type(out_data->vclass);
+        out_data->fit_speed_ckmh = 0;
+        out_data->fit_accel_mm_s2 = 0;
+        out_data->fit_confidence = 0;
+        memset(out_data->axle_weight_kg, 0, sizeof(out_data->axle_weight_kg));
+        out_data->gross_weight_kg = 0;
+        out_data->doppler_speed_ckmh = 0;
+        out_data->lane = fsm->lane;
         produced = true;
     }
     
@@ -135,6 +225,7 @@ static inline bool sensor_fsm_finalize(struct sensor_fsm *fsm, sensor_data_t *ou
     fsm->state = SENSOR_IDLE;
     fsm->start_time = 0;
     fsm->end_time = 0;
+    fsm->last_axle_time = 0;
     fsm->axle_count = 0;
     fsm->speed_measured = false;
     fsm->axle_window_ms = CONFIG_RADAR_AXLE_TIMEOUT_MS;
@@ -0,0 +1,74 @@
+#ifndef SHA256_H
+#define SHA256_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_DIGEST_SIZE 32U
+#define SHA256_BLOCK_SIZE  64U
+
+/* > Streaming SHA-256 state; lives on the caller's stack, no heap */
+struct sha256_ctx {
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t block[SHA256_BLOCK_SIZE];
+    size_t block_len;
+};
+
+/**
+ * @brief Starts a SHA-256 computation.
+ * @param ctx The context to initialize.
+ */
+void sha256_init(struct sha256_ctx *ctx);
+
+/**
+ * @brief Feeds data into a SHA-256 computation.
+ * @param ctx The context.
+ * @param data The data.
+ * @param len The size of the data.
+ */
+void sha256_update(struct sha256_ctx *ctx, const void *data, size_t len);
+
+/**
+ * @brief Finishes a SHA-256 computation.
+ * @param ctx The context (must be re-initialized before reuse).
+ * @param digest Receives the digest.
+ */
+void sha256_final(struct sha256_ctx *ctx, uint8_t digest[SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Computes the SHA-256 digest of a buffer in one call.
+ * @param data The data.
+ * @param len The size of the data.
+ * @param digest Receives the digest.
+ */
+void sha256(const void *data, size_t len, uint8_t digest[SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Checks a buffer against an expected SHA-256 digest.
+ * The comparison takes the same time wherever the digests differ.
+ * @param data The data.
+ * @param len The size of the data.
+ * @param expected The expected digest.
+ * @return True if the digest of the data matches.
+ */
+bool sha256_verify(const void *data, size_t len, const uint8_t expected[SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Computes HMAC-SHA256 (RFC 2104).
+ * @param key The key.
+ * @param key_len The size of the key.
+ * @param data The message.
+ * @param len The size of the message.
+ * @param mac Receives the authentication code.
+ */
+void hmac_sha256(const void *key, size_t key_len, const void *data, size_t len,
+                 uint8_t mac[SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Names the compression kernel in use ("sha-ni" or "portable").
+ * @return The kernel name.
+ */
+const char *sha256_kernel(void);
+
+#endif
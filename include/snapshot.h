@@ -0,0 +1,76 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/*
+ * Published immutable object with reader counting (RCU-style).
+ * Readers pin the current object with two atomics and never block; a writer
+ * swaps the pointer atomically and then waits until the previous object has
+ * no readers left before reusing or freeing it.
+ */
+
+/* > Header embedded in every publishable object */
+struct snapshot_obj {
+    atomic_t readers;
+};
+
+/* > Pointer to the currently published object */
+struct snapshot {
+    atomic_ptr_t current;
+};
+
+/**
+ * @brief Pins the currently published object.
+ * Lock-free: retries only if a writer swapped the object in between.
+ * @param snap The snapshot pointer.
+ * @return The pinned object (release with snapshot_release()), or NULL if
+ *         nothing is published.
+ */
+static inline struct snapshot_obj *snapshot_acquire(struct snapshot *snap)
+{
+    while (true) {
+        struct snapshot_obj *obj = atomic_ptr_get(&snap->current);
+
+        if (obj == NULL) {
+            return NULL;
+        }
+        atomic_inc(&obj->readers);
+        /* Still current: the writer will see our count before reusing it */
+        if (atomic_ptr_get(&snap->current) == obj) {
+            return obj;
+        }
+        atomic_dec(&obj->readers);
+    }
+}
+
+/**
+ * @brief Unpins an object obtained from snapshot_acquire().
+ * @param obj The pinned object.
+ */
+static inline void snapshot_release(struct snapshot_obj *obj)
+{
+    atomic_dec(&obj->readers);
+}
+
+/**
+ * @brief Publishes a new object and waits for readers of the previous one.
+ * Must be called from thread context; concurrent writers must serialize.
+ * @param snap The snapshot pointer.
+ * @param obj The fully initialized object to publish (may be NULL).
+ * @return The previously published object, now free of readers, or NULL.
+ */
+static inline struct snapshot_obj *snapshot_publish(struct snapshot *snap,
+                                                    struct snapshot_obj *obj)
+{
+    struct snapshot_obj *old = atomic_ptr_set(&snap->current, obj);
+
+    if (old != NULL && old != obj) {
+        while (atomic_get(&old->readers) != 0) {
+            k_msleep(1);
+        }
+    }
+    return old;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SPEED_FIT_H
+#define SPEED_FIT_H
+#include <zephyr/kernel.h>
+
+/*
+ * Speed and acceleration from three or more loops. The crossing times are
+ * fitted by least squares as t(x) = c0 + c1 u + c2 u^2, u being the loop
+ * position from the centroid of the array: c1 is the inverse speed at the
+ * centroid and c2 its change, from which the acceleration follows. The
+ * positions are fixed, so the pseudo-inverse of the fit is computed once;
+ * a vehicle then costs three integer dot products and one residual pass,
+ * with no allocation. A loop reading that disagrees with the others shows
+ * as a large residual and rejects the fit.
+ */
+
+/** Loops a fit can use */
+#define SPEED_FIT_MAX_LOOPS CONFIG_RADAR_SPEED_FIT_MAX_LOOPS
+/** Farthest loop from the first one */
+#define SPEED_FIT_MAX_POSITION_MM 30000U
+/** Longest crossing of the array, about 10 km/h over the farthest loop */
+#define SPEED_FIT_MAX_SPAN_US (1U << 24)
+/** Fastest vehicle accepted */
+#define SPEED_FIT_MAX_KMH 300U
+
+/* > Fit precomputed for one loop array */
+struct speed_fit_model {
+    int32_t u_mm[SPEED_FIT_MAX_LOOPS];     /* Position from the centroid */
+    int32_t w[3][SPEED_FIT_MAX_LOOPS];     /* Pseudo-inverse rows, times 2^shift[k] */
+    uint8_t shift[3];
+    uint8_t loops;
+};
+
+/* > Fitted vehicle */
+struct speed_fit {
+    uint32_t speed_ckmh;   /* At the centroid, in 0.01 km/h */
+    int32_t accel_mm_s2;   /* Negative when braking */
+    uint32_t rms_us;       /* Residual, per degree of freedom */
+    uint32_t max_residual_us;
+    uint8_t confidence;    /* 0 to 100; 0 with three loops, the fit being exact */
+};
+
+/**
+ * @brief Precomputes the fit of a loop array. Uses floating point: call
+ * it at init, not per vehicle.
+ * @param model The model to fill.
+ * @param position_mm Position of each loop from the first, increasing.
+ * @param loops Number of loops, 3 to SPEED_FIT_MAX_LOOPS.
+ * @return 0 on success, -EINVAL if the positions cannot be fitted.
+ */
+int speed_fit_model_init(struct speed_fit_model *model, const uint32_t *position_mm,
+                         size_t loops);
+
+/**
+ * @brief Fits one vehicle.
+ * @param model The loop array.
+ * @param t_us Crossing time of each loop, in us from any origin; wraps.
+ * @param out Receives the fit; untouched on error.
+ * @return 0 on success, -EINVAL if the times do not advance along the array
+ *         or span more than SPEED_FIT_MAX_SPAN_US, -ERANGE if a loop is off
+ *         by more than CONFIG_RADAR_SPEED_FIT_MAX_RESIDUAL_US or the speed or
+ *         acceleration is implausible.
+ */
+int speed_fit_run(const struct speed_fit_model *model, const uint32_t *t_us,
+                  struct speed_fit *out);
+
+/**
+ * @brief Crossing times from the 32-bit cycle counts the GPIO ISRs take.
+ * The array is crossed in far less than a counter period, so the counter
+ * may wrap in between.
+ * @param cyc Cycle count at each loop.
+ * @param loops Number of loops.
+ * @param t_us Receives the times, in us from the first crossing.
+ */
+static inline void speed_fit_cycles_to_us(const uint32_t *cyc, size_t loops, uint32_t *t_us)
+{
+    for (size_t i = 0; i < loops; i++) {
+        t_us[i] = k_cyc_to_us_floor32(cyc[i] - cyc[0]);
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef SPEED_STATS_H
+#define SPEED_STATS_H
+#include <zephyr/kernel.h>
+
+/* > Speed histogram: fixed 10 km/h buckets, the last one is open-ended */
+#define SPEED_STATS_BUCKET_KMH 10U
+#define SPEED_STATS_BUCKETS    16U
+
+/* > P² estimator state (Jain & Chlamtac) for a single quantile */
+struct speed_p2 {
+    float q[5];   /* Marker heights */
+    float np[5];  /* Desired marker positions */
+    int32_t n[5]; /* Actual marker positions */
+    uint32_t count;
+};
+
+/* > Running statistics of one lane over the current interval */
+struct speed_stats_acc {
+    uint32_t count;
+    double mean;
+    double m2; /* Welford sum of squared deviations */
+    uint16_t min_kmh;
+    uint16_t max_kmh;
+    uint32_t hist[SPEED_STATS_BUCKETS];
+    struct speed_p2 p85;
+};
+
+/* > Closed interval of one lane, as kept in the history ring */
+struct speed_stats_summary {
+    int64_t start_ms;
+    uint32_t count;
+    uint8_t lane;
+    uint16_t min_kmh;
+    uint16_t max_kmh;
+    float mean_kmh;
+    float stddev_kmh;
+    float p85_kmh;
+    uint16_t hist[SPEED_STATS_BUCKETS]; /* Saturates at UINT16_MAX */
+};
+
+/**
+ * @brief Resets the accumulators and the history.
+ * @param now_ms Start of the first interval.
+ */
+void speed_stats_init(int64_t now_ms);
+
+/**
+ * @brief Adds a vehicle to its lane's current interval.
+ * O(1), no allocation. Closes elapsed intervals first.
+ * @param lane The lane, below CONFIG_RADAR_LANE_COUNT.
+ * @param speed_kmh The measured speed.
+ * @param now_ms The measurement time.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int speed_stats_add(uint8_t lane, uint32_t speed_kmh, int64_t now_ms);
+
+/**
+ * @brief Closes every interval that ended before now_ms.
+ * Only the open interval is written; the empty intervals after it are
+ * skipped without touching the history, and speed_stats_query() reads
+ * them back as empty summaries.
+ * @param now_ms The current time.
+ */
+void speed_stats_advance(int64_t now_ms);
+
+/**
+ * @brief Summarizes a lane's current, still open, interval.
+ * @param lane The lane.
+ * @param out Receives the summary.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int speed_stats_current(uint8_t lane, struct speed_stats_summary *out);
+
+/**
+ * @brief Gets the closed intervals of a lane that started in [from_ms, to_ms).
+ * @param lane The lane.
+ * @param from_ms The start of the time range.
+ * @param to_ms The end of the time range.
+ * @param out The array to store the summaries, oldest first.
+ * @param max The capacity of out.
+ * @return The number of summaries copied.
+ */
+size_t speed_stats_query(uint8_t lane, int64_t from_ms, int64_t to_ms,
+                         struct speed_stats_summary *out, size_t max);
+
+/**
+ * @brief Initializes a P² estimator.
+ * @param p2 The estimator.
+ */
+void speed_p2_init(struct speed_p2 *p2);
+
+/**
+ * @brief Adds an observation to a P² estimator.
+ * @param p2 The estimator.
+ * @param p The quantile tracked, in (0, 1).
+ * @param x The observation.
+ */
+void speed_p2_add(struct speed_p2 *p2, float p, float x);
+
+/**
+ * @brief Gets the quantile estimate of a P² estimator.
+ * @param p2 The estimator.
+ * @param p The quantile tracked.
+ * @return The estimate, 0 without observations.
+ */
+float speed_p2_get(const struct speed_p2 *p2, float p);
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef THREADS_H
 #define THREADS_H
 
+#include <zephyr/kernel.h>
+
 /**
  * @brief Entry point for the sensor thread.
  * @param p1 Pointer to the sensor thread data.
@@ -17,5 +19,34 @@ void sensor_thread_entry(void *p1, void *p2, void *p3);
  */
 void display_thread_entry(void *p1, void *p2, void *p3);
 
+/**
+ * @brief Entry point for the enforcement thread.
+ * Turns sensor measurements and camera captures into decisions.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+void enforcement_thread_entry(void *p1, void *p2, void *p3);
+
+/**
+ * @brief Start delay of the pipeline threads. With CONFIG_RADAR_SMP_PINNING
+ * they are created unstarted and main() starts them once pinned.
+ */
+#if defined(CONFIG_RADAR_SMP_PINNING)
+#define RADAR_STAGE_START_DELAY SYS_FOREVER_MS
+#else
+#define RADAR_STAGE_START_DELAY 0
+#endif
+
+/**
+ * @brief Pipeline threads, pinned per stage on SMP targets.
+ */
+extern const k_tid_t sensor_tid;
+extern const k_tid_t display_tid;
+extern const k_tid_t enforcement_tid;
+extern const k_tid_t telemetry_tid;
+extern const k_tid_t traffic_sim_tid;
+extern const k_tid_t camera_thread_id;
+
 #endif
 
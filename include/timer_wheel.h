@@ -0,0 +1,90 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+/*
+ * Hashed timing wheel. Pending deadlines are hashed by expiry tick into a
+ * ring of slots; scheduling, refreshing and cancelling relink one node,
+ * and each tick walks a single slot, skipping the entries due on a later
+ * turn of the wheel. One periodic tick serves any number of deadlines.
+ * Not locked: callers serialize access to a wheel and its entries.
+ */
+
+#define TIMER_WHEEL_SLOTS CONFIG_RADAR_AXLE_WHEEL_SLOTS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(TIMER_WHEEL_SLOTS), "wheel slots must be a power of two");
+
+/* > Deadline held by a wheel, embedded in its owner */
+struct timer_wheel_entry {
+    sys_dnode_t node;
+    uint32_t expiry; /* Tick at which the entry expires */
+};
+
+/* > Timing wheel */
+struct timer_wheel {
+    sys_dlist_t slots[TIMER_WHEEL_SLOTS];
+    uint32_t now;     /* Ticks elapsed since timer_wheel_init() */
+    uint32_t pending; /* Entries scheduled and not yet expired */
+};
+
+/**
+ * @brief Called for each expired entry, which is no longer pending.
+ * It may reschedule that entry, but must not cancel or schedule others.
+ * @param entry The entry.
+ * @param arg The argument given to timer_wheel_tick().
+ */
+typedef void (*timer_wheel_expire_t)(struct timer_wheel_entry *entry, void *arg);
+
+/**
+ * @brief Initializes an empty wheel at tick 0.
+ * @param wheel The wheel.
+ */
+void timer_wheel_init(struct timer_wheel *wheel);
+
+/**
+ * @brief Initializes an entry as not pending.
+ * @param entry The entry.
+ */
+static inline void timer_wheel_entry_init(struct timer_wheel_entry *entry)
+{
+    sys_dnode_init(&entry->node);
+    entry->expiry = 0;
+}
+
+/**
+ * @brief Checks whether an entry is scheduled.
+ * @param entry The entry.
+ * @return True until the entry expires or is cancelled.
+ */
+static inline bool timer_wheel_is_pending(const struct timer_wheel_entry *entry)
+{
+    return sys_dnode_is_linked(&entry->node);
+}
+
+/**
+ * @brief Schedules an entry, replacing its deadline if already pending.
+ * @param wheel The wheel.
+ * @param entry The entry.
+ * @param ticks Ticks from now; 0 counts as 1, the next tick.
+ */
+void timer_wheel_schedule(struct timer_wheel *wheel, struct timer_wheel_entry *entry,
+                          uint32_t ticks);
+
+/**
+ * @brief Cancels an entry; does nothing if it is not pending.
+ * @param wheel The wheel.
+ * @param entry The entry.
+ */
+void timer_wheel_cancel(struct timer_wheel *wheel, struct timer_wheel_entry *entry);
+
+/**
+ * @brief Advances the wheel by one tick and expires the entries due.
+ * @param wheel The wheel.
+ * @param expire Called for each expired entry.
+ * @param arg Passed to @p expire.
+ * @return The number of entries expired.
+ */
+uint32_t timer_wheel_tick(struct timer_wheel *wheel, timer_wheel_expire_t expire, void *arg);
+
+#endif
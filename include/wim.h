@@ -0,0 +1,83 @@
+#ifndef WIM_H
+#define WIM_H
+#include <zephyr/kernel.h>
+
+/*
+ * Weigh-in-motion on a piezo strip across the lane. Each tyre pressing on
+ * the strip gives a pulse; over the distance travelled its area is
+ * proportional to the axle load. The detector removes the slowly moving
+ * idle level with a first-order IIR, frozen while an axle is on the strip,
+ * and integrates every pulse from onset to end in one fixed-point pass.
+ */
+
+/** Idle level time constant, 2^WIM_BASELINE_SHIFT samples */
+#define WIM_BASELINE_SHIFT 9
+
+/* > One axle over the strip */
+struct wim_axle {
+    uint64_t end_sample; /* Last sample over the off threshold */
+    uint32_t samples;    /* Pulse width, onset to end_sample */
+    uint32_t area;       /* Sum of the signal over the pulse */
+    uint16_t peak;       /* Largest signal, counts above the idle level */
+};
+
+enum wim_state {
+    WIM_IDLE,
+    WIM_AXLE,
+};
+
+/* > Detector of one strip */
+struct wim_detector {
+    uint32_t baseline_q8; /* Idle level, Q8 */
+    uint16_t on_counts;   /* Onset, above the idle level */
+    uint16_t off_counts;  /* End, once below for hold samples */
+    uint16_t hold;
+    uint64_t sample;      /* Samples fed so far */
+    uint32_t below;       /* Consecutive samples under off_counts */
+    uint32_t below_area;  /* Their signal, taken back when the axle ends */
+    enum wim_state state;
+    bool primed;          /* Baseline taken from the first sample */
+    struct wim_axle cur;
+};
+
+/**
+ * @brief Called for each axle the detector closes.
+ * @param axle The axle, valid during the call.
+ * @param arg The argument given to wim_feed().
+ */
+typedef void (*wim_axle_cb_t)(const struct wim_axle *axle, void *arg);
+
+/**
+ * @brief Initializes an idle detector; the first sample sets the idle level.
+ * @param det The detector.
+ * @param on_counts Rise over the idle level that opens an axle.
+ * @param hold Samples under half of @p on_counts that close it.
+ */
+void wim_init(struct wim_detector *det, uint16_t on_counts, uint16_t hold);
+
+/**
+ * @brief Feeds a block of samples.
+ * @param det The detector.
+ * @param samples The samples of this strip, @p stride apart (interleaved lanes).
+ * @param n Number of samples of this strip.
+ * @param stride Distance between consecutive samples, in elements.
+ * @param cb Called for each axle closed in the block.
+ * @param arg Argument for @p cb.
+ * @return The number of axles closed.
+ */
+uint32_t wim_feed(struct wim_detector *det, const uint16_t *samples, size_t n, size_t stride,
+                  wim_axle_cb_t cb, void *arg);
+
+/**
+ * @brief Converts the pulse of an axle into its load.
+ * @param axle The axle.
+ * @param sample_us Sampling interval of the strip.
+ * @param speed_mm_s Speed of the vehicle, from the sensors.
+ * @param g_per_count_mm Calibration of the strip: load of one count of
+ *        signal over 1 mm of travel, in grams.
+ * @return The load in kg, saturated at UINT16_MAX; 0 without a speed.
+ */
+uint16_t wim_axle_kg(const struct wim_axle *axle, uint32_t sample_us, uint32_t speed_mm_s,
+                     uint32_t g_per_count_mm);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef WIM_ADC_H
+#define WIM_ADC_H
+#include <zephyr/kernel.h>
+#include "wim.h"
+
+/*
+ * ADC front end of the weigh-in-motion strips. A sampler thread reads
+ * blocks of CONFIG_RADAR_WIM_BLOCK samples per lane straight into a ring of
+ * CONFIG_RADAR_WIM_BLOCKS blocks and a processor thread runs the detectors
+ * over them in place. The axles of each lane wait there until the sensor
+ * thread weighs the vehicle they belong to.
+ */
+
+/* > Sampler counters */
+struct wim_adc_stats {
+    uint32_t blocks;   /* Blocks processed */
+    uint32_t overruns; /* Blocks the sampler found the ring full for */
+    uint32_t axles;    /* Axles closed, every lane */
+};
+
+/**
+ * @brief Weighs the axles a lane recorded since a time and forgets them.
+ * @param lane The lane.
+ * @param since_ms Oldest axle end accepted, in uptime ms.
+ * @param speed_mm_s Speed of the vehicle.
+ * @param axle_kg Receives the load of each axle, oldest first.
+ * @param max Capacity of @p axle_kg.
+ * @return The number of axles weighed; 0 if the lane has no strip.
+ */
+uint32_t wim_adc_weigh(uint8_t lane, int64_t since_ms, uint32_t speed_mm_s, uint16_t *axle_kg,
+                       uint32_t max);
+
+/**
+ * @brief Gets the sampler counters.
+ * @param out Receives the counters.
+ */
+void wim_adc_stats_get(struct wim_adc_stats *out);
+
+#endif
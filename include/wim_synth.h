@@ -0,0 +1,116 @@
+#ifndef WIM_SYNTH_H
+#define WIM_SYNTH_H
+#include <zephyr/kernel.h>
+
+/*
+ * Synthetic piezo waveforms, for the ADC emulator and the tests. A tyre
+ * rolling over the strip loads it along a trapezoid: it ramps up over the
+ * strip width, stays flat over the rest of the contact patch and ramps
+ * down again. The area over the travel is the load over the calibration.
+ */
+
+/** Strip width, the ramps of each pulse */
+#define WIM_SYNTH_STRIP_MM 50
+/** Contact patch, strip included */
+#define WIM_SYNTH_FOOTPRINT_MM 250
+/** Calibration of the synthetic strips, g per count.mm */
+#define WIM_SYNTH_G_PER_COUNT_MM 20
+
+#define WIM_SYNTH_MAX_AXLES 6
+
+/* > Axles of a synthetic vehicle */
+struct wim_synth_vehicle {
+    uint8_t axles;
+    uint16_t load_kg[WIM_SYNTH_MAX_AXLES];
+    uint16_t offset_mm[WIM_SYNTH_MAX_AXLES]; /* Behind the front axle */
+};
+
+/* > Reference vehicles */
+static const struct wim_synth_vehicle wim_synth_car = {
+    2, { 650, 550 }, { 0, 2600 },
+};
+static const struct wim_synth_vehicle wim_synth_truck_3 = {
+    3, { 6000, 8500, 8500 }, { 0, 4800, 6150 },
+};
+/* A tandem over the 10 t single-axle limit */
+static const struct wim_synth_vehicle wim_synth_truck_5_overload = {
+    5, { 6500, 9500, 9500, 11500, 11500 }, { 0, 3600, 4950, 11000, 12250 },
+};
+
+/**
+ * @brief Signal of one axle at a distance past the strip.
+ * @param load_kg The axle load.
+ * @param x_mm Travel since the tyre reached the strip.
+ * @return The signal, in counts.
+ */
+static inline uint32_t wim_synth_axle(uint32_t load_kg, int32_t x_mm)
+{
+    /* Trapezoid area: height x (footprint - strip) */
+    uint32_t height = (load_kg * 1000U) /
+                      (WIM_SYNTH_G_PER_COUNT_MM * (WIM_SYNTH_FOOTPRINT_MM - WIM_SYNTH_STRIP_MM));
+
+    if (x_mm < 0 || x_mm >= WIM_SYNTH_FOOTPRINT_MM) {
+        return 0;
+    }
+    if (x_mm < WIM_SYNTH_STRIP_MM) {
+        return height * (uint32_t)x_mm / WIM_SYNTH_STRIP_MM;
+    }
+    if (x_mm >= WIM_SYNTH_FOOTPRINT_MM - WIM_SYNTH_STRIP_MM) {
+        return height * (uint32_t)(WIM_SYNTH_FOOTPRINT_MM - x_mm) / WIM_SYNTH_STRIP_MM;
+    }
+    return height;
+}
+
+/**
+ * @brief Signal with the front axle at a distance past the strip.
+ * @param v The vehicle.
+ * @param front_mm Travel since the front tyre reached the strip.
+ * @return The signal, in counts above the idle level.
+ */
+static inline uint32_t wim_synth_response(const struct wim_synth_vehicle *v, int32_t front_mm)
+{
+    uint32_t sum = 0;
+
+    for (uint8_t a = 0; a < v->axles; a++) {
+        sum += wim_synth_axle(v->load_kg[a], front_mm - v->offset_mm[a]);
+    }
+    return sum;
+}
+
+/**
+ * @brief Samples a vehicle crossing the strip.
+ * @param v The vehicle.
+ * @param speed_mm_s Its speed.
+ * @param sample_us Sampling interval.
+ * @param baseline Idle level of the strip.
+ * @param first Sample index at which the front tyre reaches the strip.
+ * @param out Receives the samples.
+ * @param n Number of samples, from index 0.
+ */
+static inline void wim_synth_samples(const struct wim_synth_vehicle *v, uint32_t speed_mm_s,
+                                     uint32_t sample_us, uint16_t baseline, int64_t first,
+                                     uint16_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        int64_t front_mm = ((int64_t)i - first) * sample_us * speed_mm_s / 1000000;
+
+        out[i] = (uint16_t)MIN(baseline + wim_synth_response(v, (int32_t)front_mm), 4095U);
+    }
+}
+
+/**
+ * @brief Samples needed for a vehicle to clear the strip.
+ * @param v The vehicle.
+ * @param speed_mm_s Its speed.
+ * @param sample_us Sampling interval.
+ * @return The samples from the front tyre reaching the strip to the last leaving it.
+ */
+static inline uint32_t wim_synth_span(const struct wim_synth_vehicle *v, uint32_t speed_mm_s,
+                                      uint32_t sample_us)
+{
+    uint32_t mm = v->offset_mm[v->axles - 1U] + WIM_SYNTH_FOOTPRINT_MM;
+
+    return (uint32_t)(((uint64_t)mm * 1000000U) / ((uint64_t)speed_mm_s * sample_us)) + 1U;
+}
+
+#endif
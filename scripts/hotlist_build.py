@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Build a hotlist blob (include/hotlist.h format) from a list of plates.
+
+Usage: hotlist_build.py <plates.txt> <hotlist.bin> [--sequence N]
+
+The input holds one plate per line ('#' starts a comment). Plates are
+encoded like plate_id_from_str(); invalid ones are reported and skipped.
+The output can be memory-mapped on native_sim (CONFIG_RADAR_HOTLIST_FILE)
+or written to the hotlist_partition / hotlist_b_partition flash partitions.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x4C544F48
+VERSION = 1
+BLOOM_BITS_PER_ENTRY = 10
+BLOOM_HASHES = 7
+BLOOM_MIN_LOG2_BITS = 6
+BLOOM_MAX_LOG2_BITS = 31
+VALUE_BITS = 37
+MASK64 = (1 << 64) - 1
+
+# Mercosul layouts ('L' letter, 'N' digit) -> plate_country_t
+COUNTRIES = {
+    "LLLNLNN": 1,  # BR
+    "LLNNNLL": 2,  # AR
+    "LLLNNNN": 3,  # UY
+    "LLLLNNN": 4,  # PY car
+    "NNNLLLL": 5,  # PY moto
+    "LLNNNNN": 6,  # BO
+}
+
+
+def plate_key40(text):
+    """Return the 40-bit key of a plate (plate_id_key40()), or None."""
+    chars = [c for c in text.strip() if c not in " -_"]
+    if len(chars) != 7 or not all(c.isascii() and c.isalnum() for c in chars):
+        return None
+    signature = "".join("L" if c.isalpha() else "N" for c in chars)
+    country = COUNTRIES.get(signature)
+    if country is None:
+        return None
+    return (country << VALUE_BITS) | int("".join(chars), 36)
+
+
+def mix(key):
+    """splitmix64 finalizer, as hotlist_mix()."""
+    key ^= key >> 30
+    key = (key * 0xBF58476D1CE4E5B9) & MASK64
+    key ^= key >> 27
+    key = (key * 0x94D049BB133111EB) & MASK64
+    key ^= key >> 31
+    return key
+
+
+def build(keys, sequence):
+    keys = sorted(set(keys))
+    log2_bits = BLOOM_MIN_LOG2_BITS
+    while log2_bits < BLOOM_MAX_LOG2_BITS and (1 << log2_bits) < len(keys) * BLOOM_BITS_PER_ENTRY:
+        log2_bits += 1
+
+    mask = (1 << log2_bits) - 1
+    bloom = bytearray((1 << log2_bits) // 8)
+    for key in keys:
+        h = mix(key)
+        h1 = h & 0xFFFFFFFF
+        h2 = (h >> 32) | 1
+        for i in range(BLOOM_HASHES):
+            bit = (h1 + i * h2) & 0xFFFFFFFF & mask
+            bloom[bit >> 3] |= 1 << (bit & 7)
+
+    header = struct.pack("<IHBBII", MAGIC, VERSION, BLOOM_HASHES, log2_bits, len(keys), sequence)
+    plates = b"".join(key.to_bytes(5, "little") for key in keys)
+    return header + bytes(bloom) + plates, len(keys)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("plates")
+    parser.add_argument("output")
+    parser.add_argument("--sequence", type=int, default=1)
+    args = parser.parse_args()
+
+    keys = []
+    with open(args.plates, encoding="ascii", errors="replace") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            key = plate_key40(line)
+            if key is None:
+                print(f"{args.plates}:{lineno}: invalid plate '{line}', skipped", file=sys.stderr)
+                continue
+            keys.append(key)
+
+    blob, count = build(keys, args.sequence)
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    print(f"{args.output}: {count} plates, {len(blob)} bytes")
+
+
+if __name__ == "__main__":
+    main()
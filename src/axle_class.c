@@ -0,0 +1,82 @@
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "common.h"
+#include "axle_class.h"
+
+/*
+ * Class tree over the axle count and the first two spacings. Thresholds
+ * come from Kconfig; the shape follows the usual axle-based schemes:
+ * 2 axles split by wheelbase, a short wheelbase with more axles behind is
+ * a car towing a trailer, a long one a bus or truck.
+ */
+static const struct axle_class_node axle_class_tree[] = {
+    /* 0 */ { AXLE_FEATURE_AXLES, AXLE_CLASS_LEAF(VEHICLE_CLASS_UNKNOWN), 1, 1 },
+    /* 1 */ { AXLE_FEATURE_AXLES, 2, 5, 2 },
+    /* 2 */ { AXLE_FEATURE_SPACING_1, AXLE_CLASS_LEAF(VEHICLE_CLASS_MOTORCYCLE), 3,
+              CONFIG_RADAR_AXLE_MOTORCYCLE_MAX_CM },
+    /* 3 */ { AXLE_FEATURE_SPACING_1, AXLE_CLASS_LEAF(VEHICLE_CLASS_CAR), 4,
+              CONFIG_RADAR_AXLE_CAR_MAX_CM },
+    /* 4 */ { AXLE_FEATURE_SPACING_1, AXLE_CLASS_LEAF(VEHICLE_CLASS_TRUCK_2),
+              AXLE_CLASS_LEAF(VEHICLE_CLASS_BUS), CONFIG_RADAR_AXLE_BUS_MIN_CM - 1 },
+    /* 5 */ { AXLE_FEATURE_AXLES, 6, 9, 3 },
+    /* 6 */ { AXLE_FEATURE_SPACING_1, 7, 8, CONFIG_RADAR_AXLE_CAR_MAX_CM },
+    /* 7 */ { AXLE_FEATURE_SPACING_2, AXLE_CLASS_LEAF(VEHICLE_CLASS_TRUCK_3),
+              AXLE_CLASS_LEAF(VEHICLE_CLASS_CAR_TRAILER), CONFIG_RADAR_AXLE_TANDEM_MAX_CM },
+    /* 8 */ { AXLE_FEATURE_SPACING_1, AXLE_CLASS_LEAF(VEHICLE_CLASS_TRUCK_3),
+              AXLE_CLASS_LEAF(VEHICLE_CLASS_BUS), CONFIG_RADAR_AXLE_BUS_MIN_CM - 1 },
+    /* 9 */ { AXLE_FEATURE_AXLES, 10, AXLE_CLASS_LEAF(VEHICLE_CLASS_TRUCK_5PLUS), 4 },
+    /* 10 */ { AXLE_FEATURE_SPACING_1, AXLE_CLASS_LEAF(VEHICLE_CLASS_CAR_TRAILER),
+               AXLE_CLASS_LEAF(VEHICLE_CLASS_TRUCK_4), CONFIG_RADAR_AXLE_CAR_MAX_CM },
+};
+
+BUILD_ASSERT(CONFIG_RADAR_AXLE_MOTORCYCLE_MAX_CM < CONFIG_RADAR_AXLE_CAR_MAX_CM &&
+             CONFIG_RADAR_AXLE_CAR_MAX_CM < CONFIG_RADAR_AXLE_BUS_MIN_CM,
+             "wheelbase thresholds must increase");
+
+static const char *const vehicle_class_names[VEHICLE_CLASS_COUNT] = {
+    [VEHICLE_CLASS_UNKNOWN] = "unknown",
+    [VEHICLE_CLASS_MOTORCYCLE] = "motorcycle",
+    [VEHICLE_CLASS_CAR] = "car",
+    [VEHICLE_CLASS_CAR_TRAILER] = "car_trailer",
+    [VEHICLE_CLASS_VAN] = "van",
+    [VEHICLE_CLASS_BUS] = "bus",
+    [VEHICLE_CLASS_TRUCK_2] = "truck2",
+    [VEHICLE_CLASS_TRUCK_3] = "truck3",
+    [VEHICLE_CLASS_TRUCK_4] = "truck4",
+    [VEHICLE_CLASS_TRUCK_5PLUS] = "truck5",
+};
+
+vehicle_class_t axle_classify(uint32_t axle_count, const uint16_t *spacing_cm)
+{
+    const uint32_t features[] = {
+        [AXLE_FEATURE_AXLES] = axle_count,
+        [AXLE_FEATURE_SPACING_1] = spacing_cm[0],
+        [AXLE_FEATURE_SPACING_2] = spacing_cm[1],
+    };
+    uint8_t node = 0;
+
+    while ((node & AXLE_CLASS_LEAF(0)) == 0U) {
+        const struct axle_class_node *n = &axle_class_tree[node];
+
+        node = (features[n->feature] <= n->threshold) ? n->le : n->gt;
+    }
+    return (vehicle_class_t)(node & ~AXLE_CLASS_LEAF(0));
+}
+
+const char *vehicle_class_name(vehicle_class_t vclass)
+{
+    if (vclass >= VEHICLE_CLASS_COUNT) {
+        vclass = VEHICLE_CLASS_UNKNOWN;
+    }
+    return vehicle_class_names[vclass];
+}
+
+vehicle_class_t vehicle_class_from_name(const char *name)
+{
+    for (int c = 0; c < VEHICLE_CLASS_COUNT; c++) {
+        if (strcmp(name, vehicle_class_names[c]) == 0) {
+            return (vehicle_class_t)c;
+        }
+    }
+    return VEHICLE_CLASS_COUNT;
+}
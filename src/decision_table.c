@@ -0,0 +1,24 @@
+#include <zephyr/kernel.h>
+#include "common.h"
+#include "decision_table.h"
+
+void decision_table_build(struct decision_table *table, uint32_t distance_mm,
+                          const struct decision_class classes[DECISION_CLASSES])
+{
+    __ASSERT(distance_mm <= DECISION_MAX_DISTANCE_MM, "distance beyond the table");
+
+    for (uint32_t c = 0; c < DECISION_CLASSES; c++) {
+        table->classes[c] = classes[c];
+    }
+
+    for (uint32_t d = 0; d < DECISION_DIRECT_MS; d++) {
+        table->direct[d] = calculate_speed(distance_mm, d);
+    }
+
+    /* calculate_speed(D, d) >= s exactly when d <= 36 * D / (10 * s) */
+    table->tail_speeds = calculate_speed(distance_mm, DECISION_DIRECT_MS);
+    table->tail_max_ms[0] = UINT32_MAX;
+    for (uint32_t s = 1; s <= table->tail_speeds; s++) {
+        table->tail_max_ms[s] = (uint32_t)((36ULL * distance_mm) / (10ULL * s));
+    }
+}
@@ -2,6 +2,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/display.h>
 #include "common.h"
+#include "axle_class.h"
 
 LOG_MODULE_REGISTER(display_thread, LOG_LEVEL_INF);
 
@@ -71,14 +72,19 @@ void display_thread_entry(void *p1, void *p2, void *p3) {
                     case VEHICLE_UNKNOWN: default: tipo = "Desconhecido"; break;
                 }
                 printk(" Veiculo: %s", tipo);
+                if (data.vclass != VEHICLE_CLASS_UNKNOWN) {
+                    printk(" [%s]", vehicle_class_name(data.vclass));
+                }
             }
             if (data.axle_count > 0) {
                 printk(" (Eixos: %d)", data.axle_count);
             }
             printk("\n");
             
-            if (data.plate[0] != '\0') {
-                printk(" Placa: %s\n", data.plate);
+            if (plate_id_is_valid(data.plate)) {
+                char plate_text[PLATE_TEXT_SIZE];
+                (void)plate_id_to_str(data.plate, plate_text, sizeof(plate_text));
+                printk(" Placa: %s\n", plate_text);
             }
             printk("%s========================================%s\n\n", color, ANSI_COLOR_RESET);
         }
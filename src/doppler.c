@@ -0,0 +1,200 @@
+#include <zephyr/kernel.h>
+#include <math.h>
+#include "doppler.h"
+
+/* Speed of light, m/s */
+#define DOPPLER_C_M_S 299792458ULL
+
+/**
+ * @brief Q15 from a value in [-1, 1], saturated.
+ */
+static int16_t doppler_q15(double x)
+{
+    long v = lround(x * 32768.0);
+
+    return (int16_t)CLAMP(v, INT16_MIN, INT16_MAX);
+}
+
+/**
+ * @brief Integer square root.
+ * @param x The value.
+ * @return floor(sqrt(x)).
+ */
+static uint32_t doppler_isqrt(uint32_t x)
+{
+    uint32_t r = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0U) {
+        if (x >= r + bit) {
+            x -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+int doppler_init(struct doppler *d, uint16_t points, uint32_t sample_rate_hz,
+                 uint32_t carrier_mhz, uint32_t min_kmh)
+{
+    if (points < 16U || points > DOPPLER_MAX_POINTS || (points & (points - 1U)) != 0U ||
+        sample_rate_hz == 0U || carrier_mhz == 0U) {
+        return -EINVAL;
+    }
+
+    d->points = points;
+    d->log2_points = (uint8_t)(31 - __builtin_clz(points));
+    d->sample_rate_hz = sample_rate_hz;
+    /* v = f c / 2 f0, and 1 m/s is 360 ckm/h */
+    d->ckmh_per_hz_q24 = ((DOPPLER_C_M_S * 180U) << 24) / ((uint64_t)carrier_mhz * 1000000U);
+
+    /* Hann leaks DC into the two bins beside it; never report those */
+    uint32_t min_bin = (uint32_t)DIV_ROUND_UP(((uint64_t)min_kmh * 100U << 24) * points,
+                                              d->ckmh_per_hz_q24 * sample_rate_hz);
+    d->min_bin = (uint16_t)CLAMP(min_bin, 2U, points / 2U - 2U);
+
+    for (uint32_t n = 0; n < points; n++) {
+        d->window[n] = doppler_q15(0.5 * (1.0 - cos(2.0 * M_PI * n / points)));
+    }
+    for (uint32_t k = 0; k < points / 2U; k++) {
+        d->twiddle[k].i = doppler_q15(cos(2.0 * M_PI * k / points));
+        d->twiddle[k].q = doppler_q15(-sin(2.0 * M_PI * k / points));
+    }
+    return 0;
+}
+
+void doppler_fft(const struct doppler *d, struct doppler_iq *x)
+{
+    const uint32_t n = d->points;
+
+    /* Bit-reversed order in, natural order out */
+    for (uint32_t i = 1, j = 0; i < n; i++) {
+        uint32_t bit = n >> 1;
+
+        for (; (j & bit) != 0U; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+        if (i < j) {
+            struct doppler_iq t = x[i];
+
+            x[i] = x[j];
+            x[j] = t;
+        }
+    }
+
+    /* Every stage halves, so magnitudes never grow past the input's */
+    for (uint32_t half = 1, step = n >> 1; half < n; half <<= 1, step >>= 1) {
+        for (uint32_t i = 0; i < n; i += half << 1) {
+            for (uint32_t j = 0; j < half; j++) {
+                const struct doppler_iq w = d->twiddle[j * step];
+                struct doppler_iq *a = &x[i + j];
+                struct doppler_iq *b = &x[i + j + half];
+                int32_t tr = ((int32_t)b->i * w.i - (int32_t)b->q * w.q + (1 << 14)) >> 15;
+                int32_t ti = ((int32_t)b->i * w.q + (int32_t)b->q * w.i + (1 << 14)) >> 15;
+
+                b->i = (int16_t)((a->i - tr) >> 1);
+                b->q = (int16_t)((a->q - ti) >> 1);
+                a->i = (int16_t)((a->i + tr) >> 1);
+                a->q = (int16_t)((a->q + ti) >> 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Power of a bin.
+ */
+static inline uint32_t doppler_power(const struct doppler_iq *x)
+{
+    return (uint32_t)((int32_t)x->i * x->i) + (uint32_t)((int32_t)x->q * x->q);
+}
+
+int doppler_measure(struct doppler *d, const struct doppler_iq *frame, uint32_t min_snr,
+                    struct doppler_result *out)
+{
+    const uint32_t n = d->points;
+    struct doppler_iq *x = d->work;
+    uint64_t total = 0;
+    uint32_t peak_power = 0;
+    uint32_t peak = d->min_bin;
+    uint32_t bins = 0;
+
+    /* Window at half scale: a full-scale complex sample then stays in range */
+    for (uint32_t i = 0; i < n; i++) {
+        x[i].i = (int16_t)(((int32_t)frame[i].i * d->window[i]) >> 16);
+        x[i].q = (int16_t)(((int32_t)frame[i].q * d->window[i]) >> 16);
+    }
+    doppler_fft(d, x);
+
+    /* Both halves past the clutter: approaching, then receding */
+    for (uint32_t k = d->min_bin; k <= n - d->min_bin; k++) {
+        uint32_t p = doppler_power(&x[k]);
+
+        total += p;
+        bins++;
+        if (p > peak_power) {
+            peak_power = p;
+            peak = k;
+        }
+    }
+
+    /* A peak on the clutter edge may be the skirt of a slower target */
+    uint32_t left = doppler_power(&x[peak - 1U]);
+    uint32_t right = doppler_power(&x[peak + 1U]);
+
+    if (peak_power == 0U || left > peak_power || right > peak_power) {
+        return -ENODATA;
+    }
+
+    /* The peak's own skirt does not count as noise */
+    uint64_t others = total - peak_power - MIN((uint64_t)left + right, total - peak_power);
+
+    if (peak_power * (uint64_t)(bins - 3U) < (uint64_t)min_snr * others) {
+        return -ENODATA;
+    }
+
+    /* Interpolate towards the larger neighbour (Hann window estimator) */
+    uint32_t m = doppler_isqrt(peak_power);
+    uint32_t a = doppler_isqrt(left);
+    uint32_t c = doppler_isqrt(right);
+    int32_t delta_q8 = (c >= a) ? (int32_t)((256 * (2 * (int64_t)c - m)) / (c + m)) :
+                                  -(int32_t)((256 * (2 * (int64_t)a - m)) / (a + m));
+    delta_q8 = CLAMP(delta_q8, -128, 128);
+
+    out->approaching = (peak < n / 2U);
+    int32_t bin_q8 = out->approaching ? (int32_t)(peak << 8) + delta_q8 :
+                                        (int32_t)((n - peak) << 8) - delta_q8;
+
+    out->freq_hz_q8 = (uint32_t)(((uint64_t)bin_q8 * d->sample_rate_hz) >> d->log2_points);
+    out->speed_ckmh = (uint32_t)(((uint64_t)out->freq_hz_q8 * d->ckmh_per_hz_q24 +
+                                  (1ULL << 31)) >> 32);
+    out->snr = (others == 0U) ? UINT32_MAX :
+               (uint32_t)MIN(peak_power * (uint64_t)(bins - 3U) / others, UINT32_MAX);
+    return 0;
+}
+
+uint32_t doppler_fuse_ckmh(uint32_t loop_ckmh, uint32_t doppler_ckmh,
+                           uint32_t max_disagree_percent, uint32_t doppler_weight_percent)
+{
+    if (doppler_ckmh == 0U) {
+        return loop_ckmh;
+    }
+    if (loop_ckmh == 0U) {
+        return doppler_ckmh;
+    }
+    uint32_t diff = (doppler_ckmh > loop_ckmh) ? doppler_ckmh - loop_ckmh :
+                                                 loop_ckmh - doppler_ckmh;
+
+    if ((uint64_t)diff * 100U > (uint64_t)loop_ckmh * max_disagree_percent) {
+        return loop_ckmh;
+    }
+    return (uint32_t)(((uint64_t)loop_ckmh * (100U - doppler_weight_percent) +
+                       (uint64_t)doppler_ckmh * doppler_weight_percent + 50U) / 100U);
+}
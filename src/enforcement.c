@@ -0,0 +1,378 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#include <string.h>
+#include "common.h"
+#include "threads.h"
+#include "enforcement.h"
+#include <camera_service.h>
+#include "infraction_log.h"
+#include "hotlist.h"
+#include "sha256.h"
+#include "section_control.h"
+#include "speed_stats.h"
+#include "rrd.h"
+#include "lane_pool.h"
+#include "pcpu_counter.h"
+#include "policy.h"
+#include "doppler.h"
+
+LOG_MODULE_REGISTER(main_control, LOG_LEVEL_INF);
+
+/**
+ * @brief Subscriber for the Enforcement Thread. Queues every result: with
+ * the pool, several captures are in flight at once.
+ */
+ZBUS_MSG_SUBSCRIBER_DEFINE(main_camera_msub);
+
+/**
+ * @brief Telemetry Counters
+ */
+static struct pcpu_counter vehicle_light_count;
+static struct pcpu_counter vehicle_heavy_count;
+static struct pcpu_counter status_normal_count;
+static struct pcpu_counter status_warning_count;
+static struct pcpu_counter status_infraction_count;
+static struct pcpu_counter hotlist_hit_count;
+
+/* > Pending Infraction Context */
+typedef struct {
+	bool active;
+	int64_t timestamp_ms;
+	uint32_t speed_kmh;
+	uint32_t limit_kmh;
+	vehicle_type_t type;
+	vehicle_class_t vclass;
+} pending_infraction_t;
+
+/* > Section Control Context: every vehicle is photographed */
+typedef struct {
+	int64_t read_ms;
+	vehicle_class_t vclass;
+} section_read_t;
+
+/* > One capture awaiting its result, found by its request id */
+typedef struct {
+	bool waiting;
+	uint32_t request_id;
+	pending_infraction_t infraction;
+	section_read_t section_read;
+} pending_capture_t;
+
+/* Captures in flight at once: one per pool worker is plenty */
+#define ENFORCEMENT_PENDING_CAPTURES 8U
+
+static pending_capture_t pending_captures[ENFORCEMENT_PENDING_CAPTURES];
+static uint32_t next_request_id;
+
+/* Pool workers set the contexts while the thread reads them */
+static struct k_spinlock ctx_lock;
+
+/**
+ * @brief Queues a display update, dropping the oldest one when the queue is full.
+ * @param d_data The update to show.
+ */
+static void display_push(const display_data_t *d_data)
+{
+    if (k_msgq_put(&display_msgq, d_data, K_NO_WAIT) == 0) {
+        return;
+    }
+
+    display_data_t dropped;
+    (void)k_msgq_get(&display_msgq, &dropped, K_NO_WAIT);
+    if (k_msgq_put(&display_msgq, d_data, K_NO_WAIT) != 0) {
+        LOG_WRN("display_msgq full, dropping update");
+    }
+}
+
+/**
+ * @brief Checks a valid plate read against the hotlist and raises an alert.
+ * @param plate The plate read by the camera.
+ * @param speed_kmh The measured speed of the vehicle.
+ */
+static void hotlist_check(plate_id_t plate, uint32_t speed_kmh)
+{
+    if (!IS_ENABLED(CONFIG_RADAR_HOTLIST) || !hotlist_contains(plate)) {
+        return;
+    }
+
+    struct hotlist_alert alert = {
+        .plate = plate,
+        .timestamp_ms = k_uptime_get(),
+        .speed_kmh = speed_kmh,
+    };
+    pcpu_counter_inc(&hotlist_hit_count);
+    LOG_WRN("HOTLIST MATCH: wanted vehicle detected at %u km/h", speed_kmh);
+    if (zbus_chan_pub(&hotlist_alert_chan, &alert, K_NO_WAIT) != 0) {
+        LOG_WRN("hotlist_alert_chan busy, alert not published");
+    }
+}
+
+void enforcement_init(void)
+{
+	/* Subscribe to the camera service event channel */
+    zbus_chan_add_obs(&chan_camera_evt, &main_camera_msub, K_FOREVER);
+
+    /* Stored limits replace the Kconfig defaults; on error the defaults stay */
+    (void)policy_init();
+
+    if (IS_ENABLED(CONFIG_RADAR_HOTLIST)) {
+        (void)hotlist_load_default();
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_SPEED_STATS)) {
+        speed_stats_init(k_uptime_get());
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_RRD)) {
+        rrd_init(k_uptime_get());
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_ENFORCEMENT_POOL)) {
+        (void)lane_pool_init(enforcement_handle_measurement);
+    }
+}
+
+void enforcement_handle_measurement(const sensor_data_t *s_data)
+{
+    /* One policy for the whole decision, even if it is replaced meanwhile */
+    const struct radar_policy *policy = policy_acquire();
+    uint32_t speed_ckmh = s_data->fit_speed_ckmh;
+    uint32_t speed_kmh;
+    uint32_t limit;
+    display_status_t status;
+
+    if (IS_ENABLED(CONFIG_RADAR_DOPPLER) && s_data->doppler_speed_ckmh != 0U) {
+        /* Fused with the loop fit, else with the transit speed */
+        if (speed_ckmh == 0U && s_data->duration_ms != 0U) {
+            speed_ckmh = (uint32_t)((uint64_t)policy->v.distance_mm * 360U /
+                                    s_data->duration_ms);
+        }
+        speed_ckmh = doppler_fuse_ckmh(speed_ckmh, s_data->doppler_speed_ckmh,
+                                       CONFIG_RADAR_DOPPLER_MAX_DISAGREE_PERCENT,
+                                       CONFIG_RADAR_DOPPLER_WEIGHT_PERCENT);
+    }
+
+    if (speed_ckmh != 0U) {
+        /* Fitted over the loop array or fused with the radar, truncated
+         * like the transit speed is
+         */
+        speed_kmh = speed_ckmh / 100U;
+        status = policy_decide_speed(policy, speed_kmh, s_data->vclass, &limit);
+    } else {
+        status = policy_decide(policy, s_data->duration_ms, s_data->vclass, &speed_kmh,
+                               &limit);
+    }
+    uint32_t warning_kmh = policy_warning_kmh(policy, s_data->vclass);
+
+    policy_release(policy);
+
+    LOG_INF("Speed Calc: %d km/h (Limit: %d). Status: %d", speed_kmh, limit, status);
+
+    if (IS_ENABLED(CONFIG_RADAR_SPEED_STATS)) {
+        (void)speed_stats_add(s_data->lane, speed_kmh, s_data->timestamp_end);
+    }
+
+    display_data_t d_data;
+    d_data.speed_kmh = speed_kmh;
+    d_data.limit_kmh = limit;
+    d_data.type = s_data->type;
+    d_data.vclass = s_data->vclass;
+    d_data.status = status;
+    d_data.plate = PLATE_ID_NONE;
+    d_data.axle_count = s_data->axle_count;
+    d_data.warning_kmh = warning_kmh;
+
+    if (s_data->type == VEHICLE_LIGHT) {
+        pcpu_counter_inc(&vehicle_light_count);
+    } else if (s_data->type == VEHICLE_HEAVY) {
+        pcpu_counter_inc(&vehicle_heavy_count);
+    }
+    switch (status) {
+        case STATUS_NORMAL: pcpu_counter_inc(&status_normal_count); break;
+        case STATUS_WARNING: pcpu_counter_inc(&status_warning_count); break;
+        case STATUS_INFRACTION: pcpu_counter_inc(&status_infraction_count); break;
+    }
+    if (IS_ENABLED(CONFIG_RADAR_RRD)) {
+        int64_t now = k_uptime_get();
+        if (s_data->type == VEHICLE_LIGHT || s_data->type == VEHICLE_HEAVY) {
+            rrd_add((s_data->type == VEHICLE_LIGHT) ? RRD_VEHICLE_LIGHT : RRD_VEHICLE_HEAVY,
+                    now, 1);
+        }
+        rrd_add((enum rrd_metric)(RRD_STATUS_NORMAL + status), now, 1);
+    }
+
+    /* Send the display data to the display queue */
+    display_push(&d_data);
+
+    if (status != STATUS_INFRACTION && !IS_ENABLED(CONFIG_RADAR_SECTION_CONTROL)) {
+        return;
+    }
+
+    /* Each capture keeps its own context: workers may capture at once */
+    k_spinlock_key_t key = k_spin_lock(&ctx_lock);
+    uint32_t request_id = next_request_id++;
+    pending_capture_t *pending = &pending_captures[request_id % ENFORCEMENT_PENDING_CAPTURES];
+    bool unanswered = pending->waiting;
+
+    pending->waiting = true;
+    pending->request_id = request_id;
+    if (IS_ENABLED(CONFIG_RADAR_SECTION_CONTROL)) {
+        pending->section_read.read_ms = section_control_now_ms();
+        pending->section_read.vclass = s_data->vclass;
+    }
+    if (status == STATUS_INFRACTION) {
+        /* Record pending infraction context */
+        pending->infraction.active = true;
+        pending->infraction.timestamp_ms = k_uptime_get();
+        pending->infraction.speed_kmh = speed_kmh;
+        pending->infraction.limit_kmh = limit;
+        pending->infraction.type = s_data->type;
+        pending->infraction.vclass = s_data->vclass;
+    } else {
+        /* Section control needs the plate of every vehicle */
+        pending->infraction.active = false;
+    }
+    k_spin_unlock(&ctx_lock, key);
+
+    if (unanswered) {
+        LOG_WRN("Capture %u never answered, context reused",
+                request_id - ENFORCEMENT_PENDING_CAPTURES);
+    }
+
+    {
+        int cap_ret = camera_api_capture(request_id, K_MSEC(200));
+        if (cap_ret != 0) {
+            LOG_WRN("camera_api_capture failed: %d", cap_ret);
+            key = k_spin_lock(&ctx_lock);
+            if (pending->request_id == request_id) {
+                pending->waiting = false;
+            }
+            k_spin_unlock(&ctx_lock, key);
+        }
+    }
+}
+
+void enforcement_handle_camera(const struct msg_camera_evt *evt)
+{
+    /* Take the context of the capture this result answers */
+    pending_capture_t *slot = &pending_captures[evt->request_id % ENFORCEMENT_PENDING_CAPTURES];
+    pending_infraction_t pending;
+    section_read_t section_read;
+    k_spinlock_key_t key = k_spin_lock(&ctx_lock);
+
+    if (!slot->waiting || slot->request_id != evt->request_id) {
+        /* Already answered, or its context was reused */
+        k_spin_unlock(&ctx_lock, key);
+        return;
+    }
+    pending = slot->infraction;
+    section_read = slot->section_read;
+    slot->waiting = false;
+    k_spin_unlock(&ctx_lock, key);
+
+    /* Validate and encode the plate once, at capture time */
+    plate_id_t plate = PLATE_ID_NONE;
+    if (evt->type == MSG_CAMERA_EVT_TYPE_DATA) {
+        plate = plate_id_from_str(evt->captured_data.plate);
+    }
+
+    /* Only plates whose hash matches are usable as evidence */
+    if (IS_ENABLED(CONFIG_RADAR_VERIFY_PLATE_HASH) && plate_id_is_valid(plate) &&
+        !sha256_verify(evt->captured_data.plate, strlen(evt->captured_data.plate),
+                       evt->captured_data.hash)) {
+        LOG_WRN("Plate hash mismatch: %s", evt->captured_data.plate);
+        plate = PLATE_ID_NONE;
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_RRD)) {
+        rrd_add(plate_id_is_valid(plate) ? RRD_CAMERA_VALID : RRD_CAMERA_INVALID,
+                k_uptime_get(), 1);
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_SECTION_CONTROL) && plate_id_is_valid(plate)) {
+        section_control_on_read(plate, section_read.read_ms, section_read.vclass);
+    }
+
+    if (IS_ENABLED(CONFIG_RADAR_SECTION_CONTROL) && !pending.active) {
+        /* Section-only capture: no spot infraction to record */
+        return;
+    }
+
+    if (plate_id_is_valid(plate)) {
+        LOG_INF("Valid Plate: %s. Infraction Recorded.", evt->captured_data.plate);
+        hotlist_check(plate, pending.active ? pending.speed_kmh : 0);
+    } else {
+        LOG_WRN("Invalid Plate or camera error");
+    }
+
+    infraction_record_t rec = {
+        .timestamp_ms = pending.active ? pending.timestamp_ms : k_uptime_get(),
+        .type = pending.active ? pending.type : VEHICLE_UNKNOWN,
+        .vclass = pending.active ? pending.vclass : VEHICLE_CLASS_UNKNOWN,
+        .speed_kmh = pending.active ? pending.speed_kmh : 0,
+        .limit_kmh = pending.active ? pending.limit_kmh : 0,
+        .valid_read = plate_id_is_valid(plate),
+        .plate = plate
+    };
+    infraction_log_add(&rec);
+
+    display_data_t d_data;
+    d_data.speed_kmh = rec.speed_kmh;
+    d_data.limit_kmh = rec.limit_kmh;
+    d_data.type = rec.type;
+    d_data.vclass = rec.vclass;
+    d_data.status = STATUS_INFRACTION;
+    d_data.axle_count = 0;
+    const struct radar_policy *policy = policy_acquire();
+    d_data.warning_kmh = policy_warning_kmh(policy, rec.vclass);
+    policy_release(policy);
+    d_data.plate = plate;
+    display_push(&d_data);
+}
+
+void enforcement_get_counters(struct enforcement_counters *out)
+{
+    out->light = pcpu_counter_get(&vehicle_light_count);
+    out->heavy = pcpu_counter_get(&vehicle_heavy_count);
+    out->normal = pcpu_counter_get(&status_normal_count);
+    out->warning = pcpu_counter_get(&status_warning_count);
+    out->infraction = pcpu_counter_get(&status_infraction_count);
+    out->hotlist_hits = pcpu_counter_get(&hotlist_hit_count);
+}
+
+void enforcement_thread_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    enforcement_init();
+
+    sensor_data_t s_data;
+    const struct zbus_channel *chan;
+
+    while (1) {
+        if (IS_ENABLED(CONFIG_RADAR_ENFORCEMENT_POOL)) {
+            /* Dispatch everything queued; the workers do the heavy lifting */
+            while (k_msgq_get(&sensor_msgq, &s_data, K_NO_WAIT) == 0) {
+                /* The lane is backed up: hold the vehicle, do not drop it */
+                while (lane_pool_submit(&s_data) == -ENOBUFS) {
+                    k_msleep(1);
+                }
+            }
+        } else if (k_msgq_get(&sensor_msgq, &s_data, K_NO_WAIT) == 0) {
+            enforcement_handle_measurement(&s_data);
+        }
+
+        /* Handle every camera result queued since the last poll */
+        struct msg_camera_evt evt;
+        while (zbus_sub_wait_msg(&main_camera_msub, &chan, &evt, K_NO_WAIT) == 0) {
+            if (chan == &chan_camera_evt) {
+                enforcement_handle_camera(&evt);
+            }
+        }
+
+        k_msleep(10);
+    }
+}
@@ -0,0 +1,120 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/zbus/zbus.h>
+#include <string.h>
+#include "flow_metrics.h"
+
+#define FLOW_LANES CONFIG_RADAR_LANE_COUNT
+
+ZBUS_CHAN_DEFINE(flow_metrics_chan, struct flow_snapshot, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.volume = 0));
+
+/* > Per-lane accumulator: shared counters are atomics, drained by swapping in 0 */
+struct flow_lane {
+    atomic_t volume;
+    atomic_t headway_sum_ms;
+    atomic_t headway_count;
+    atomic_t gap_sum_ms;
+    atomic_t occupied_ms;
+    /* Writer-private: the previous vehicle on this lane */
+    int64_t prev_front_ms;
+    int64_t prev_rear_ms;
+    bool has_prev;
+    /* Reader-private: start of the current interval */
+    int64_t interval_start_ms;
+};
+
+static struct flow_lane flow_lanes[FLOW_LANES];
+
+/**
+ * @brief Clears every lane.
+ * @param now_ms Start of the first interval.
+ */
+void flow_metrics_reset(int64_t now_ms)
+{
+    memset(flow_lanes, 0, sizeof(flow_lanes));
+    for (uint8_t lane = 0; lane < FLOW_LANES; lane++) {
+        flow_lanes[lane].interval_start_ms = now_ms;
+    }
+}
+
+/**
+ * @brief Accounts a vehicle crossing the start sensor.
+ * @param lane The lane.
+ * @param front_ms First axle over the start sensor.
+ * @param rear_ms Last axle over the start sensor.
+ * @return 0 on success, -EINVAL otherwise.
+ */
+int flow_metrics_vehicle(uint8_t lane, int64_t front_ms, int64_t rear_ms)
+{
+    if (lane >= FLOW_LANES || rear_ms < front_ms) {
+        return -EINVAL;
+    }
+
+    struct flow_lane *fl = &flow_lanes[lane];
+
+    /* Headway and gap need a predecessor, and vehicles arrive in order */
+    if (fl->has_prev && front_ms >= fl->prev_front_ms) {
+        (void)atomic_add(&fl->headway_sum_ms, (atomic_val_t)(front_ms - fl->prev_front_ms));
+        (void)atomic_add(&fl->gap_sum_ms,
+                         (atomic_val_t)MAX(front_ms - fl->prev_rear_ms, 0));
+        (void)atomic_inc(&fl->headway_count);
+    }
+    (void)atomic_add(&fl->occupied_ms, (atomic_val_t)(rear_ms - front_ms));
+    (void)atomic_inc(&fl->volume);
+
+    fl->prev_front_ms = front_ms;
+    fl->prev_rear_ms = rear_ms;
+    fl->has_prev = true;
+    return 0;
+}
+
+/**
+ * @brief Takes a lane's metrics since the previous snapshot and restarts them.
+ * Each counter is swapped with 0 on its own, so a vehicle accounted during
+ * the snapshot may split across two intervals but is never lost.
+ * @param lane The lane.
+ * @param now_ms The end of the interval.
+ * @param out Receives the snapshot.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int flow_metrics_snapshot(uint8_t lane, int64_t now_ms, struct flow_snapshot *out)
+{
+    if (lane >= FLOW_LANES) {
+        return -EINVAL;
+    }
+
+    struct flow_lane *fl = &flow_lanes[lane];
+    uint32_t volume = (uint32_t)atomic_set(&fl->volume, 0);
+    uint32_t headway_sum = (uint32_t)atomic_set(&fl->headway_sum_ms, 0);
+    uint32_t gap_sum = (uint32_t)atomic_set(&fl->gap_sum_ms, 0);
+    uint32_t pairs = (uint32_t)atomic_set(&fl->headway_count, 0);
+    uint32_t occupied = (uint32_t)atomic_set(&fl->occupied_ms, 0);
+    uint32_t interval = (uint32_t)MAX(now_ms - fl->interval_start_ms, 1);
+
+    out->start_ms = fl->interval_start_ms;
+    out->interval_ms = interval;
+    out->lane = lane;
+    out->volume = volume;
+    out->flow_veh_h = (uint32_t)((uint64_t)volume * 3600000U / interval);
+    out->mean_headway_ms = (pairs > 0U) ? headway_sum / pairs : 0U;
+    out->mean_gap_ms = (pairs > 0U) ? gap_sum / pairs : 0U;
+    out->occupancy_permille = (uint16_t)MIN((uint64_t)occupied * 1000U / interval, 1000U);
+
+    fl->interval_start_ms = now_ms;
+    return 0;
+}
+
+/**
+ * @brief Snapshots every lane and publishes the results on flow_metrics_chan.
+ * @param now_ms The end of the interval.
+ */
+void flow_metrics_publish(int64_t now_ms)
+{
+    for (uint8_t lane = 0; lane < FLOW_LANES; lane++) {
+        struct flow_snapshot snap;
+
+        (void)flow_metrics_snapshot(lane, now_ms, &snap);
+        (void)zbus_chan_pub(&flow_metrics_chan, &snap, K_MSEC(100));
+    }
+}
@@ -0,0 +1,413 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hotlist.h"
+#include "snapshot.h"
+
+#if !defined(CONFIG_NATIVE_LIBRARY)
+#include <zephyr/storage/flash_map.h>
+#endif
+
+LOG_MODULE_REGISTER(hotlist, LOG_LEVEL_INF);
+
+/* > Published hotlist: views into an immutable blob */
+struct hotlist_table {
+    struct snapshot_obj snap;
+    const uint8_t *bloom;
+    uint32_t bloom_mask;
+    uint8_t bloom_hashes;
+    const uint8_t *plates;
+    uint32_t count;
+};
+
+static struct hotlist_table tables[2];
+static struct snapshot hotlist_current;
+static K_MUTEX_DEFINE(hotlist_reload_lock);
+
+ZBUS_CHAN_DEFINE(hotlist_alert_chan, struct hotlist_alert, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.plate = PLATE_ID_NONE));
+
+/**
+ * @brief Mixes a 40-bit plate key into 64 well-distributed bits (splitmix64).
+ */
+static inline uint64_t hotlist_mix(uint64_t key)
+{
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
+/**
+ * @brief Tests or sets the Bloom filter bits of a key (double hashing).
+ * @param bloom The filter bits.
+ * @param mask The number of filter bits minus one.
+ * @param hashes The number of hash functions.
+ * @param key The 40-bit plate key.
+ * @param set True to set the bits, false to test them.
+ * @return True if every bit was set.
+ */
+static inline bool hotlist_bloom_apply(uint8_t *bloom, uint32_t mask, uint32_t hashes,
+                                       uint64_t key, bool set)
+{
+    uint64_t h = hotlist_mix(key);
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 32) | 1U;
+
+    for (uint32_t i = 0; i < hashes; i++) {
+        uint32_t bit = (h1 + i * h2) & mask;
+
+        if (set) {
+            bloom[bit >> 3] |= (uint8_t)BIT(bit & 7U);
+        } else if ((bloom[bit >> 3] & BIT(bit & 7U)) == 0U) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Binary search over the packed, sorted plate array.
+ */
+static bool hotlist_search(const struct hotlist_table *t, uint64_t key)
+{
+    const uint8_t *base = t->plates;
+    size_t n = t->count;
+
+    if (n == 0U) {
+        return false;
+    }
+    /* Branchless lower bound: the loop length only depends on the count */
+    while (n > 1U) {
+        size_t half = n / 2U;
+
+        /* Fetch both possible next probes while this one resolves */
+        __builtin_prefetch(base + (half / 2U) * PLATE_ID_PACKED_SIZE);
+        __builtin_prefetch(base + (half + half / 2U) * PLATE_ID_PACKED_SIZE);
+        base = (plate_id_packed_key40(base + (half - 1U) * PLATE_ID_PACKED_SIZE) < key) ?
+               base + half * PLATE_ID_PACKED_SIZE : base;
+        n -= half;
+    }
+    return plate_id_packed_key40(base) == key;
+}
+
+/**
+ * @brief Orders plates by their 40-bit key (qsort comparator).
+ */
+static int hotlist_cmp(const void *a, const void *b)
+{
+    uint64_t ka = plate_id_key40(*(const plate_id_t *)a);
+    uint64_t kb = plate_id_key40(*(const plate_id_t *)b);
+
+    return (ka > kb) - (ka < kb);
+}
+
+/**
+ * @brief Builds a hotlist blob from a set of plates.
+ * @param ids The plates; sorted and de-duplicated in place.
+ * @param n The number of plates.
+ * @param sequence The sequence number stored in the header.
+ * @param buf The output buffer.
+ * @param buf_len The size of the output buffer.
+ * @param out_len Receives the size of the blob.
+ * @return 0 on success, negative errno otherwise.
+ */
+int hotlist_build(plate_id_t *ids, size_t n, uint32_t sequence, uint8_t *buf, size_t buf_len,
+                  size_t *out_len)
+{
+    if ((ids == NULL && n > 0U) || buf == NULL || out_len == NULL || n > UINT32_MAX) {
+        return -EINVAL;
+    }
+
+    qsort(ids, n, sizeof(ids[0]), hotlist_cmp);
+    size_t unique = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!plate_id_is_valid(ids[i])) {
+            continue;
+        }
+        if (unique == 0U || ids[i] != ids[unique - 1U]) {
+            ids[unique++] = ids[i];
+        }
+    }
+
+    uint32_t log2_bits = HOTLIST_BLOOM_MIN_LOG2_BITS;
+    while (log2_bits < HOTLIST_BLOOM_MAX_LOG2_BITS &&
+           (1ULL << log2_bits) < (uint64_t)unique * HOTLIST_BLOOM_BITS_PER_ENTRY) {
+        log2_bits++;
+    }
+
+    size_t bloom_len = (size_t)(1ULL << log2_bits) / 8U;
+    size_t len = sizeof(struct hotlist_header) + bloom_len + unique * PLATE_ID_PACKED_SIZE;
+    if (len > buf_len) {
+        return -ENOMEM;
+    }
+
+    struct hotlist_header hdr = {
+        .magic = sys_cpu_to_le32(HOTLIST_MAGIC),
+        .version = sys_cpu_to_le16(HOTLIST_VERSION),
+        .bloom_hashes = HOTLIST_BLOOM_HASHES,
+        .bloom_log2_bits = (uint8_t)log2_bits,
+        .count = sys_cpu_to_le32((uint32_t)unique),
+        .sequence = sys_cpu_to_le32(sequence),
+    };
+    uint8_t *bloom = buf + sizeof(hdr);
+    uint8_t *plates = bloom + bloom_len;
+
+    memcpy(buf, &hdr, sizeof(hdr));
+    memset(bloom, 0, bloom_len);
+    for (size_t i = 0; i < unique; i++) {
+        hotlist_bloom_apply(bloom, (uint32_t)((1ULL << log2_bits) - 1U), HOTLIST_BLOOM_HASHES,
+                            plate_id_key40(ids[i]), true);
+        plate_id_pack40(ids[i], plates + i * PLATE_ID_PACKED_SIZE);
+    }
+
+    *out_len = len;
+    return 0;
+}
+
+/**
+ * @brief Parses and checks a hotlist blob header.
+ * @param blob The blob.
+ * @param len The size of the blob.
+ * @param out Receives the decoded header.
+ * @return 0 if the header and sizes are consistent, -EINVAL otherwise.
+ */
+static int hotlist_parse_header(const uint8_t *blob, size_t len, struct hotlist_header *out)
+{
+    if (blob == NULL || len < sizeof(*out)) {
+        return -EINVAL;
+    }
+
+    memcpy(out, blob, sizeof(*out));
+    out->magic = sys_le32_to_cpu(out->magic);
+    out->version = sys_le16_to_cpu(out->version);
+    out->count = sys_le32_to_cpu(out->count);
+    out->sequence = sys_le32_to_cpu(out->sequence);
+
+    if (out->magic != HOTLIST_MAGIC || out->version != HOTLIST_VERSION ||
+        out->bloom_hashes == 0U || out->bloom_hashes > 16U ||
+        out->bloom_log2_bits < HOTLIST_BLOOM_MIN_LOG2_BITS ||
+        out->bloom_log2_bits > HOTLIST_BLOOM_MAX_LOG2_BITS) {
+        return -EINVAL;
+    }
+
+    uint64_t need = sizeof(*out) + (1ULL << out->bloom_log2_bits) / 8U +
+                    (uint64_t)out->count * PLATE_ID_PACKED_SIZE;
+    return (need <= len) ? 0 : -EINVAL;
+}
+
+/**
+ * @brief Validates a hotlist blob and swaps it in atomically.
+ * @param blob The hotlist blob.
+ * @param len The size of the blob.
+ * @return 0 on success, -EINVAL if the blob is malformed.
+ */
+int hotlist_load(const void *blob, size_t len)
+{
+    struct hotlist_header hdr;
+    const uint8_t *bytes = blob;
+
+    if (hotlist_parse_header(bytes, len, &hdr) != 0) {
+        return -EINVAL;
+    }
+
+    const uint8_t *bloom = bytes + sizeof(hdr);
+    const uint8_t *plates = bloom + (1ULL << hdr.bloom_log2_bits) / 8U;
+
+    /* Binary search relies on strictly increasing keys */
+    for (uint32_t i = 1; i < hdr.count; i++) {
+        if (plate_id_packed_key40(plates + (i - 1U) * PLATE_ID_PACKED_SIZE) >=
+            plate_id_packed_key40(plates + i * PLATE_ID_PACKED_SIZE)) {
+            return -EINVAL;
+        }
+    }
+
+    k_mutex_lock(&hotlist_reload_lock, K_FOREVER);
+
+    /* The slot not currently published has no readers left */
+    struct hotlist_table *t = (atomic_ptr_get(&hotlist_current.current) == &tables[0].snap) ?
+                              &tables[1] : &tables[0];
+    t->bloom = bloom;
+    t->bloom_mask = (uint32_t)((1ULL << hdr.bloom_log2_bits) - 1U);
+    t->bloom_hashes = hdr.bloom_hashes;
+    t->plates = plates;
+    t->count = hdr.count;
+    (void)snapshot_publish(&hotlist_current, &t->snap);
+
+    k_mutex_unlock(&hotlist_reload_lock);
+
+    LOG_INF("Hotlist loaded: %u plates (sequence %u)", hdr.count, hdr.sequence);
+    return 0;
+}
+
+/**
+ * @brief Checks whether a plate is on the hotlist.
+ * @param id The plate to check.
+ * @return True if the plate is on the hotlist.
+ */
+bool hotlist_contains(plate_id_t id)
+{
+    if (!plate_id_is_valid(id)) {
+        return false;
+    }
+
+    struct snapshot_obj *obj = snapshot_acquire(&hotlist_current);
+    if (obj == NULL) {
+        return false;
+    }
+
+    const struct hotlist_table *t = CONTAINER_OF(obj, struct hotlist_table, snap);
+    uint64_t key = plate_id_key40(id);
+    bool hit = hotlist_bloom_apply((uint8_t *)t->bloom, t->bloom_mask, t->bloom_hashes, key,
+                                   false) &&
+               hotlist_search(t, key);
+
+    snapshot_release(obj);
+    return hit;
+}
+
+/**
+ * @brief Gets the number of plates in the loaded hotlist.
+ * @return The number of plates, 0 if no list is loaded.
+ */
+size_t hotlist_count(void)
+{
+    struct snapshot_obj *obj = snapshot_acquire(&hotlist_current);
+    size_t count = 0;
+
+    if (obj != NULL) {
+        count = CONTAINER_OF(obj, struct hotlist_table, snap)->count;
+        snapshot_release(obj);
+    }
+    return count;
+}
+
+#if defined(CONFIG_NATIVE_LIBRARY)
+/* Provided by hotlist_native.c, linked into the native_sim runner */
+void *hotlist_native_map(const char *path, size_t *len);
+void hotlist_native_unmap(void *addr, size_t len);
+
+/**
+ * @brief Memory-maps CONFIG_RADAR_HOTLIST_FILE and swaps it in.
+ * Replace the file with rename() before reloading: the current mapping
+ * keeps the old contents alive until no lookup uses them.
+ * @return 0 on success, negative errno otherwise.
+ */
+int hotlist_load_default(void)
+{
+    static void *mapped;
+    static size_t mapped_len;
+    size_t len = 0;
+    void *addr = hotlist_native_map(CONFIG_RADAR_HOTLIST_FILE, &len);
+
+    if (addr == NULL) {
+        LOG_WRN("Hotlist file %s not available", CONFIG_RADAR_HOTLIST_FILE);
+        return -ENOENT;
+    }
+
+    /* Held across publish and unmap (hotlist_load() relocks it): a
+     * concurrent reload must not unmap the list published here
+     */
+    k_mutex_lock(&hotlist_reload_lock, K_FOREVER);
+
+    int ret = hotlist_load(addr, len);
+    if (ret != 0) {
+        k_mutex_unlock(&hotlist_reload_lock);
+        hotlist_native_unmap(addr, len);
+        LOG_ERR("Hotlist file %s is malformed", CONFIG_RADAR_HOTLIST_FILE);
+        return ret;
+    }
+
+    /* hotlist_load() returned: no lookup references the previous mapping */
+    if (mapped != NULL) {
+        hotlist_native_unmap(mapped, mapped_len);
+    }
+    mapped = addr;
+    mapped_len = len;
+    k_mutex_unlock(&hotlist_reload_lock);
+    return 0;
+}
+#else
+
+#define HOTLIST_PARTITION_ADDR(label)                                              \
+    ((const uint8_t *)(DT_REG_ADDR(DT_MTD_FROM_FIXED_PARTITION(DT_NODELABEL(label))) + \
+                       FIXED_PARTITION_OFFSET(label)))
+
+/* > A flash partition holding a well-formed hotlist header */
+struct hotlist_candidate {
+    const uint8_t *blob;
+    size_t len;
+    uint32_t sequence;
+};
+
+/**
+ * @brief Considers a memory-mapped flash partition as hotlist candidate.
+ * @param blob The partition contents.
+ * @param len The partition size.
+ * @param list In/out: the candidates, newest first.
+ * @param count In/out: the number of candidates.
+ */
+static inline void hotlist_consider(const uint8_t *blob, size_t len,
+                                    struct hotlist_candidate *list, size_t *count)
+{
+    struct hotlist_header hdr;
+
+    if (hotlist_parse_header(blob, len, &hdr) != 0) {
+        return;
+    }
+
+    size_t i = (*count)++;
+
+    while (i > 0 && list[i - 1].sequence < hdr.sequence) {
+        list[i] = list[i - 1];
+        i--;
+    }
+    list[i] = (struct hotlist_candidate){ .blob = blob, .len = len, .sequence = hdr.sequence };
+}
+
+/**
+ * @brief Loads the newest valid hotlist from the flash partitions.
+ * Writers update the partition that is not in use, bump the sequence
+ * number and call this again; the swap is atomic for lookups. A newer
+ * image that fails validation falls back to the other partition.
+ * @return 0 on success, negative errno otherwise.
+ */
+int hotlist_load_default(void)
+{
+#if FIXED_PARTITION_EXISTS(hotlist_partition) || FIXED_PARTITION_EXISTS(hotlist_b_partition)
+    struct hotlist_candidate list[2];
+    size_t count = 0;
+
+#if FIXED_PARTITION_EXISTS(hotlist_partition)
+    hotlist_consider(HOTLIST_PARTITION_ADDR(hotlist_partition),
+                     FIXED_PARTITION_SIZE(hotlist_partition), list, &count);
+#endif
+#if FIXED_PARTITION_EXISTS(hotlist_b_partition)
+    hotlist_consider(HOTLIST_PARTITION_ADDR(hotlist_b_partition),
+                     FIXED_PARTITION_SIZE(hotlist_b_partition), list, &count);
+#endif
+
+    if (count == 0) {
+        LOG_WRN("No valid hotlist partition");
+        return -ENOENT;
+    }
+    int ret = -ENOENT;
+
+    for (size_t i = 0; i < count; i++) {
+        ret = hotlist_load(list[i].blob, list[i].len);
+        if (ret == 0) {
+            return 0;
+        }
+        LOG_WRN("Hotlist partition with sequence %u is corrupt", list[i].sequence);
+    }
+    return ret;
+#else
+    LOG_WRN("No hotlist partition on this board");
+    return -ENODEV;
+#endif
+}
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Runner-side helpers for native_sim: compiled against the host libc so the
+ * hotlist can be memory-mapped straight from a host file.
+ */
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+void *hotlist_native_map(const char *path, size_t *len)
+{
+    struct stat st;
+    void *addr = NULL;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            addr = NULL;
+        } else {
+            *len = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+    return addr;
+}
+
+void hotlist_native_unmap(void *addr, size_t len)
+{
+    munmap(addr, len);
+}
@@ -1,4 +1,6 @@
 #include "infraction_log.h"
+#include "pcpu_counter.h"
+#include <zephyr/sys/byteorder.h>
 #include <string.h>
 
 #ifndef CONFIG_RADAR_INFRACTION_LOG_SIZE
@@ -8,11 +10,277 @@
 static infraction_record_t records[CONFIG_RADAR_INFRACTION_LOG_SIZE];
 static size_t head_index;
 static size_t total_count;
-static uint32_t count_light;
-static uint32_t count_heavy;
-static uint32_t count_valid_read;
-static uint32_t count_invalid_read;
+static struct pcpu_counter count_light;
+static struct pcpu_counter count_heavy;
+static struct pcpu_counter count_valid_read;
+static struct pcpu_counter count_invalid_read;
 static struct k_spinlock log_lock;
+static uint32_t next_seq;
+
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+/* Chain state, guarded by log_lock: records [0, chained_count) are chained */
+static uint32_t chained_count;
+static uint8_t chain_head[SHA256_DIGEST_SIZE];
+static struct infraction_log_checkpoint checkpoint;
+static bool checkpoint_valid;
+static K_SEM_DEFINE(chain_sem, 0, 1);
+
+/* Bytes of a serialized record: seq, timestamp, type, speed, limit, valid, plate, class */
+#define CHAIN_RECORD_SIZE (4U + 8U + 1U + 4U + 4U + 1U + 8U + 1U)
+
+/**
+ * @brief Computes the chain digest of a record.
+ * @param prev The digest of the previous record.
+ * @param record The record.
+ * @param digest Receives the digest.
+ */
+void infraction_log_chain_digest(const uint8_t prev[SHA256_DIGEST_SIZE],
+                                 const infraction_record_t *record,
+                                 uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    uint8_t buf[SHA256_DIGEST_SIZE + CHAIN_RECORD_SIZE];
+    uint8_t *p = buf + SHA256_DIGEST_SIZE;
+
+    /* Fixed little-endian layout: independent of padding and endianness */
+    memcpy(buf, prev, SHA256_DIGEST_SIZE);
+    sys_put_le32(record->seq, p);
+    sys_put_le64((uint64_t)record->timestamp_ms, p + 4);
+    p[12] = (uint8_t)record->type;
+    sys_put_le32(record->speed_kmh, p + 13);
+    sys_put_le32(record->limit_kmh, p + 17);
+    p[21] = record->valid_read ? 1U : 0U;
+    sys_put_le64(record->plate, p + 22);
+    p[30] = record->vclass;
+
+    sha256(buf, sizeof(buf), digest);
+}
+
+/**
+ * @brief Advances the chain over a digest computed for record seq.
+ * Must be called with log_lock held; a digest computed concurrently by
+ * someone else for the same record is simply dropped.
+ * @param seq The sequence number of the record.
+ * @param digest Its chain digest.
+ */
+static void chain_commit_locked(uint32_t seq, const uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    if (chained_count != seq) {
+        return;
+    }
+
+    infraction_record_t *slot = &records[seq % CONFIG_RADAR_INFRACTION_LOG_SIZE];
+    if (slot->seq == seq) {
+        memcpy(slot->digest, digest, SHA256_DIGEST_SIZE);
+    }
+    memcpy(chain_head, digest, SHA256_DIGEST_SIZE);
+    chained_count++;
+}
+
+/**
+ * @brief Chains the oldest pending record; the digest is computed outside the lock.
+ * @return True if a record was pending.
+ */
+static bool chain_step(void)
+{
+    uint8_t prev[SHA256_DIGEST_SIZE];
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    infraction_record_t rec;
+
+    k_spinlock_key_t key = k_spin_lock(&log_lock);
+    if (chained_count == next_seq) {
+        k_spin_unlock(&log_lock, key);
+        return false;
+    }
+    rec = records[chained_count % CONFIG_RADAR_INFRACTION_LOG_SIZE];
+    memcpy(prev, chain_head, sizeof(prev));
+    k_spin_unlock(&log_lock, key);
+
+    infraction_log_chain_digest(prev, &rec, digest);
+
+    key = k_spin_lock(&log_lock);
+    chain_commit_locked(rec.seq, digest);
+    k_spin_unlock(&log_lock, key);
+    return true;
+}
+
+/**
+ * @brief Signs a checkpoint when enough records were chained since the last one.
+ * @param force Sign whenever the chain advanced, regardless of the interval.
+ */
+static void chain_checkpoint(bool force)
+{
+    struct infraction_log_checkpoint cp;
+
+    k_spinlock_key_t key = k_spin_lock(&log_lock);
+    uint32_t last = checkpoint_valid ? checkpoint.count : 0U;
+    bool due = (chained_count - last >= CONFIG_RADAR_INFRACTION_LOG_CHECKPOINT_INTERVAL) ||
+               (force && chained_count != last);
+    cp.count = chained_count;
+    memcpy(cp.digest, chain_head, sizeof(cp.digest));
+    k_spin_unlock(&log_lock, key);
+
+    if (!due) {
+        return;
+    }
+
+    uint8_t msg[4U + SHA256_DIGEST_SIZE];
+    sys_put_le32(cp.count, msg);
+    memcpy(msg + 4, cp.digest, SHA256_DIGEST_SIZE);
+    hmac_sha256(CONFIG_RADAR_INFRACTION_LOG_CHAIN_KEY, sizeof(CONFIG_RADAR_INFRACTION_LOG_CHAIN_KEY) - 1U,
+                msg, sizeof(msg), cp.mac);
+
+    key = k_spin_lock(&log_lock);
+    if (!checkpoint_valid || cp.count > checkpoint.count) {
+        checkpoint = cp;
+        checkpoint_valid = true;
+    }
+    k_spin_unlock(&log_lock, key);
+}
+
+/**
+ * @brief Low-priority worker that extends the chain after records are added.
+ */
+static void chain_thread_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    while (1) {
+        k_sem_take(&chain_sem, K_FOREVER);
+        while (chain_step()) {
+        }
+        chain_checkpoint(false);
+    }
+}
+
+/* Below every radar thread: chaining only uses idle time */
+K_THREAD_DEFINE(chain_tid, 1536, chain_thread_entry, NULL, NULL, NULL, 12, 0, 0);
+
+/**
+ * @brief Chains every pending record in the caller's context.
+ */
+void infraction_log_chain_sync(void)
+{
+    while (chain_step()) {
+    }
+    chain_checkpoint(true);
+}
+
+/**
+ * @brief Re-walks a chain segment.
+ * @param prev The digest preceding the segment.
+ * @param records The records, oldest first.
+ * @param count The number of records.
+ * @param bad_index If not NULL, receives the index of the first bad record.
+ * @return 0 if the segment is intact, -EBADMSG otherwise.
+ */
+int infraction_log_chain_verify(const uint8_t prev[SHA256_DIGEST_SIZE],
+                                const infraction_record_t *records, size_t count,
+                                size_t *bad_index)
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    const uint8_t *expected_prev = prev;
+
+    for (size_t i = 0; i < count; i++) {
+        bool ok = (i == 0U) || (records[i].seq == records[i - 1U].seq + 1U);
+
+        if (ok) {
+            infraction_log_chain_digest(expected_prev, &records[i], digest);
+            ok = memcmp(digest, records[i].digest, SHA256_DIGEST_SIZE) == 0;
+        }
+        if (!ok) {
+            if (bad_index != NULL) {
+                *bad_index = i;
+            }
+            return -EBADMSG;
+        }
+        expected_prev = records[i].digest;
+    }
+    return 0;
+}
+
+/**
+ * @brief Copies the chained records still in the log and verifies them.
+ * @param buf Scratch buffer for the records.
+ * @param max_records The size of the buffer.
+ * @param bad_index If not NULL, receives the index in buf of the first bad record.
+ * @return The number of records copied on success, -EBADMSG if the chain is broken.
+ */
+int infraction_log_verify_recent(infraction_record_t *buf, size_t max_records, size_t *bad_index)
+{
+    static const uint8_t genesis[SHA256_DIGEST_SIZE];
+
+    if (buf == NULL || max_records == 0) {
+        return 0;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&log_lock);
+    /* Records about to be overwritten are always chained first, so the
+     * chained records still in the ring are [next_seq - total_count, chained_count).
+     */
+    size_t n = MIN((size_t)(chained_count - (next_seq - (uint32_t)total_count)), max_records);
+    for (size_t i = 0; i < n; i++) {
+        buf[i] = records[(chained_count - n + i) % CONFIG_RADAR_INFRACTION_LOG_SIZE];
+    }
+    k_spin_unlock(&log_lock, key);
+
+    if (n == 0U) {
+        return 0;
+    }
+
+    /* The first ever record chains from zero; otherwise the oldest copy anchors */
+    int ret = (buf[0].seq == 0U) ?
+              infraction_log_chain_verify(genesis, buf, n, bad_index) :
+              infraction_log_chain_verify(buf[0].digest, buf + 1, n - 1U, bad_index);
+    if (ret != 0) {
+        if (bad_index != NULL && buf[0].seq != 0U) {
+            (*bad_index)++;
+        }
+        return ret;
+    }
+    return (int)n;
+}
+
+/**
+ * @brief Gets the latest signed checkpoint.
+ * @param out Receives the checkpoint.
+ * @return 0 on success, -ENOENT if no checkpoint was signed yet.
+ */
+int infraction_log_get_checkpoint(struct infraction_log_checkpoint *out)
+{
+    int ret = -ENOENT;
+
+    k_spinlock_key_t key = k_spin_lock(&log_lock);
+    if (checkpoint_valid) {
+        *out = checkpoint;
+        ret = 0;
+    }
+    k_spin_unlock(&log_lock, key);
+    return ret;
+}
+
+/**
+ * @brief Checks the signature of a checkpoint.
+ * @param cp The checkpoint.
+ * @return True if the MAC matches.
+ */
+bool infraction_log_checkpoint_verify(const struct infraction_log_checkpoint *cp)
+{
+    uint8_t msg[4U + SHA256_DIGEST_SIZE];
+    uint8_t mac[SHA256_DIGEST_SIZE];
+    uint8_t diff = 0;
+
+    sys_put_le32(cp->count, msg);
+    memcpy(msg + 4, cp->digest, SHA256_DIGEST_SIZE);
+    hmac_sha256(CONFIG_RADAR_INFRACTION_LOG_CHAIN_KEY, sizeof(CONFIG_RADAR_INFRACTION_LOG_CHAIN_KEY) - 1U,
+                msg, sizeof(msg), mac);
+    for (size_t i = 0; i < SHA256_DIGEST_SIZE; i++) {
+        diff |= mac[i] ^ cp->mac[i];
+    }
+    return diff == 0U;
+}
+#endif
 
 /**
  * @brief Adds an infraction record to the log.
@@ -21,25 +289,47 @@ static struct k_spinlock log_lock;
 void infraction_log_add(const infraction_record_t *record)
 {
     k_spinlock_key_t key = k_spin_lock(&log_lock);
+
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+    /* The worker fell a full ring behind: chain the record about to be
+     * overwritten here so the chain never has a gap. The digest is taken
+     * outside the lock like the worker's; another adder may chain it or
+     * take the slot meanwhile, hence the re-check.
+     */
+    while (total_count == CONFIG_RADAR_INFRACTION_LOG_SIZE &&
+           chained_count == records[head_index].seq) {
+        k_spin_unlock(&log_lock, key);
+        (void)chain_step();
+        key = k_spin_lock(&log_lock);
+    }
+#endif
    
     /* Add the record to the log */
     records[head_index] = *record;
+    records[head_index].seq = next_seq++;
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+    memset(records[head_index].digest, 0, SHA256_DIGEST_SIZE);
+#endif
     head_index = (head_index + 1) % CONFIG_RADAR_INFRACTION_LOG_SIZE;
     if (total_count < CONFIG_RADAR_INFRACTION_LOG_SIZE) {
         total_count++;
     }
+    k_spin_unlock(&log_lock, key);
+
     if (record->type == VEHICLE_HEAVY) {
-        count_heavy++;
+        pcpu_counter_inc(&count_heavy);
     } else if (record->type == VEHICLE_LIGHT) {
-   	count_light++;
+        pcpu_counter_inc(&count_light);
     }
     if (record->valid_read) {
-        count_valid_read++;
+        pcpu_counter_inc(&count_valid_read);
     } else {
-        count_invalid_read++;
+        pcpu_counter_inc(&count_invalid_read);
     }
-   
-    k_spin_unlock(&log_lock, key);
+
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+    k_sem_give(&chain_sem);
+#endif
 }
 
 /**
@@ -80,20 +370,18 @@ size_t infraction_log_get_recent(size_t max_records, infraction_record_t *out_re
  * @param valid_reads Pointer to the count of valid reads.
  * @param invalid_reads Pointer to the count of invalid reads.
  */
-void infraction_log_get_counters(uint32_t *light_count, uint32_t *heavy_count, uint32_t *valid_reads, uint32_t *invalid_reads)
+void infraction_log_get_counters(uint64_t *light_count, uint64_t *heavy_count, uint64_t *valid_reads, uint64_t *invalid_reads)
 {
-    k_spinlock_key_t key = k_spin_lock(&log_lock);
     if (light_count) {
-        *light_count = count_light;
+        *light_count = pcpu_counter_get(&count_light);
     }
     if (heavy_count) {
-        *heavy_count = count_heavy;
+        *heavy_count = pcpu_counter_get(&count_heavy);
     }
     if (valid_reads) {
-        *valid_reads = count_valid_read;
+        *valid_reads = pcpu_counter_get(&count_valid_read);
     }
     if (invalid_reads) {
-        *invalid_reads = count_invalid_read;
+        *invalid_reads = pcpu_counter_get(&count_invalid_read);
     }
-    k_spin_unlock(&log_lock, key);
 }
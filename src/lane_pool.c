@@ -0,0 +1,241 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <errno.h>
+#include "lane_pool.h"
+
+#define POOL_WORKERS CONFIG_RADAR_ENFORCEMENT_WORKERS
+#define POOL_LANES CONFIG_RADAR_LANE_COUNT
+#define POOL_DEPTH CONFIG_RADAR_ENFORCEMENT_LANE_DEPTH
+#define POOL_STACK_SIZE 4096
+
+/* Free-running indexes wrap with the counter type; slots must too */
+BUILD_ASSERT(IS_POWER_OF_TWO(POOL_DEPTH), "lane depth must be a power of two");
+
+/*
+ * Work is stolen a lane at a time: each lane has its own FIFO and a token
+ * that sits in at most one worker deque while the lane has pending
+ * measurements. Whoever holds the token is the only consumer of the lane,
+ * so per-lane order holds whichever worker runs it.
+ */
+
+/* > Lane: single-producer FIFO plus its scheduling token */
+struct pool_lane {
+    sensor_data_t slots[POOL_DEPTH];
+    atomic_t head;      /* Next slot to handle, advanced by the token holder */
+    atomic_t tail;      /* Next slot to fill, advanced by the producer */
+    atomic_t scheduled; /* Token is in a deque or held by a worker */
+};
+
+/* > Worker: deque of lane tokens */
+struct pool_worker {
+    struct k_spinlock lock;
+    uint8_t deque[POOL_LANES]; /* Every token fits: a lane is queued once */
+    uint8_t top;               /* Oldest token */
+    uint8_t count;
+    atomic_t busy;
+    struct k_sem wake;
+};
+
+static struct pool_lane lanes[POOL_LANES];
+static struct pool_worker workers[POOL_WORKERS];
+static struct k_thread worker_threads[POOL_WORKERS];
+K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, POOL_WORKERS, POOL_STACK_SIZE);
+
+static lane_pool_handler_t pool_handler;
+static atomic_t pool_started;
+static atomic_t submitted_count;
+static atomic_t processed_count;
+static atomic_t steal_count;
+
+/**
+ * @brief Appends a lane token at the bottom of a worker deque.
+ * @param w The worker.
+ * @param lane The lane.
+ */
+static void deque_push(struct pool_worker *w, uint8_t lane)
+{
+    k_spinlock_key_t key = k_spin_lock(&w->lock);
+
+    w->deque[(w->top + w->count) % POOL_LANES] = lane;
+    w->count++;
+    k_spin_unlock(&w->lock, key);
+}
+
+/**
+ * @brief Takes a lane token from a worker deque.
+ * The owner takes the oldest token so its lanes are served round-robin;
+ * thieves take the newest, the one the owner would reach last.
+ * @param w The worker.
+ * @param steal Take from the thief end.
+ * @param left Receives the tokens left behind.
+ * @return The lane, -1 if the deque is empty.
+ */
+static int deque_take(struct pool_worker *w, bool steal, uint8_t *left)
+{
+    int lane = -1;
+    k_spinlock_key_t key = k_spin_lock(&w->lock);
+
+    if (w->count > 0U) {
+        w->count--;
+        if (steal) {
+            lane = w->deque[(w->top + w->count) % POOL_LANES];
+        } else {
+            lane = w->deque[w->top];
+            w->top = (uint8_t)((w->top + 1U) % POOL_LANES);
+        }
+    }
+    *left = w->count;
+    k_spin_unlock(&w->lock, key);
+    return lane;
+}
+
+/**
+ * @brief Wakes one idle worker, which will look for a lane to steal.
+ */
+static void wake_thief(void)
+{
+    for (unsigned int w = 0; w < POOL_WORKERS; w++) {
+        if (!atomic_get(&workers[w].busy)) {
+            k_sem_give(&workers[w].wake);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Hands a lane token to the lane's home worker and makes sure
+ * someone will run it.
+ * @param lane The lane.
+ */
+static void lane_schedule(uint8_t lane)
+{
+    struct pool_worker *home = &workers[lane % POOL_WORKERS];
+
+    deque_push(home, lane);
+    k_sem_give(&home->wake);
+    if (atomic_get(&home->busy)) {
+        wake_thief();
+    }
+}
+
+/**
+ * @brief Handles the pending measurements of a lane the caller holds the
+ * token of, then releases or requeues the token.
+ * @param lane The lane.
+ */
+static void lane_run(uint8_t lane)
+{
+    struct pool_lane *q = &lanes[lane];
+
+    /* A batch per turn, so one busy lane cannot starve its deque mates */
+    for (unsigned int n = 0; n < POOL_DEPTH; n++) {
+        uint32_t head = (uint32_t)atomic_get(&q->head);
+        if (head == (uint32_t)atomic_get(&q->tail)) {
+            atomic_clear(&q->scheduled);
+            /* The producer may have queued between the check and the clear */
+            if (head == (uint32_t)atomic_get(&q->tail) || !atomic_cas(&q->scheduled, 0, 1)) {
+                return;
+            }
+            continue;
+        }
+        pool_handler(&q->slots[head % POOL_DEPTH]);
+        atomic_inc(&q->head);
+        atomic_inc(&processed_count);
+    }
+    lane_schedule(lane);
+}
+
+/**
+ * @brief Main entry point for a pool worker.
+ * @param p1 The worker index, cast to a pointer.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void worker_thread_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    unsigned int self = POINTER_TO_UINT(p1);
+    struct pool_worker *w = &workers[self];
+
+    while (1) {
+        uint8_t left;
+        int lane = deque_take(w, false, &left);
+
+        if (lane >= 0 && left > 0U) {
+            /* More lanes wait behind this one: let an idle worker take them */
+            wake_thief();
+        }
+        for (unsigned int i = 1; lane < 0 && i < POOL_WORKERS; i++) {
+            lane = deque_take(&workers[(self + i) % POOL_WORKERS], true, &left);
+            if (lane >= 0) {
+                atomic_inc(&steal_count);
+            }
+        }
+
+        if (lane < 0) {
+            atomic_clear(&w->busy);
+            k_sem_take(&w->wake, K_FOREVER);
+            atomic_set(&w->busy, 1);
+            continue;
+        }
+        lane_run((uint8_t)lane);
+    }
+}
+
+int lane_pool_init(lane_pool_handler_t handler)
+{
+    if (!atomic_cas(&pool_started, 0, 1)) {
+        return -EALREADY;
+    }
+
+    pool_handler = handler;
+    for (unsigned int w = 0; w < POOL_WORKERS; w++) {
+        k_sem_init(&workers[w].wake, 0, 1);
+        atomic_set(&workers[w].busy, 1);
+        k_thread_create(&worker_threads[w], worker_stacks[w], POOL_STACK_SIZE,
+                        worker_thread_entry, UINT_TO_POINTER(w), NULL, NULL,
+                        LANE_POOL_PRIORITY, 0, K_FOREVER);
+#if defined(CONFIG_RADAR_SMP_PINNING)
+        (void)k_thread_cpu_pin(&worker_threads[w],
+                               (int)((CONFIG_RADAR_CPU_CONTROL + w) % arch_num_cpus()));
+#endif
+        k_thread_start(&worker_threads[w]);
+    }
+    return 0;
+}
+
+int lane_pool_submit(const sensor_data_t *s_data)
+{
+    if (s_data->lane >= POOL_LANES) {
+        return -EINVAL;
+    }
+
+    struct pool_lane *q = &lanes[s_data->lane];
+    uint32_t tail = (uint32_t)atomic_get(&q->tail);
+
+    if (tail - (uint32_t)atomic_get(&q->head) >= POOL_DEPTH) {
+        return -ENOBUFS;
+    }
+    q->slots[tail % POOL_DEPTH] = *s_data;
+    atomic_inc(&q->tail);
+    atomic_inc(&submitted_count);
+
+    if (atomic_cas(&q->scheduled, 0, 1)) {
+        lane_schedule(s_data->lane);
+    }
+    return 0;
+}
+
+bool lane_pool_idle(void)
+{
+    return atomic_get(&processed_count) == atomic_get(&submitted_count);
+}
+
+void lane_pool_get_stats(struct lane_pool_stats *out)
+{
+    out->submitted = (uint32_t)atomic_get(&submitted_count);
+    out->processed = (uint32_t)atomic_get(&processed_count);
+    out->steals = (uint32_t)atomic_get(&steal_count);
+}
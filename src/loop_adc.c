@@ -0,0 +1,268 @@
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/logging/log.h>
+#include "common.h"
+#include "loop_adc.h"
+#include "loop_signature.h"
+
+LOG_MODULE_REGISTER(loop_adc, LOG_LEVEL_INF);
+
+/* One loop per lane, in lane order, all on the same ADC */
+#define LOOP_ADC_NODE DT_PATH(zephyr_user)
+#define LOOP_ADC_LANES MIN(DT_PROP_LEN(LOOP_ADC_NODE, io_channels), CONFIG_RADAR_LANE_COUNT)
+#define LOOP_ADC_CHANNELS DT_PROP_LEN(LOOP_ADC_NODE, io_channels)
+
+#define LOOP_ADC_SPEC(node_id, prop, idx) ADC_DT_SPEC_GET_BY_IDX(node_id, idx)
+
+static const struct adc_dt_spec loop_adc_specs[] = {
+    DT_FOREACH_PROP_ELEM_SEP(LOOP_ADC_NODE, io_channels, LOOP_ADC_SPEC, (,))
+};
+
+/* > Loop of one lane */
+struct loop_adc_lane {
+    struct loop_sig_detector det;
+    size_t offset;             /* Rank of its channel within a sampling */
+    int64_t block_end_ms;      /* Block being fed: when it ended, */
+    uint64_t block_end_sample; /* and the sample count it ends at */
+    struct loop_signature last;
+    int64_t last_end_ms;
+    bool fresh;                /* last not taken yet */
+};
+
+/* > Block handed from the sampler to the processor */
+struct loop_adc_block {
+    int64_t end_ms;
+    uint8_t half;
+};
+
+static uint16_t loop_adc_buf[2][CONFIG_RADAR_LOOP_ADC_BLOCK * LOOP_ADC_CHANNELS];
+static struct loop_adc_lane loop_adc_lanes[LOOP_ADC_LANES];
+static struct k_spinlock loop_adc_lock; /* Covers last, last_end_ms, fresh */
+static atomic_t loop_adc_blocks;
+static atomic_t loop_adc_overruns;
+static atomic_t loop_adc_vehicles;
+
+/* Both halves start free; a full half goes through the queue */
+K_SEM_DEFINE(loop_adc_free_0, 1, 1);
+K_SEM_DEFINE(loop_adc_free_1, 1, 1);
+static struct k_sem *const loop_adc_free[2] = { &loop_adc_free_0, &loop_adc_free_1 };
+K_MSGQ_DEFINE(loop_adc_full, sizeof(struct loop_adc_block), 2, 8);
+
+#if defined(CONFIG_ADC_EMUL)
+#include <zephyr/drivers/adc/adc_emul.h>
+#include "loop_synth.h"
+
+/* The emulated loops idle here and see one vehicle per period, at 60 km/h */
+#define LOOP_ADC_EMUL_BASELINE 1200
+#define LOOP_ADC_EMUL_PERIOD_S 4
+#define LOOP_ADC_EMUL_SPEED_MM_S 16667
+
+static const struct loop_synth_vehicle *const loop_adc_emul_traffic[] = {
+    &loop_synth_car, &loop_synth_van, &loop_synth_motorcycle, &loop_synth_truck,
+    &loop_synth_bus,
+};
+
+/* > Emulated loop: where it is in its traffic */
+struct loop_adc_emul {
+    const struct adc_dt_spec *spec;
+    uint32_t sample;
+};
+
+static struct loop_adc_emul loop_adc_emul[LOOP_ADC_CHANNELS];
+
+/**
+ * @brief ADC emulator callback: the loop level at the next sample.
+ * @param dev The ADC.
+ * @param chan The channel.
+ * @param data The emulated loop.
+ * @param result Receives the level, in mV.
+ * @return 0.
+ */
+static int loop_adc_emul_value(const struct device *dev, unsigned int chan, void *data,
+                               uint32_t *result)
+{
+    ARG_UNUSED(chan);
+    struct loop_adc_emul *e = data;
+    const uint32_t period = LOOP_ADC_EMUL_PERIOD_S * USEC_PER_SEC /
+                            CONFIG_RADAR_LOOP_ADC_INTERVAL_US;
+    uint32_t n = e->sample++;
+    size_t lane = e - loop_adc_emul;
+    const struct loop_synth_vehicle *v =
+        loop_adc_emul_traffic[(n / period + lane) % ARRAY_SIZE(loop_adc_emul_traffic)];
+    int64_t front_cm = (int64_t)(n % period) * CONFIG_RADAR_LOOP_ADC_INTERVAL_US *
+                       LOOP_ADC_EMUL_SPEED_MM_S / 10000000;
+    uint32_t counts = LOOP_ADC_EMUL_BASELINE +
+                      loop_synth_response(v, (int32_t)front_cm, CONFIG_RADAR_LOOP_LENGTH_CM);
+
+    *result = (counts * adc_ref_internal(dev)) >> e->spec->resolution;
+    return 0;
+}
+#endif
+
+/**
+ * @brief Detector callback: keeps a closed vehicle for the sensor thread.
+ * @param sig The signature.
+ * @param arg The lane.
+ */
+static void loop_adc_vehicle(const struct loop_signature *sig, void *arg)
+{
+    struct loop_adc_lane *lane = arg;
+    int64_t end_ms = lane->block_end_ms -
+                     (int64_t)((lane->block_end_sample - sig->end_sample) *
+                               CONFIG_RADAR_LOOP_ADC_INTERVAL_US / USEC_PER_MSEC);
+
+    k_spinlock_key_t key = k_spin_lock(&loop_adc_lock);
+    lane->last = *sig;
+    lane->last_end_ms = end_ms;
+    lane->fresh = true;
+    k_spin_unlock(&loop_adc_lock, key);
+    (void)atomic_inc(&loop_adc_vehicles);
+}
+
+/**
+ * @brief Configures the loop channels and the sequence of one block.
+ * @param seq Receives the sequence.
+ * @return 0 on success, negative error code otherwise.
+ */
+static int loop_adc_setup(struct adc_sequence *seq)
+{
+    static struct adc_sequence_options options = {
+        .interval_us = CONFIG_RADAR_LOOP_ADC_INTERVAL_US,
+        .extra_samplings = CONFIG_RADAR_LOOP_ADC_BLOCK - 1,
+    };
+    uint32_t channels = 0;
+
+    for (size_t i = 0; i < LOOP_ADC_CHANNELS; i++) {
+        const struct adc_dt_spec *spec = &loop_adc_specs[i];
+
+        if (!adc_is_ready_dt(spec) || spec->dev != loop_adc_specs[0].dev) {
+            LOG_ERR("Loop %u: ADC not ready or not shared with loop 0", (unsigned int)i);
+            return -ENODEV;
+        }
+        int ret = adc_channel_setup_dt(spec);
+        if (ret != 0) {
+            LOG_ERR("Loop %u: channel setup failed (%d)", (unsigned int)i, ret);
+            return ret;
+        }
+        channels |= BIT(spec->channel_id);
+#if defined(CONFIG_ADC_EMUL)
+        loop_adc_emul[i].spec = spec;
+        (void)adc_emul_value_func_set(spec->dev, spec->channel_id, loop_adc_emul_value,
+                                      &loop_adc_emul[i]);
+#endif
+    }
+
+    /* A sampling stores the channels in ascending order */
+    for (size_t i = 0; i < LOOP_ADC_LANES; i++) {
+        struct loop_adc_lane *lane = &loop_adc_lanes[i];
+
+        lane->offset = POPCOUNT(channels & BIT_MASK(loop_adc_specs[i].channel_id));
+        loop_signature_init(&lane->det, CONFIG_RADAR_LOOP_SIG_ON_COUNTS,
+                            CONFIG_RADAR_LOOP_SIG_HOLD_SAMPLES);
+    }
+
+    int ret = adc_sequence_init_dt(&loop_adc_specs[0], seq);
+    seq->channels = channels;
+    seq->options = &options;
+    seq->buffer_size = sizeof(loop_adc_buf[0]);
+    return ret;
+}
+
+/**
+ * @brief Sampler thread: fills the halves of the buffer in turn.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void loop_adc_sampler_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    struct adc_sequence seq = { 0 };
+    uint8_t half = 0;
+
+    if (loop_adc_setup(&seq) != 0) {
+        return;
+    }
+    LOG_INF("Sampling %u loop(s) every %u us", (unsigned int)LOOP_ADC_LANES,
+            CONFIG_RADAR_LOOP_ADC_INTERVAL_US);
+
+    while (1) {
+        if (k_sem_take(loop_adc_free[half], K_NO_WAIT) != 0) {
+            /* The processor is late: a DMA would overwrite this half */
+            (void)atomic_inc(&loop_adc_overruns);
+            (void)k_sem_take(loop_adc_free[half], K_FOREVER);
+        }
+        seq.buffer = loop_adc_buf[half];
+        int ret = adc_read(loop_adc_specs[0].dev, &seq);
+        if (ret != 0) {
+            LOG_ERR("Loop sampling failed (%d)", ret);
+            k_sem_give(loop_adc_free[half]);
+            k_msleep(1000);
+            continue;
+        }
+        struct loop_adc_block blk = { .end_ms = k_uptime_get(), .half = half };
+        (void)k_msgq_put(&loop_adc_full, &blk, K_FOREVER);
+        half ^= 1U;
+    }
+}
+
+/**
+ * @brief Processor thread: runs the detectors over each full half.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void loop_adc_processor_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    struct loop_adc_block blk;
+
+    while (1) {
+        (void)k_msgq_get(&loop_adc_full, &blk, K_FOREVER);
+        for (size_t i = 0; i < LOOP_ADC_LANES; i++) {
+            struct loop_adc_lane *lane = &loop_adc_lanes[i];
+
+            lane->block_end_ms = blk.end_ms;
+            lane->block_end_sample = lane->det.sample + CONFIG_RADAR_LOOP_ADC_BLOCK;
+            (void)loop_signature_feed(&lane->det, &loop_adc_buf[blk.half][lane->offset],
+                                      CONFIG_RADAR_LOOP_ADC_BLOCK, LOOP_ADC_CHANNELS,
+                                      loop_adc_vehicle, lane);
+        }
+        k_sem_give(loop_adc_free[blk.half]);
+        (void)atomic_inc(&loop_adc_blocks);
+    }
+}
+
+K_THREAD_DEFINE(loop_adc_sampler_tid, 1024, loop_adc_sampler_entry, NULL, NULL, NULL, 5, 0, 0);
+K_THREAD_DEFINE(loop_adc_processor_tid, 1024, loop_adc_processor_entry, NULL, NULL, NULL, 6, 0,
+                0);
+
+int loop_adc_take(uint8_t lane, int64_t since_ms, struct loop_signature *out)
+{
+    int ret = -ENODATA;
+
+    if (lane >= LOOP_ADC_LANES) {
+        return -ENODATA;
+    }
+    struct loop_adc_lane *l = &loop_adc_lanes[lane];
+    k_spinlock_key_t key = k_spin_lock(&loop_adc_lock);
+    if (l->fresh && l->last_end_ms >= since_ms) {
+        *out = l->last;
+        l->fresh = false;
+        ret = 0;
+    }
+    k_spin_unlock(&loop_adc_lock, key);
+    return ret;
+}
+
+void loop_adc_stats_get(struct loop_adc_stats *out)
+{
+    out->blocks = (uint32_t)atomic_get(&loop_adc_blocks);
+    out->overruns = (uint32_t)atomic_get(&loop_adc_overruns);
+    out->vehicles = (uint32_t)atomic_get(&loop_adc_vehicles);
+}
@@ -0,0 +1,160 @@
+#include <zephyr/kernel.h>
+#include "common.h"
+#include "loop_signature.h"
+
+/* Idle level follows the loop with a time constant of 2^8 samples */
+#define LOOP_SIG_BASELINE_SHIFT 8
+
+/* > Features a tree node can test */
+enum loop_sig_feature {
+    LOOP_SIG_LENGTH_CM, /* Magnetic length, less the loop */
+    LOOP_SIG_PEAK,      /* Counts over the idle level */
+    LOOP_SIG_FILL_PCT,  /* Area over the peak-by-occupancy box */
+    LOOP_SIG_FEATURES,
+};
+
+/** Child value of a leaf: the class it assigns */
+#define LOOP_SIG_LEAF(vclass) (0x80U | (uint8_t)(vclass))
+
+/* > Classification tree node: go to le if feature <= threshold, else gt */
+struct loop_sig_node {
+    uint8_t feature;
+    uint8_t le;
+    uint8_t gt;
+    uint16_t threshold;
+};
+
+/*
+ * Lengths split two-wheelers, cars and vans, and heavy vehicles. A car
+ * carries its metal in the engine bay, so its profile peaks early and
+ * fills less of the box than a van's even floor; a tractor-trailer leaves
+ * a gap a bus does not. Short and strong is a small car, not a motorcycle.
+ * The slopes are not split on: over LOOP_SIG_SLOPE_LAG samples they are
+ * too coarse at walking speeds to beat the fill.
+ */
+static const struct loop_sig_node loop_sig_tree[] = {
+    /* 0 */ { LOOP_SIG_LENGTH_CM, 1, 2, 280 },
+    /* 1 */ { LOOP_SIG_PEAK, LOOP_SIG_LEAF(VEHICLE_CLASS_MOTORCYCLE),
+              LOOP_SIG_LEAF(VEHICLE_CLASS_CAR), CONFIG_RADAR_LOOP_SIG_MOTORCYCLE_MAX_PEAK },
+    /* 2 */ { LOOP_SIG_LENGTH_CM, LOOP_SIG_LEAF(VEHICLE_CLASS_CAR), 3, 470 },
+    /* 3 */ { LOOP_SIG_LENGTH_CM, 4, 5, 800 },
+    /* 4 */ { LOOP_SIG_FILL_PCT, LOOP_SIG_LEAF(VEHICLE_CLASS_CAR),
+              LOOP_SIG_LEAF(VEHICLE_CLASS_VAN), 66 },
+    /* 5 */ { LOOP_SIG_FILL_PCT, LOOP_SIG_LEAF(VEHICLE_CLASS_TRUCK_2),
+              LOOP_SIG_LEAF(VEHICLE_CLASS_BUS), 75 },
+};
+
+void loop_signature_init(struct loop_sig_detector *det, uint16_t on_counts, uint16_t hold)
+{
+    *det = (struct loop_sig_detector){
+        .on_counts = on_counts,
+        .off_counts = on_counts / 2U,
+        .hold = MAX(hold, 1U),
+        .state = LOOP_SIG_IDLE,
+    };
+}
+
+uint32_t loop_signature_feed(struct loop_sig_detector *det, const uint16_t *samples, size_t n,
+                             size_t stride, loop_signature_cb_t cb, void *arg)
+{
+    uint32_t closed = 0;
+
+    if (!det->primed && n > 0U) {
+        det->baseline_q8 = (uint32_t)samples[0] << 8;
+        det->primed = true;
+    }
+
+    for (size_t i = 0; i < n; i++, det->sample++) {
+        uint32_t x = samples[i * stride];
+        uint32_t base = det->baseline_q8 >> 8;
+        uint16_t d = (x > base) ? (uint16_t)MIN(x - base, UINT16_MAX) : 0U;
+        uint16_t *slot = &det->lag[det->sample & (LOOP_SIG_SLOPE_LAG - 1U)];
+        uint16_t old = *slot;
+        struct loop_signature *cur = &det->cur;
+
+        *slot = d;
+        if (det->state == LOOP_SIG_IDLE) {
+            if (d <= det->on_counts) {
+                det->baseline_q8 = (uint32_t)((int32_t)det->baseline_q8 +
+                                              (((int32_t)(x << 8) - (int32_t)det->baseline_q8) >>
+                                               LOOP_SIG_BASELINE_SHIFT));
+                continue;
+            }
+            *cur = (struct loop_signature){ 0 };
+            det->below = 0;
+            det->below_area = 0;
+            det->state = LOOP_SIG_VEHICLE;
+        }
+
+        cur->samples++;
+        cur->area += d;
+        cur->peak = MAX(cur->peak, d);
+        if (d > old) {
+            cur->rise = MAX(cur->rise, d - old);
+        } else {
+            cur->fall = MAX(cur->fall, old - d);
+        }
+
+        if (d >= det->off_counts) {
+            det->below = 0;
+            det->below_area = 0;
+            continue;
+        }
+        det->below++;
+        det->below_area += d;
+        if (det->below < det->hold) {
+            continue;
+        }
+
+        /* Trim the hold: the vehicle ended on its first low sample */
+        cur->samples -= det->below;
+        cur->area -= det->below_area;
+        cur->end_sample = det->sample - det->below;
+        det->state = LOOP_SIG_IDLE;
+        closed++;
+        if (cb != NULL) {
+            cb(cur, arg);
+        }
+    }
+    return closed;
+}
+
+vehicle_class_t loop_signature_classify(const struct loop_signature *sig, uint32_t sample_us,
+                                        uint32_t speed_mm_s)
+{
+    if (speed_mm_s == 0U || sig->samples == 0U || sig->peak == 0U) {
+        return VEHICLE_CLASS_UNKNOWN;
+    }
+
+    /* Occupancy times speed is the vehicle plus the loop */
+    uint64_t magnetic_cm = ((uint64_t)sig->samples * sample_us * speed_mm_s) / 10000000U;
+    const uint32_t features[LOOP_SIG_FEATURES] = {
+        [LOOP_SIG_LENGTH_CM] = (magnetic_cm > CONFIG_RADAR_LOOP_LENGTH_CM) ?
+                               (uint32_t)(magnetic_cm - CONFIG_RADAR_LOOP_LENGTH_CM) : 0U,
+        [LOOP_SIG_PEAK] = sig->peak,
+        [LOOP_SIG_FILL_PCT] = (uint32_t)(((uint64_t)sig->area * 100U) /
+                                         ((uint64_t)sig->peak * sig->samples)),
+    };
+    uint8_t node = 0;
+
+    while ((node & LOOP_SIG_LEAF(0)) == 0U) {
+        const struct loop_sig_node *t = &loop_sig_tree[node];
+
+        node = (features[t->feature] <= t->threshold) ? t->le : t->gt;
+    }
+    return (vehicle_class_t)(node & ~LOOP_SIG_LEAF(0));
+}
+
+vehicle_class_t loop_signature_fuse(vehicle_class_t axles, vehicle_class_t loop)
+{
+    if (loop == VEHICLE_CLASS_UNKNOWN || loop >= VEHICLE_CLASS_COUNT) {
+        return axles;
+    }
+    if (axles == VEHICLE_CLASS_UNKNOWN) {
+        return loop;
+    }
+    if (axles == VEHICLE_CLASS_CAR && loop == VEHICLE_CLASS_VAN) {
+        return VEHICLE_CLASS_VAN;
+    }
+    return axles;
+}
@@ -1,14 +1,18 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/zbus/zbus.h>
-#include <string.h>
-#include <zephyr/sys/atomic.h>
 #include "common.h"
 #include "threads.h"
-#include <camera_service.h>
+#include "enforcement.h"
 #include "infraction_log.h"
+#include "speed_stats.h"
+#include "flow_metrics.h"
+#include "rrd.h"
+#include "edge_filter.h"
+#include "loop_adc.h"
+#include "wim_adc.h"
 
-LOG_MODULE_REGISTER(main_control, LOG_LEVEL_INF);
+LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 
 /**
  * @brief Message Queue for Sensor Data
@@ -21,24 +25,14 @@ K_MSGQ_DEFINE(sensor_msgq, sizeof(sensor_data_t), CONFIG_RADAR_QUEUE_DEPTH, 4);
 K_MSGQ_DEFINE(display_msgq, sizeof(display_data_t), CONFIG_RADAR_QUEUE_DEPTH, 4); // Message Queue for Display Data
 
 /**
- * @brief Thread Definitions for Sensor, Display, and Camera
+ * @brief Thread Definitions for Sensor, Display, and Enforcement
  */
-K_THREAD_DEFINE(sensor_tid, 2048, sensor_thread_entry, NULL, NULL, NULL, 7, 0, 0);
-K_THREAD_DEFINE(display_tid, 2048, display_thread_entry, NULL, NULL, NULL, 7, 0, 0);
-
-/**
- * @brief Subscriber for Main Thread
- */
-ZBUS_SUBSCRIBER_DEFINE(main_camera_sub, 4);
-
-/**
- * @brief Telemetry Counters
- */
-static atomic_t vehicle_light_count;
-static atomic_t vehicle_heavy_count;
-static atomic_t status_normal_count;
-static atomic_t status_warning_count;
-static atomic_t status_infraction_count;
+K_THREAD_DEFINE(sensor_tid, 2048, sensor_thread_entry, NULL, NULL, NULL, 7, 0,
+                RADAR_STAGE_START_DELAY);
+K_THREAD_DEFINE(display_tid, 2048, display_thread_entry, NULL, NULL, NULL, 7, 0,
+                RADAR_STAGE_START_DELAY);
+K_THREAD_DEFINE(enforcement_tid, 4096, enforcement_thread_entry, NULL, NULL, NULL, 0, 0,
+                RADAR_STAGE_START_DELAY);
 
 /**
  * @brief Main entry point for the telemetry thread.
@@ -55,198 +49,133 @@ static void telemetry_thread_entry(void *p1, void *p2, void *p3)
 	while (1) {
 		k_msleep(CONFIG_RADAR_TELEMETRY_INTERVAL_MS);
         /* Get the telemetry counters */
-		uint32_t light = (uint32_t)atomic_get(&vehicle_light_count);
-		uint32_t heavy = (uint32_t)atomic_get(&vehicle_heavy_count);
-		uint32_t normal = (uint32_t)atomic_get(&status_normal_count);
-		uint32_t warn = (uint32_t)atomic_get(&status_warning_count);
-		uint32_t infr = (uint32_t)atomic_get(&status_infraction_count);
-		uint32_t inf_light = 0, inf_heavy = 0, valid_reads = 0, invalid_reads = 0;
+		struct enforcement_counters cnt;
+		enforcement_get_counters(&cnt);
+		uint64_t inf_light = 0, inf_heavy = 0, valid_reads = 0, invalid_reads = 0;
 		infraction_log_get_counters(&inf_light, &inf_heavy, &valid_reads, &invalid_reads);
-		LOG_INF("Telemetry: Vehicles [Leve=%u, Pesado=%u] | Status [Normal=%u, Alerta=%u, Infracao=%u] | Camera [Validas=%u, Invalidas=%u]",
-			light, heavy, normal, warn, infr, valid_reads, invalid_reads);
+		LOG_INF("Telemetry: Vehicles [Leve=%llu, Pesado=%llu] | Status [Normal=%llu, Alerta=%llu, Infracao=%llu] | Log [Leve=%llu, Pesado=%llu] | Camera [Validas=%llu, Invalidas=%llu] | Hotlist [Alertas=%llu]",
+			(unsigned long long)cnt.light, (unsigned long long)cnt.heavy,
+			(unsigned long long)cnt.normal, (unsigned long long)cnt.warning,
+			(unsigned long long)cnt.infraction, (unsigned long long)inf_light,
+			(unsigned long long)inf_heavy, (unsigned long long)valid_reads,
+			(unsigned long long)invalid_reads, (unsigned long long)cnt.hotlist_hits);
+
+		if (IS_ENABLED(CONFIG_RADAR_EDGE_FILTER)) {
+			/* Only noisy lanes are reported */
+			for (uint8_t lane = 0; lane < CONFIG_RADAR_LANE_COUNT; lane++) {
+				struct sensor_noise noise;
+				(void)sensor_noise_get(lane, &noise);
+				uint32_t rejected = noise.start.short_pulses + noise.start.refractory +
+						    noise.end.short_pulses + noise.end.refractory;
+				if (rejected > 0U) {
+					LOG_INF("Telemetry: Faixa %u Ruido [Inicio: Curtos=%u, Refratario=%u | Fim: Curtos=%u, Refratario=%u]",
+						lane, noise.start.short_pulses, noise.start.refractory,
+						noise.end.short_pulses, noise.end.refractory);
+				}
+			}
+		}
+
+		if (IS_ENABLED(CONFIG_RADAR_LOOP_ADC)) {
+			struct loop_adc_stats loops;
+			loop_adc_stats_get(&loops);
+			LOG_INF("Telemetry: Lacos [Blocos=%u, Atrasos=%u, Assinaturas=%u]",
+				loops.blocks, loops.overruns, loops.vehicles);
+		}
+
+		if (IS_ENABLED(CONFIG_RADAR_WIM)) {
+			struct wim_adc_stats wim;
+			wim_adc_stats_get(&wim);
+			LOG_INF("Telemetry: Pesagem [Blocos=%u, Atrasos=%u, Eixos=%u]",
+				wim.blocks, wim.overruns, wim.axles);
+		}
+
+		if (IS_ENABLED(CONFIG_RADAR_RRD)) {
+			rrd_advance(k_uptime_get());
+		}
+
+		if (IS_ENABLED(CONFIG_RADAR_SPEED_STATS)) {
+			speed_stats_advance(k_uptime_get());
+			for (uint8_t lane = 0; lane < CONFIG_RADAR_LANE_COUNT; lane++) {
+				struct speed_stats_summary sum;
+				(void)speed_stats_current(lane, &sum);
+				LOG_INF("Telemetry: Faixa %u [Veiculos=%u, Media=%u, Desvio=%u, P85=%u km/h]",
+					lane, sum.count, (uint32_t)(sum.mean_kmh + 0.5f),
+					(uint32_t)(sum.stddev_kmh + 0.5f), (uint32_t)(sum.p85_kmh + 0.5f));
+			}
+		}
 	}
 }
 
 /**
  * @brief Thread Definition for Telemetry
  */
-K_THREAD_DEFINE(telemetry_tid, 1024, telemetry_thread_entry, NULL, NULL, NULL, 8, 0, 0);
+K_THREAD_DEFINE(telemetry_tid, 1024, telemetry_thread_entry, NULL, NULL, NULL, 8, 0,
+                RADAR_STAGE_START_DELAY);
 
+#if defined(CONFIG_RADAR_FLOW_METRICS)
+/**
+ * @brief Main entry point for the flow metrics thread.
+ * Closes a flow interval every CONFIG_RADAR_FLOW_INTERVAL_S.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void flow_thread_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
 
-/* > Pending Infraction Context */
-typedef struct {
-	bool active;
-	int64_t timestamp_ms;
-	uint32_t speed_kmh;
-	uint32_t limit_kmh;
-	vehicle_type_t type;
-} pending_infraction_t;
+    while (1) {
+        k_sleep(K_SECONDS(CONFIG_RADAR_FLOW_INTERVAL_S));
+        flow_metrics_publish(k_uptime_get());
+    }
+}
 
-static pending_infraction_t pending_infraction_ctx;
+/**
+ * @brief Thread Definition for Flow Metrics
+ */
+K_THREAD_DEFINE(flow_tid, 1024, flow_thread_entry, NULL, NULL, NULL, 8, 0,
+                RADAR_STAGE_START_DELAY);
+#endif
+
+#if defined(CONFIG_RADAR_SMP_PINNING)
+/**
+ * @brief Pins a statically defined thread to one CPU, then starts it.
+ * The thread is defined with RADAR_STAGE_START_DELAY, so it has not run
+ * yet and its CPU mask can still change.
+ * @param tid The thread.
+ * @param cpu The CPU, wrapped to the CPUs present.
+ * @param name The stage name, for the log.
+ */
+static void pin_stage(k_tid_t tid, unsigned int cpu, const char *name)
+{
+    cpu %= arch_num_cpus();
+    int ret = k_thread_cpu_pin(tid, (int)cpu);
+    k_thread_start(tid);
+    if (ret != 0) {
+        LOG_WRN("Could not pin %s to CPU %u: %d", name, cpu, ret);
+    } else {
+        LOG_INF("Stage %s pinned to CPU %u", name, cpu);
+    }
+}
+#endif
 
 int main(void) {
     LOG_INF("Radar System Initializing...");
 
-	/* Subscribe to the camera service event channel */
-    zbus_chan_add_obs(&chan_camera_evt, &main_camera_sub, K_FOREVER);
+#if defined(CONFIG_RADAR_SMP_PINNING)
+    /* One CPU per pipeline stage, so the stages never preempt each other */
+    pin_stage(sensor_tid, CONFIG_RADAR_CPU_SENSOR, "sensor");
+    pin_stage(traffic_sim_tid, CONFIG_RADAR_CPU_SENSOR, "traffic_sim");
+    pin_stage(enforcement_tid, CONFIG_RADAR_CPU_CONTROL, "enforcement");
+    pin_stage(camera_thread_id, CONFIG_RADAR_CPU_CAMERA, "camera");
+    pin_stage(display_tid, CONFIG_RADAR_CPU_DISPLAY, "display");
+    pin_stage(telemetry_tid, CONFIG_RADAR_CPU_DISPLAY, "telemetry");
+#if defined(CONFIG_RADAR_FLOW_METRICS)
+    pin_stage(flow_tid, CONFIG_RADAR_CPU_DISPLAY, "flow");
+#endif
+#endif
 
-    sensor_data_t s_data;
-    const struct zbus_channel *chan;
-
-    while (1) {
-        if (k_msgq_get(&sensor_msgq, &s_data, K_NO_WAIT) == 0) {
-            uint32_t distance_mm = CONFIG_RADAR_SENSOR_DISTANCE_MM;
-            uint32_t speed_kmh = calculate_speed(distance_mm, s_data.duration_ms);
-
-
-            uint32_t limit = (s_data.type == VEHICLE_LIGHT) ? 
-                             CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH : 
-                             CONFIG_RADAR_SPEED_LIMIT_HEAVY_KMH;
-            
-            display_status_t status = STATUS_NORMAL;
-            if (speed_kmh > limit) {
-                status = STATUS_INFRACTION;
-            } else {
-                uint32_t warning_thr = (limit * CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100;
-                if (speed_kmh >= warning_thr) {
-                    status = STATUS_WARNING;
-                }
-            }
-
-            LOG_INF("Speed Calc: %d km/h (Limit: %d). Status: %d", speed_kmh, limit, status);
-
-            display_data_t d_data;
-            d_data.speed_kmh = speed_kmh;
-            d_data.limit_kmh = limit;
-            d_data.type = s_data.type;
-            d_data.status = status;
-            d_data.plate[0] = '\0';
-            d_data.axle_count = s_data.axle_count;
-            d_data.warning_kmh = (limit * CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100;
-
-            if (s_data.type == VEHICLE_LIGHT) {
-                atomic_inc(&vehicle_light_count);
-            } else if (s_data.type == VEHICLE_HEAVY) {
-                atomic_inc(&vehicle_heavy_count);
-            }
-            switch (status) {
-                case STATUS_NORMAL: atomic_inc(&status_normal_count); break;
-                case STATUS_WARNING: atomic_inc(&status_warning_count); break;
-                case STATUS_INFRACTION: atomic_inc(&status_infraction_count); break;
-            }
-
-            /* Send the display data to the display queue */
-            {
-                int put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                if (put_ret != 0) {
-                    display_data_t dropped;
-                    (void)k_msgq_get(&display_msgq, &dropped, K_NO_WAIT);
-                    put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                    if (put_ret != 0) {
-                        LOG_WRN("display_msgq full, dropping update");
-                    }
-                }
-            }
-
-            if (status == STATUS_INFRACTION) {
-                /* Record pending infraction context */
-                pending_infraction_ctx.active = true;
-                pending_infraction_ctx.timestamp_ms = k_uptime_get();
-                pending_infraction_ctx.speed_kmh = speed_kmh;
-                pending_infraction_ctx.limit_kmh = limit;
-                pending_infraction_ctx.type = s_data.type;
-                int cap_ret = camera_api_capture(K_MSEC(200));
-                if (cap_ret != 0) {
-                    LOG_WRN("camera_api_capture failed: %d", cap_ret);
-                }
-            }
-        }
-
-        /* Check for Camera Results */
-        if (zbus_sub_wait(&main_camera_sub, &chan, K_NO_WAIT) == 0) {
-			if (chan == &chan_camera_evt) {
-                struct msg_camera_evt evt;
-                if (zbus_chan_read(&chan_camera_evt, &evt, K_NO_WAIT) != 0) {
-                    continue;
-                }
-
-                bool valid_capture = false;
-                const char *plate = NULL;
-                if (evt.type == MSG_CAMERA_EVT_TYPE_DATA && evt.captured_data) {
-                    plate = evt.captured_data->plate;
-                    if (plate != NULL && validate_plate(plate)) {
-                        valid_capture = true;
-                    }
-                }
-
-                if (valid_capture) {
-                    LOG_INF("Valid Plate: %s. Infraction Recorded.", plate);
-                    infraction_record_t rec = {
-                        .timestamp_ms = pending_infraction_ctx.active ? pending_infraction_ctx.timestamp_ms : k_uptime_get(),
-                        .type = pending_infraction_ctx.active ? pending_infraction_ctx.type : VEHICLE_UNKNOWN,
-                        .speed_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.speed_kmh : 0,
-                        .limit_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.limit_kmh : 0,
-                        .valid_read = true
-                    };
-                    strncpy(rec.plate, plate, sizeof(rec.plate));
-                    rec.plate[sizeof(rec.plate)-1] = '\0';
-                    infraction_log_add(&rec);
-
-                    display_data_t d_data;
-                    d_data.speed_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.speed_kmh : 0;
-                    d_data.limit_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.limit_kmh : 0;
-                    d_data.type = pending_infraction_ctx.active ? pending_infraction_ctx.type : VEHICLE_UNKNOWN;
-                    d_data.status = STATUS_INFRACTION;
-                    d_data.axle_count = 0;
-                    d_data.warning_kmh = (d_data.limit_kmh * CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100;
-                    strncpy(d_data.plate, plate, sizeof(d_data.plate));
-                    d_data.plate[sizeof(d_data.plate)-1] = '\0';
-                    int put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                    if (put_ret != 0) {
-                        display_data_t dropped;
-                        (void)k_msgq_get(&display_msgq, &dropped, K_NO_WAIT);
-                        put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                        if (put_ret != 0) {
-                            LOG_WRN("display_msgq full, dropping update");
-                        }
-                    }
-                    pending_infraction_ctx.active = false;
-
-                } else {
-                    LOG_WRN("Invalid Plate or camera error");
-                    infraction_record_t rec = {
-                        .timestamp_ms = pending_infraction_ctx.active ? pending_infraction_ctx.timestamp_ms : k_uptime_get(),
-                        .type = pending_infraction_ctx.active ? pending_infraction_ctx.type : VEHICLE_UNKNOWN,
-                        .speed_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.speed_kmh : 0,
-                        .limit_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.limit_kmh : 0,
-                        .valid_read = false
-                    };
-                    rec.plate[0] = '\0';
-                    infraction_log_add(&rec);
-
-                    display_data_t d_data;
-                    d_data.speed_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.speed_kmh : 0;
-                    d_data.limit_kmh = pending_infraction_ctx.active ? pending_infraction_ctx.limit_kmh : 0;
-                    d_data.type = pending_infraction_ctx.active ? pending_infraction_ctx.type : VEHICLE_UNKNOWN;
-                    d_data.status = STATUS_INFRACTION;
-                    d_data.axle_count = 0;
-                    d_data.warning_kmh = (d_data.limit_kmh * CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100;
-                    d_data.plate[0] = '\0';
-                    int put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                    if (put_ret != 0) {
-                        display_data_t dropped;
-                        (void)k_msgq_get(&display_msgq, &dropped, K_NO_WAIT);
-                        put_ret = k_msgq_put(&display_msgq, &d_data, K_NO_WAIT);
-                        if (put_ret != 0) {
-                            LOG_WRN("display_msgq full, dropping update");
-                        }
-                    }
-                    pending_infraction_ctx.active = false;
-                }
-            }
-        }
-
-        k_msleep(10);
-    }
     return 0;
 }
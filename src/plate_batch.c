@@ -0,0 +1,249 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+#include "common.h"
+#include "plate_batch.h"
+#include "plate_signature.h"
+
+#if defined(CONFIG_RADAR_PLATE_BATCH_SIMD) && defined(__AVX2__)
+#define PLATE_BATCH_AVX2 1
+#include <immintrin.h>
+#elif defined(CONFIG_RADAR_PLATE_BATCH_SIMD) && defined(__SSE2__)
+#define PLATE_BATCH_SSE2 1
+#include <emmintrin.h>
+#elif defined(CONFIG_RADAR_PLATE_BATCH_SIMD)
+#define PLATE_BATCH_SWAR 1
+#endif
+
+/*
+ * Fast path shared by every kernel: the first 8 bytes of a slot hold a
+ * compact plate ("ABC1D23\0"), i.e. 7 alphanumerics followed by NUL. The
+ * letter bits of bytes 0..6 form the plate signature directly. Slots that
+ * do not fit (separators, wrong length, junk) take the scalar path, which
+ * yields the same answer.
+ */
+#define PLATE_FAST_ALNUM_MASK 0x7FU
+
+/**
+ * @brief Scalar reference for one slot.
+ * @param slot The plate slot.
+ * @return The matched country, PLATE_COUNTRY_NONE if invalid.
+ */
+static uint8_t plate_batch_scalar_one(const char *slot)
+{
+    /* Never read past the slot if the caller left it unterminated */
+    if (memchr(slot, '\0', PLATE_STR_SIZE) == NULL) {
+        return PLATE_COUNTRY_NONE;
+    }
+    return (uint8_t)validate_plate_country(slot);
+}
+
+/**
+ * @brief Resolves one slot from its per-byte class masks.
+ * @param slot The plate slot (used on the slow path).
+ * @param letters Bit i set when byte i is a letter.
+ * @param alnum Bit i set when byte i is a letter or a digit.
+ * @param nul Bit i set when byte i is NUL.
+ * @return The matched country, PLATE_COUNTRY_NONE if invalid.
+ */
+static inline uint8_t plate_batch_resolve(const char *slot, uint32_t letters, uint32_t alnum,
+                                          uint32_t nul)
+{
+    if ((alnum & PLATE_FAST_ALNUM_MASK) == PLATE_FAST_ALNUM_MASK && (nul & BIT(7)) != 0U) {
+        return plate_signature_country[letters & PLATE_FAST_ALNUM_MASK];
+    }
+    return plate_batch_scalar_one(slot);
+}
+
+#if defined(PLATE_BATCH_SWAR)
+#define SWAR_ONES     0x0101010101010101ULL
+#define SWAR_HIGH     0x8080808080808080ULL
+#define SWAR_REP(c)   ((uint64_t)(c) * SWAR_ONES)
+/* Moves the high bit of byte i to bit i (no carries: target bits are distinct) */
+#define SWAR_GATHER   0x0102040810204080ULL
+
+/**
+ * @brief Flags the bytes of @p w lying in [lo, hi] (lo, hi < 0x80).
+ * @return A word with the high bit set in every matching byte.
+ */
+static inline uint64_t swar_in_range(uint64_t w, uint8_t lo, uint8_t hi)
+{
+    uint64_t x = w | SWAR_HIGH;
+    uint64_t ge_lo = x - SWAR_REP(lo);
+    uint64_t gt_hi = x - SWAR_REP(hi + 1U);
+
+    return ge_lo & ~gt_hi & ~w & SWAR_HIGH;
+}
+
+/**
+ * @brief Packs the per-byte high bits of @p m into an 8-bit mask.
+ */
+static inline uint32_t swar_movemask(uint64_t m)
+{
+    return (uint32_t)(((m >> 7) * SWAR_GATHER) >> 56);
+}
+
+/**
+ * @brief SWAR kernel: classifies the 8 leading bytes of a slot in one word.
+ */
+static size_t plate_batch_kernel(const char (*plates)[PLATE_STR_SIZE], size_t n, uint8_t *out)
+{
+    size_t valid = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        uint64_t w = sys_get_le64((const uint8_t *)plates[i]);
+        uint64_t letters = swar_in_range(w | SWAR_REP(0x20), 'a', 'z');
+        uint64_t digits = swar_in_range(w, '0', '9');
+        uint64_t nul = swar_in_range(w, 0, 0);
+
+        out[i] = plate_batch_resolve(plates[i], swar_movemask(letters),
+                                     swar_movemask(letters | digits), swar_movemask(nul));
+        valid += (out[i] != PLATE_COUNTRY_NONE);
+    }
+    return valid;
+}
+#elif defined(PLATE_BATCH_SSE2) || defined(PLATE_BATCH_AVX2)
+
+/**
+ * @brief Loads the 8 leading bytes of a slot (slots are 10 bytes wide).
+ */
+static inline int64_t plate_batch_load8(const char *slot)
+{
+    return (int64_t)sys_get_le64((const uint8_t *)slot);
+}
+
+#if defined(PLATE_BATCH_AVX2)
+#define PLATE_BATCH_LANES 4U
+
+/**
+ * @brief AVX2 kernel: classifies four slots (32 bytes) per iteration.
+ */
+static size_t plate_batch_kernel(const char (*plates)[PLATE_STR_SIZE], size_t n, uint8_t *out)
+{
+    const __m256i lower = _mm256_set1_epi8(0x20);
+    const __m256i a_lo = _mm256_set1_epi8('a' - 1);
+    const __m256i z_hi = _mm256_set1_epi8('z' + 1);
+    const __m256i d_lo = _mm256_set1_epi8('0' - 1);
+    const __m256i d_hi = _mm256_set1_epi8('9' + 1);
+    size_t valid = 0;
+    size_t i = 0;
+
+    for (; i + PLATE_BATCH_LANES <= n; i += PLATE_BATCH_LANES) {
+        __m256i v = _mm256_set_epi64x(plate_batch_load8(plates[i + 3]),
+                                      plate_batch_load8(plates[i + 2]),
+                                      plate_batch_load8(plates[i + 1]),
+                                      plate_batch_load8(plates[i]));
+        __m256i l = _mm256_or_si256(v, lower);
+        /* Signed compares: bytes >= 0x80 are negative and never match */
+        __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(l, a_lo), _mm256_cmpgt_epi8(z_hi, l));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, d_lo), _mm256_cmpgt_epi8(d_hi, v));
+        uint32_t m_letter = (uint32_t)_mm256_movemask_epi8(letter);
+        uint32_t m_alnum = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(letter, digit));
+        uint32_t m_nul = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+
+        for (uint32_t k = 0; k < PLATE_BATCH_LANES; k++) {
+            uint32_t sh = 8U * k;
+
+            out[i + k] = plate_batch_resolve(plates[i + k], (m_letter >> sh) & 0xFFU,
+                                             (m_alnum >> sh) & 0xFFU, (m_nul >> sh) & 0xFFU);
+            valid += (out[i + k] != PLATE_COUNTRY_NONE);
+        }
+    }
+    for (; i < n; i++) {
+        out[i] = plate_batch_scalar_one(plates[i]);
+        valid += (out[i] != PLATE_COUNTRY_NONE);
+    }
+    return valid;
+}
+#else
+#define PLATE_BATCH_LANES 2U
+
+/**
+ * @brief SSE2 kernel: classifies two slots (16 bytes) per iteration.
+ */
+static size_t plate_batch_kernel(const char (*plates)[PLATE_STR_SIZE], size_t n, uint8_t *out)
+{
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i a_lo = _mm_set1_epi8('a' - 1);
+    const __m128i z_hi = _mm_set1_epi8('z' + 1);
+    const __m128i d_lo = _mm_set1_epi8('0' - 1);
+    const __m128i d_hi = _mm_set1_epi8('9' + 1);
+    size_t valid = 0;
+    size_t i = 0;
+
+    for (; i + PLATE_BATCH_LANES <= n; i += PLATE_BATCH_LANES) {
+        __m128i v = _mm_set_epi64x(plate_batch_load8(plates[i + 1]),
+                                   plate_batch_load8(plates[i]));
+        __m128i l = _mm_or_si128(v, lower);
+        /* Signed compares: bytes >= 0x80 are negative and never match */
+        __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(l, a_lo), _mm_cmplt_epi8(l, z_hi));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, d_lo), _mm_cmplt_epi8(v, d_hi));
+        uint32_t m_letter = (uint32_t)_mm_movemask_epi8(letter);
+        uint32_t m_alnum = (uint32_t)_mm_movemask_epi8(_mm_or_si128(letter, digit));
+        uint32_t m_nul = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+
+        for (uint32_t k = 0; k < PLATE_BATCH_LANES; k++) {
+            uint32_t sh = 8U * k;
+
+            out[i + k] = plate_batch_resolve(plates[i + k], (m_letter >> sh) & 0xFFU,
+                                             (m_alnum >> sh) & 0xFFU, (m_nul >> sh) & 0xFFU);
+            valid += (out[i + k] != PLATE_COUNTRY_NONE);
+        }
+    }
+    for (; i < n; i++) {
+        out[i] = plate_batch_scalar_one(plates[i]);
+        valid += (out[i] != PLATE_COUNTRY_NONE);
+    }
+    return valid;
+}
+#endif
+#else
+
+/**
+ * @brief Scalar reference kernel.
+ */
+static size_t plate_batch_kernel(const char (*plates)[PLATE_STR_SIZE], size_t n, uint8_t *out)
+{
+    size_t valid = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = plate_batch_scalar_one(plates[i]);
+        valid += (out[i] != PLATE_COUNTRY_NONE);
+    }
+    return valid;
+}
+#endif
+
+/**
+ * @brief Validates many plates in one call.
+ * @param plates The plate slots to validate.
+ * @param n The number of slots.
+ * @param out_country Output array receiving the country of each slot.
+ * @return The number of valid plates.
+ */
+size_t validate_plates_batch(const char (*plates)[PLATE_STR_SIZE], size_t n,
+                             uint8_t *out_country)
+{
+    if (plates == NULL || out_country == NULL) {
+        return 0;
+    }
+    return plate_batch_kernel(plates, n, out_country);
+}
+
+/**
+ * @brief Gets the name of the batch kernel compiled in.
+ * @return The kernel name.
+ */
+const char *validate_plates_batch_kernel(void)
+{
+#if defined(PLATE_BATCH_AVX2)
+    return "avx2";
+#elif defined(PLATE_BATCH_SSE2)
+    return "sse2";
+#elif defined(PLATE_BATCH_SWAR)
+    return "swar";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,327 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/init.h>
+#include <stdlib.h>
+#include <string.h>
+#include "policy.h"
+#include "axle_class.h"
+
+#if defined(CONFIG_RADAR_POLICY_SETTINGS)
+#include <zephyr/settings/settings.h>
+#endif
+#if defined(CONFIG_RADAR_POLICY_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(policy, LOG_LEVEL_INF);
+
+#define POLICY_DEFAULT_VALUES {                                  \
+    .limit_light_kmh = CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH,       \
+    .limit_heavy_kmh = CONFIG_RADAR_SPEED_LIMIT_HEAVY_KMH,       \
+    .warning_percent = CONFIG_RADAR_WARNING_THRESHOLD_PERCENT,   \
+    .distance_mm = CONFIG_RADAR_SENSOR_DISTANCE_MM,              \
+}
+
+/* Slot 0 holds the Kconfig defaults, so readers always find a policy;
+ * its decision table is built at boot by policy_defaults_init().
+ */
+static struct radar_policy policies[2] = {
+    [0] = { .v = POLICY_DEFAULT_VALUES },
+};
+static struct snapshot policy_current = {
+    .current = ATOMIC_PTR_INIT(&policies[0].snap),
+};
+static K_MUTEX_DEFINE(policy_update_lock);
+
+const struct radar_policy *policy_acquire(void)
+{
+    return CONTAINER_OF(snapshot_acquire(&policy_current), struct radar_policy, snap);
+}
+
+void policy_release(const struct radar_policy *policy)
+{
+    snapshot_release((struct snapshot_obj *)&policy->snap);
+}
+
+void policy_get(struct radar_policy_values *out)
+{
+    const struct radar_policy *policy = policy_acquire();
+
+    *out = policy->v;
+    policy_release(policy);
+}
+
+/**
+ * @brief Checks that policy values are usable.
+ * @param values The values.
+ * @return True if every value is in range.
+ */
+static bool policy_values_valid(const struct radar_policy_values *values)
+{
+    for (int c = 0; c < VEHICLE_CLASS_COUNT; c++) {
+        if (values->class_limit_kmh[c] > 300U) {
+            return false;
+        }
+    }
+    return values->limit_light_kmh >= 1U && values->limit_light_kmh <= 300U &&
+           values->limit_heavy_kmh >= 1U && values->limit_heavy_kmh <= 300U &&
+           values->warning_percent <= 100U &&
+           values->distance_mm >= 1U && values->distance_mm <= DECISION_MAX_DISTANCE_MM;
+}
+
+/**
+ * @brief Fills a policy, decision table included, from validated values.
+ * @param p The policy, not visible to readers.
+ * @param values The values.
+ */
+static void policy_fill(struct radar_policy *p, const struct radar_policy_values *values)
+{
+    struct decision_class classes[DECISION_CLASSES];
+
+    for (int c = 0; c < VEHICLE_CLASS_COUNT; c++) {
+        uint32_t limit = values->class_limit_kmh[c];
+
+        if (limit == 0U) {
+            /* Unknown vehicles are held to the heavy limit */
+            limit = (vehicle_class_type((vehicle_class_t)c) == VEHICLE_LIGHT) ?
+                    values->limit_light_kmh : values->limit_heavy_kmh;
+        }
+        classes[c].limit_kmh = limit;
+        classes[c].warning_kmh = (limit * values->warning_percent) / 100U;
+    }
+
+    p->v = *values;
+    decision_table_build(&p->table, values->distance_mm, classes);
+}
+
+/**
+ * @brief Builds the default policy before any thread reads it.
+ * @return 0.
+ */
+static int policy_defaults_init(void)
+{
+    policy_fill(&policies[0], &policies[0].v);
+    return 0;
+}
+
+SYS_INIT(policy_defaults_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+/**
+ * @brief Builds and publishes a policy from validated values.
+ * @param values The values.
+ */
+static void policy_publish(const struct radar_policy_values *values)
+{
+    k_mutex_lock(&policy_update_lock, K_FOREVER);
+
+    /* The slot not currently published has no readers left */
+    struct radar_policy *p = (atomic_ptr_get(&policy_current.current) == &policies[0].snap) ?
+                             &policies[1] : &policies[0];
+    policy_fill(p, values);
+    (void)snapshot_publish(&policy_current, &p->snap);
+
+    k_mutex_unlock(&policy_update_lock);
+}
+
+#if defined(CONFIG_RADAR_POLICY_SETTINGS)
+/* Values read by settings_load, published once loading is complete */
+static struct radar_policy_values policy_loaded = POLICY_DEFAULT_VALUES;
+
+/**
+ * @brief Settings handler for the "radar/policy" subtree.
+ * @param name The key below the subtree.
+ * @param len The stored value length.
+ * @param read_cb Reads the stored value.
+ * @param cb_arg Argument for read_cb.
+ * @return 0 on success, negative error code otherwise.
+ */
+static int policy_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                               void *cb_arg)
+{
+    static const struct {
+        const char *key;
+        size_t offset;
+    } fields[] = {
+        { "light", offsetof(struct radar_policy_values, limit_light_kmh) },
+        { "heavy", offsetof(struct radar_policy_values, limit_heavy_kmh) },
+        { "warning", offsetof(struct radar_policy_values, warning_percent) },
+        { "distance", offsetof(struct radar_policy_values, distance_mm) },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(fields); i++) {
+        if (!settings_name_steq(name, fields[i].key, NULL)) {
+            continue;
+        }
+        if (len != sizeof(uint32_t)) {
+            return -EINVAL;
+        }
+        ssize_t ret = read_cb(cb_arg, (uint8_t *)&policy_loaded + fields[i].offset,
+                              sizeof(uint32_t));
+        return (ret < 0) ? (int)ret : 0;
+    }
+
+    /* Per-class limits are stored under the class name */
+    vehicle_class_t vclass = vehicle_class_from_name(name);
+    if (vclass == VEHICLE_CLASS_COUNT) {
+        return -ENOENT;
+    }
+    if (len != sizeof(uint32_t)) {
+        return -EINVAL;
+    }
+    ssize_t ret = read_cb(cb_arg, &policy_loaded.class_limit_kmh[vclass], sizeof(uint32_t));
+    return (ret < 0) ? (int)ret : 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(radar_policy, "radar/policy", NULL, policy_settings_set, NULL,
+                               NULL);
+
+/**
+ * @brief Stores policy values under "radar/policy".
+ * @param values The values.
+ * @return 0 on success, negative error code from the settings backend.
+ */
+static int policy_save(const struct radar_policy_values *values)
+{
+    int ret = settings_save_one("radar/policy/light", &values->limit_light_kmh, sizeof(uint32_t));
+
+    if (ret == 0) {
+        ret = settings_save_one("radar/policy/heavy", &values->limit_heavy_kmh, sizeof(uint32_t));
+    }
+    if (ret == 0) {
+        ret = settings_save_one("radar/policy/warning", &values->warning_percent,
+                                sizeof(uint32_t));
+    }
+    if (ret == 0) {
+        ret = settings_save_one("radar/policy/distance", &values->distance_mm, sizeof(uint32_t));
+    }
+    for (int c = 0; c < VEHICLE_CLASS_COUNT && ret == 0; c++) {
+        char key[32];
+
+        snprintk(key, sizeof(key), "radar/policy/%s", vehicle_class_name((vehicle_class_t)c));
+        ret = settings_save_one(key, &values->class_limit_kmh[c], sizeof(uint32_t));
+    }
+    return ret;
+}
+#endif
+
+int policy_update(const struct radar_policy_values *values)
+{
+    if (!policy_values_valid(values)) {
+        return -EINVAL;
+    }
+
+    policy_publish(values);
+    LOG_INF("Policy: Leve=%u km/h, Pesado=%u km/h, Alerta=%u%%, Distancia=%u mm",
+            values->limit_light_kmh, values->limit_heavy_kmh, values->warning_percent,
+            values->distance_mm);
+
+#if defined(CONFIG_RADAR_POLICY_SETTINGS)
+    int ret = policy_save(values);
+    if (ret != 0) {
+        LOG_WRN("Policy not persisted: %d", ret);
+        return ret;
+    }
+#endif
+    return 0;
+}
+
+int policy_init(void)
+{
+#if defined(CONFIG_RADAR_POLICY_SETTINGS)
+    int ret = settings_subsys_init();
+
+    if (ret == 0) {
+        ret = settings_load_subtree("radar/policy");
+    }
+    if (ret != 0) {
+        LOG_WRN("Policy settings unavailable (%d), using defaults", ret);
+        return ret;
+    }
+    if (!policy_values_valid(&policy_loaded)) {
+        LOG_WRN("Stored policy out of range, using defaults");
+        return -EINVAL;
+    }
+    policy_publish(&policy_loaded);
+#endif
+    return 0;
+}
+
+#if defined(CONFIG_RADAR_POLICY_SHELL)
+/**
+ * @brief "radar policy show": prints the current policy.
+ */
+static int cmd_policy_show(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    const struct radar_policy *policy = policy_acquire();
+
+    shell_print(sh, "light %u km/h, heavy %u km/h, warning %u%%, distance %u mm",
+                policy->v.limit_light_kmh, policy->v.limit_heavy_kmh,
+                policy->v.warning_percent, policy->v.distance_mm);
+    for (int c = 0; c < VEHICLE_CLASS_COUNT; c++) {
+        shell_print(sh, "  %-12s %3u km/h%s", vehicle_class_name((vehicle_class_t)c),
+                    policy_limit_kmh(policy, (vehicle_class_t)c),
+                    (policy->v.class_limit_kmh[c] == 0U) ? "" : " (own limit)");
+    }
+    policy_release(policy);
+    return 0;
+}
+
+/**
+ * @brief "radar policy set <light|heavy|warning|distance|<class>> <value>".
+ * A class limit of 0 returns the class to the light or heavy limit.
+ */
+static int cmd_policy_set(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+
+    struct radar_policy_values v;
+    char *end;
+    unsigned long value = strtoul(argv[2], &end, 10);
+
+    if (*argv[2] == '\0' || *end != '\0' || value > UINT32_MAX) {
+        shell_error(sh, "invalid value: %s", argv[2]);
+        return -EINVAL;
+    }
+
+    policy_get(&v);
+    if (strcmp(argv[1], "light") == 0) {
+        v.limit_light_kmh = (uint32_t)value;
+    } else if (strcmp(argv[1], "heavy") == 0) {
+        v.limit_heavy_kmh = (uint32_t)value;
+    } else if (strcmp(argv[1], "warning") == 0) {
+        v.warning_percent = (uint32_t)value;
+    } else if (strcmp(argv[1], "distance") == 0) {
+        v.distance_mm = (uint32_t)value;
+    } else if (vehicle_class_from_name(argv[1]) != VEHICLE_CLASS_COUNT) {
+        v.class_limit_kmh[vehicle_class_from_name(argv[1])] = (uint32_t)value;
+    } else {
+        shell_error(sh, "unknown field: %s", argv[1]);
+        return -EINVAL;
+    }
+
+    int ret = policy_update(&v);
+    if (ret == -EINVAL) {
+        shell_error(sh, "value out of range");
+    } else if (ret != 0) {
+        shell_warn(sh, "applied, but not persisted (%d)", ret);
+    }
+    return (ret == -EINVAL) ? ret : 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_radar_policy,
+    SHELL_CMD_ARG(show, NULL, "Show the enforcement policy", cmd_policy_show, 1, 0),
+    SHELL_CMD_ARG(set, NULL, "Set <light|heavy|warning|distance|class> <value>",
+                  cmd_policy_set, 3, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_radar,
+    SHELL_CMD(policy, &sub_radar_policy, "Enforcement policy", NULL),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(radar, &sub_radar, "Radar commands", NULL);
+#endif
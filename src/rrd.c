@@ -0,0 +1,198 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+#include "rrd.h"
+
+/* > One resolution: a ring of closed buckets plus the open one */
+struct rrd_ring {
+    uint32_t (*slots)[RRD_METRIC_COUNT];
+    uint32_t *stamps;                /* Bucket index each slot was closed as */
+    uint32_t len;
+    uint32_t width_ms;
+    int64_t cur;                     /* Index of the open bucket (time / width) */
+    uint32_t open[RRD_METRIC_COUNT]; /* Values of the open bucket */
+};
+
+static uint32_t second_slots[CONFIG_RADAR_RRD_SECONDS][RRD_METRIC_COUNT];
+static uint32_t minute_slots[CONFIG_RADAR_RRD_MINUTES][RRD_METRIC_COUNT];
+static uint32_t quarter_slots[CONFIG_RADAR_RRD_QUARTERS][RRD_METRIC_COUNT];
+static uint32_t second_stamps[CONFIG_RADAR_RRD_SECONDS];
+static uint32_t minute_stamps[CONFIG_RADAR_RRD_MINUTES];
+static uint32_t quarter_stamps[CONFIG_RADAR_RRD_QUARTERS];
+
+static struct rrd_ring rings[RRD_TIER_COUNT] = {
+    [RRD_TIER_SECOND] = { second_slots, second_stamps, CONFIG_RADAR_RRD_SECONDS, 1000U },
+    [RRD_TIER_MINUTE] = { minute_slots, minute_stamps, CONFIG_RADAR_RRD_MINUTES, 60U * 1000U },
+    [RRD_TIER_QUARTER] = { quarter_slots, quarter_stamps, CONFIG_RADAR_RRD_QUARTERS,
+                           15U * 60U * 1000U },
+};
+
+static struct k_spinlock rrd_lock;
+
+static void ring_feed(enum rrd_tier tier, int64_t t_ms, const uint32_t *values);
+
+/**
+ * @brief Closes the open bucket of a tier and moves it to bucket idx.
+ * Skipped buckets are not written: their slots keep an older stamp and read
+ * as empty. The coarser tier is told time moved on, so every tier stays
+ * aligned without touching history.
+ */
+static void ring_close_until(enum rrd_tier tier, int64_t idx)
+{
+    struct rrd_ring *r = &rings[tier];
+    int64_t skipped = idx - r->cur - 1;
+
+    memcpy(r->slots[r->cur % r->len], r->open, sizeof(r->open));
+    r->stamps[r->cur % r->len] = (uint32_t)r->cur;
+    ring_feed(tier + 1, r->cur * r->width_ms, r->open);
+
+    if (skipped > 0) {
+        ring_feed(tier + 1, (idx - 1) * r->width_ms, NULL);
+    }
+
+    memset(r->open, 0, sizeof(r->open));
+    r->cur = idx;
+}
+
+/**
+ * @brief Rolls the values of a closed finer bucket into a tier.
+ * @param tier The coarser tier (RRD_TIER_COUNT stops the rollup).
+ * @param t_ms The start of the finer bucket.
+ * @param values The values, NULL to only advance time.
+ */
+static void ring_feed(enum rrd_tier tier, int64_t t_ms, const uint32_t *values)
+{
+    if (tier >= RRD_TIER_COUNT) {
+        return;
+    }
+
+    struct rrd_ring *r = &rings[tier];
+    int64_t idx = t_ms / r->width_ms;
+
+    if (idx > r->cur) {
+        ring_close_until(tier, idx);
+    }
+    if (values != NULL) {
+        for (int m = 0; m < RRD_METRIC_COUNT; m++) {
+            r->open[m] += values[m];
+        }
+    }
+}
+
+/**
+ * @brief Closes every elapsed second. Must be called with rrd_lock held.
+ */
+static void advance_locked(int64_t now_ms)
+{
+    int64_t idx = now_ms / rings[RRD_TIER_SECOND].width_ms;
+
+    if (idx > rings[RRD_TIER_SECOND].cur) {
+        ring_close_until(RRD_TIER_SECOND, idx);
+    }
+    /* Coarser buckets close on their own boundary, not on the next input */
+    for (int t = RRD_TIER_MINUTE; t < RRD_TIER_COUNT; t++) {
+        ring_feed(t, now_ms, NULL);
+    }
+}
+
+/**
+ * @brief Clears the store.
+ * @param now_ms The current time.
+ */
+void rrd_init(int64_t now_ms)
+{
+    k_spinlock_key_t key = k_spin_lock(&rrd_lock);
+
+    for (int t = 0; t < RRD_TIER_COUNT; t++) {
+        struct rrd_ring *r = &rings[t];
+
+        /* Zeroed slots read as empty whatever their stamp */
+        memset(r->slots, 0, (size_t)r->len * sizeof(r->slots[0]));
+        memset(r->stamps, 0, (size_t)r->len * sizeof(r->stamps[0]));
+        memset(r->open, 0, sizeof(r->open));
+        r->cur = now_ms / r->width_ms;
+    }
+    k_spin_unlock(&rrd_lock, key);
+}
+
+/**
+ * @brief Adds to a counter in the current second.
+ * @param metric The counter.
+ * @param now_ms The event time.
+ * @param n The amount to add.
+ */
+void rrd_add(enum rrd_metric metric, int64_t now_ms, uint32_t n)
+{
+    if ((unsigned int)metric >= RRD_METRIC_COUNT) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&rrd_lock);
+
+    advance_locked(now_ms);
+    rings[RRD_TIER_SECOND].open[metric] += n;
+    k_spin_unlock(&rrd_lock, key);
+}
+
+/**
+ * @brief Closes every bucket that ended before now_ms, rolling it up.
+ * @param now_ms The current time.
+ */
+void rrd_advance(int64_t now_ms)
+{
+    k_spinlock_key_t key = k_spin_lock(&rrd_lock);
+
+    advance_locked(now_ms);
+    k_spin_unlock(&rrd_lock, key);
+}
+
+/**
+ * @brief Gets the bucket width of a tier.
+ * @param tier The tier.
+ * @return The width in ms, 0 for an unknown tier.
+ */
+uint32_t rrd_bucket_ms(enum rrd_tier tier)
+{
+    return ((unsigned int)tier < RRD_TIER_COUNT) ? rings[tier].width_ms : 0U;
+}
+
+/**
+ * @brief Reads one counter from the buckets of a tier starting in [from_ms, to_ms).
+ * The range maps straight to ring slots: the cost depends only on the
+ * number of buckets returned. A slot stamped with another bucket was
+ * skipped over and reads as zero.
+ * @param tier The tier.
+ * @param metric The counter.
+ * @param from_ms The start of the time range.
+ * @param to_ms The end of the time range.
+ * @param out The array to store the values, oldest first.
+ * @param max The capacity of out.
+ * @param first_ms Receives the start of the first bucket copied (may be NULL).
+ * @return The number of values copied, or -EINVAL.
+ */
+int rrd_query(enum rrd_tier tier, enum rrd_metric metric, int64_t from_ms, int64_t to_ms,
+              uint32_t *out, size_t max, int64_t *first_ms)
+{
+    if ((unsigned int)tier >= RRD_TIER_COUNT || (unsigned int)metric >= RRD_METRIC_COUNT) {
+        return -EINVAL;
+    }
+
+    const struct rrd_ring *r = &rings[tier];
+    int copied = 0;
+    k_spinlock_key_t key = k_spin_lock(&rrd_lock);
+    int64_t oldest = r->cur - r->len;
+    int64_t first = MAX(DIV_ROUND_UP(MAX(from_ms, 0), r->width_ms), oldest);
+    int64_t end = MIN(to_ms, r->cur * r->width_ms);
+
+    end = (end <= 0) ? 0 : DIV_ROUND_UP(end, r->width_ms);
+    if (first_ms != NULL) {
+        *first_ms = first * r->width_ms;
+    }
+    for (int64_t k = first; k < end && (size_t)copied < max; k++) {
+        uint32_t slot = (uint32_t)(k % r->len);
+
+        out[copied++] = (r->stamps[slot] == (uint32_t)k) ? r->slots[slot][metric] : 0U;
+    }
+    k_spin_unlock(&rrd_lock, key);
+    return copied;
+}
@@ -0,0 +1,273 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+#include "common.h"
+#include "section.h"
+
+#define SECTION_CAPACITY    CONFIG_RADAR_SECTION_CAPACITY
+/* Index at most half full: short linear probes even at capacity */
+#define SECTION_INDEX_SIZE  (1U << (LOG2CEIL(SECTION_CAPACITY) + 1U))
+#define SECTION_INDEX_MASK  (SECTION_INDEX_SIZE - 1U)
+#define SECTION_WHEEL_SIZE  256U
+#define SECTION_MAX_TRAVEL_MS ((int64_t)CONFIG_RADAR_SECTION_MAX_TRAVEL_S * 1000)
+#define SECTION_TICK_MS     DIV_ROUND_UP(SECTION_MAX_TRAVEL_MS, SECTION_WHEEL_SIZE - 1U)
+#define SECTION_NIL         UINT32_MAX
+
+/* > In-flight entry read; pool slots never move, the index points at them */
+struct section_read {
+    plate_id_t plate;
+    int64_t expire_ms;
+    uint32_t next; /* Wheel bucket list, or free list */
+    uint32_t prev;
+};
+
+static struct section_read pool[SECTION_CAPACITY];
+static uint32_t index_slots[SECTION_INDEX_SIZE];
+static uint32_t wheel[SECTION_WHEEL_SIZE];
+static uint32_t free_head;
+static size_t in_flight;
+static int64_t swept_ms; /* Time of the last sweep, -1 before the first */
+
+/**
+ * @brief Finds the index position of a plate.
+ * @param plate The plate.
+ * @return The position holding it, or the empty position ending its probe.
+ */
+static uint32_t section_probe(plate_id_t plate)
+{
+    uint32_t pos = plate_id_hash(plate) & SECTION_INDEX_MASK;
+
+    while (index_slots[pos] != SECTION_NIL && pool[index_slots[pos]].plate != plate) {
+        pos = (pos + 1U) & SECTION_INDEX_MASK;
+    }
+    return pos;
+}
+
+/**
+ * @brief Removes an index position with backward-shift deletion, so probes
+ * never need tombstones.
+ * @param pos The position to clear.
+ */
+static void section_index_remove(uint32_t pos)
+{
+    uint32_t next = (pos + 1U) & SECTION_INDEX_MASK;
+
+    while (index_slots[next] != SECTION_NIL) {
+        uint32_t home = plate_id_hash(pool[index_slots[next]].plate) & SECTION_INDEX_MASK;
+
+        /* Move the entry back unless its home lies in (pos, next] */
+        if (((next - home) & SECTION_INDEX_MASK) >= ((next - pos) & SECTION_INDEX_MASK)) {
+            index_slots[pos] = index_slots[next];
+            pos = next;
+        }
+        next = (next + 1U) & SECTION_INDEX_MASK;
+    }
+    index_slots[pos] = SECTION_NIL;
+}
+
+/**
+ * @brief Links a read into the wheel bucket of its expiry tick.
+ */
+static void section_wheel_link(uint32_t slot)
+{
+    uint32_t bucket = (uint32_t)((pool[slot].expire_ms / SECTION_TICK_MS) % SECTION_WHEEL_SIZE);
+
+    pool[slot].prev = SECTION_NIL;
+    pool[slot].next = wheel[bucket];
+    if (wheel[bucket] != SECTION_NIL) {
+        pool[wheel[bucket]].prev = slot;
+    }
+    wheel[bucket] = slot;
+}
+
+/**
+ * @brief Unlinks a read from its wheel bucket.
+ */
+static void section_wheel_unlink(uint32_t slot)
+{
+    struct section_read *r = &pool[slot];
+
+    if (r->prev != SECTION_NIL) {
+        pool[r->prev].next = r->next;
+    } else {
+        wheel[(r->expire_ms / SECTION_TICK_MS) % SECTION_WHEEL_SIZE] = r->next;
+    }
+    if (r->next != SECTION_NIL) {
+        pool[r->next].prev = r->prev;
+    }
+}
+
+/**
+ * @brief Returns a read to the free list.
+ */
+static void section_free(uint32_t slot)
+{
+    pool[slot].plate = PLATE_ID_NONE;
+    pool[slot].next = free_head;
+    free_head = slot;
+    in_flight--;
+}
+
+/**
+ * @brief Clears every in-flight read.
+ */
+void section_init(void)
+{
+    memset(index_slots, 0xFF, sizeof(index_slots));
+    memset(wheel, 0xFF, sizeof(wheel));
+    for (uint32_t i = 0; i < SECTION_CAPACITY; i++) {
+        pool[i].plate = PLATE_ID_NONE;
+        pool[i].next = (i + 1U < SECTION_CAPACITY) ? i + 1U : SECTION_NIL;
+    }
+    free_head = 0;
+    in_flight = 0;
+    swept_ms = -1;
+}
+
+/**
+ * @brief Records a vehicle passing the entry site.
+ * @param plate The plate read at the entry.
+ * @param entry_ms The read time (ms).
+ * @return 0 on success, negative errno otherwise.
+ */
+int section_entry(plate_id_t plate, int64_t entry_ms)
+{
+    if (!plate_id_is_valid(plate) || entry_ms < 0) {
+        return -EINVAL;
+    }
+
+    int64_t expire_ms = entry_ms + SECTION_MAX_TRAVEL_MS;
+    /* The last sweep would have dropped it: the read is stale */
+    if (expire_ms <= swept_ms) {
+        return -ETIMEDOUT;
+    }
+
+    uint32_t pos = section_probe(plate);
+    uint32_t slot = index_slots[pos];
+
+    if (slot != SECTION_NIL) {
+        section_wheel_unlink(slot);
+    } else {
+        if (free_head == SECTION_NIL) {
+            return -ENOSPC;
+        }
+        slot = free_head;
+        free_head = pool[slot].next;
+        index_slots[pos] = slot;
+        pool[slot].plate = plate;
+        in_flight++;
+    }
+
+    pool[slot].expire_ms = expire_ms;
+    section_wheel_link(slot);
+    return 0;
+}
+
+/**
+ * @brief Matches a vehicle passing the exit site and forgets its entry read.
+ * @param plate The plate read at the exit.
+ * @param exit_ms The read time (ms).
+ * @param entry_ms Receives the matching entry time.
+ * @return 0 on a match, -ENOENT if no entry read precedes the exit read,
+ *         -ETIMEDOUT if the entry read is past the maximum travel time.
+ */
+int section_exit(plate_id_t plate, int64_t exit_ms, int64_t *entry_ms)
+{
+    if (!plate_id_is_valid(plate)) {
+        return -ENOENT;
+    }
+
+    uint32_t pos = section_probe(plate);
+    uint32_t slot = index_slots[pos];
+    if (slot == SECTION_NIL) {
+        return -ENOENT;
+    }
+
+    /* An exit read older than the entry belongs to an earlier passage */
+    int64_t expire_ms = pool[slot].expire_ms;
+    int64_t entered_ms = expire_ms - SECTION_MAX_TRAVEL_MS;
+    if (exit_ms < entered_ms) {
+        return -ENOENT;
+    }
+
+    section_wheel_unlink(slot);
+    section_index_remove(pos);
+    section_free(slot);
+
+    /* Past the maximum travel time: the sweep had just not reached it yet */
+    if (exit_ms > expire_ms) {
+        return -ETIMEDOUT;
+    }
+    if (entry_ms != NULL) {
+        *entry_ms = entered_ms;
+    }
+    return 0;
+}
+
+/**
+ * @brief Drops entry reads older than the maximum travel time.
+ * Each call sweeps the buckets from the tick of the previous sweep up to
+ * now, so the work is proportional to the reads that actually expire.
+ * @param now_ms The current time (ms).
+ * @return The number of reads dropped.
+ */
+size_t section_expire(int64_t now_ms)
+{
+    int64_t now_tick = now_ms / SECTION_TICK_MS;
+    size_t dropped = 0;
+
+    if (now_ms <= swept_ms) {
+        return 0;
+    }
+
+    /* The previous tick may be partly swept; after a long pause one lap
+     * covers every bucket. Early in uptime the lap starts at tick 0.
+     */
+    int64_t first = MAX(now_tick - (int64_t)SECTION_WHEEL_SIZE + 1, 0);
+    if (swept_ms >= 0) {
+        first = MAX(first, swept_ms / SECTION_TICK_MS);
+    }
+
+    for (int64_t tick = first; tick <= now_tick; tick++) {
+        uint32_t slot = wheel[tick % SECTION_WHEEL_SIZE];
+
+        while (slot != SECTION_NIL) {
+            uint32_t next = pool[slot].next;
+
+            /* Reads a lap ahead share the bucket and stay */
+            if (pool[slot].expire_ms <= now_ms) {
+                section_wheel_unlink(slot);
+                section_index_remove(section_probe(pool[slot].plate));
+                section_free(slot);
+                dropped++;
+            }
+            slot = next;
+        }
+    }
+    swept_ms = now_ms;
+    return dropped;
+}
+
+/**
+ * @brief Gets the number of in-flight entry reads.
+ * @return The number of reads waiting for their exit.
+ */
+size_t section_in_flight(void)
+{
+    return in_flight;
+}
+
+/**
+ * @brief Computes the average speed over the section.
+ * @param entry_ms The entry read time.
+ * @param exit_ms The exit read time.
+ * @return The average speed in km/h.
+ */
+uint32_t section_average_kmh(int64_t entry_ms, int64_t exit_ms)
+{
+    if (exit_ms <= entry_ms || exit_ms - entry_ms > UINT32_MAX / 10) {
+        return 0;
+    }
+    return calculate_speed((uint32_t)CONFIG_RADAR_SECTION_LENGTH_M * 1000U,
+                           (uint32_t)(exit_ms - entry_ms));
+}
@@ -0,0 +1,155 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include "common.h"
+#include "infraction_log.h"
+#include "section.h"
+#include "section_control.h"
+#include "policy.h"
+
+LOG_MODULE_REGISTER(section_control, LOG_LEVEL_INF);
+
+/* Entry read on the wire: plate, then time, both little-endian */
+#define SECTION_MSG_SIZE 16
+#define SECTION_RX_PERIOD_MS 50
+
+/* Provided by section_link_native.c, linked into the native_sim runner */
+int section_native_open(const char *path, int listen);
+int section_native_send(int fd, const char *path, const void *buf, size_t len);
+int section_native_recv(int fd, void *buf, size_t len);
+int64_t section_native_wall_ms(void);
+
+static int link_fd = -1;
+
+/**
+ * @brief Gets the time base shared by both section sites.
+ * @return Milliseconds on the host wall clock.
+ */
+int64_t section_control_now_ms(void)
+{
+    return section_native_wall_ms();
+}
+
+#if defined(CONFIG_RADAR_SECTION_ROLE_ENTRY)
+
+/**
+ * @brief Forwards an entry read to the exit site.
+ * @param plate The plate read by the camera.
+ * @param read_ms The time the vehicle crossed the sensors.
+ * @param vclass Unused: the exit site applies the limit of its own read.
+ */
+void section_control_on_read(plate_id_t plate, int64_t read_ms, vehicle_class_t vclass)
+{
+    ARG_UNUSED(vclass);
+    uint8_t msg[SECTION_MSG_SIZE];
+
+    if (link_fd < 0) {
+        link_fd = section_native_open(CONFIG_RADAR_SECTION_LINK_PATH, 0);
+        if (link_fd < 0) {
+            LOG_ERR("Section link socket failed");
+            return;
+        }
+    }
+
+    sys_put_le64(plate, &msg[0]);
+    sys_put_le64((uint64_t)read_ms, &msg[8]);
+    if (section_native_send(link_fd, CONFIG_RADAR_SECTION_LINK_PATH, msg, sizeof(msg)) < 0) {
+        LOG_WRN("Section entry read not delivered (exit site down?)");
+    }
+}
+
+#else /* CONFIG_RADAR_SECTION_ROLE_EXIT */
+
+K_MUTEX_DEFINE(section_lock);
+
+/**
+ * @brief Handles an exit read: computes the average speed over the section.
+ * @param plate The plate read by the camera.
+ * @param read_ms The time the vehicle crossed the sensors.
+ * @param vclass The vehicle class.
+ */
+void section_control_on_read(plate_id_t plate, int64_t read_ms, vehicle_class_t vclass)
+{
+    int64_t entry_ms;
+
+    k_mutex_lock(&section_lock, K_FOREVER);
+    int ret = section_exit(plate, read_ms, &entry_ms);
+    k_mutex_unlock(&section_lock);
+
+    if (ret != 0) {
+        LOG_DBG("No entry read for this plate (%d)", ret);
+        return;
+    }
+
+    uint32_t avg_kmh = section_average_kmh(entry_ms, read_ms);
+    const struct radar_policy *policy = policy_acquire();
+    uint32_t limit = policy_limit_kmh(policy, vclass);
+    policy_release(policy);
+
+    LOG_INF("Section: %u km/h average over %d m (Limit: %u)", avg_kmh,
+            CONFIG_RADAR_SECTION_LENGTH_M, limit);
+    if (avg_kmh <= limit) {
+        return;
+    }
+
+    LOG_WRN("SECTION INFRACTION: average %u km/h (Limit: %u)", avg_kmh, limit);
+    infraction_record_t rec = {
+        .timestamp_ms = k_uptime_get(),
+        .type = vehicle_class_type(vclass),
+        .vclass = vclass,
+        .speed_kmh = avg_kmh,
+        .limit_kmh = limit,
+        .valid_read = true,
+        .plate = plate
+    };
+    infraction_log_add(&rec);
+}
+
+/**
+ * @brief Main entry point for the section receive thread.
+ * Drains entry reads from the link and expires stale ones.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void section_rx_thread_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    section_init();
+    link_fd = section_native_open(CONFIG_RADAR_SECTION_LINK_PATH, 1);
+    if (link_fd < 0) {
+        LOG_ERR("Cannot listen on %s", CONFIG_RADAR_SECTION_LINK_PATH);
+        return;
+    }
+    LOG_INF("Section exit site listening on %s", CONFIG_RADAR_SECTION_LINK_PATH);
+
+    while (1) {
+        uint8_t msg[SECTION_MSG_SIZE];
+        int n;
+
+        k_mutex_lock(&section_lock, K_FOREVER);
+        while ((n = section_native_recv(link_fd, msg, sizeof(msg))) > 0) {
+            if (n != SECTION_MSG_SIZE) {
+                continue;
+            }
+            int ret = section_entry(sys_get_le64(&msg[0]), (int64_t)sys_get_le64(&msg[8]));
+            if (ret == -ENOSPC) {
+                LOG_WRN("Section table full, entry read dropped");
+            }
+        }
+        size_t expired = section_expire(section_control_now_ms());
+        k_mutex_unlock(&section_lock);
+
+        if (expired > 0) {
+            LOG_DBG("%u entry reads expired", (unsigned int)expired);
+        }
+        k_msleep(SECTION_RX_PERIOD_MS);
+    }
+}
+
+K_THREAD_DEFINE(section_rx_tid, 1536, section_rx_thread_entry, NULL, NULL, NULL, 8, 0, 0);
+
+#endif
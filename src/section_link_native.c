@@ -0,0 +1,75 @@
+/*
+ * Runner-side helpers for native_sim: a Unix datagram socket carrying entry
+ * reads between two radar instances, plus the host wall clock they share.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+static int section_native_addr(const char *path, struct sockaddr_un *addr)
+{
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        return -1;
+    }
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+    return 0;
+}
+
+int section_native_open(const char *path, int listen)
+{
+    struct sockaddr_un addr;
+    int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+
+    if (fd < 0) {
+        return -1;
+    }
+    if (listen) {
+        if (section_native_addr(path, &addr) != 0) {
+            close(fd);
+            return -1;
+        }
+        unlink(path);
+        if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+    }
+    return fd;
+}
+
+int section_native_send(int fd, const char *path, const void *buf, size_t len)
+{
+    struct sockaddr_un addr;
+
+    if (section_native_addr(path, &addr) != 0) {
+        return -1;
+    }
+    return (int)sendto(fd, buf, len, 0, (struct sockaddr *)&addr, sizeof(addr));
+}
+
+/* Returns the datagram size, 0 when nothing is pending, -1 on error */
+int section_native_recv(int fd, void *buf, size_t len)
+{
+    ssize_t n = recv(fd, buf, len, 0);
+
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return (int)n;
+}
+
+int64_t section_native_wall_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
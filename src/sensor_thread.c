@@ -3,6 +3,13 @@
 #include <zephyr/logging/log.h>
 #include "common.h"
 #include "sensor_fsm.h"
+#include "timer_wheel.h"
+#include "edge_filter.h"
+#include "speed_fit.h"
+#include "loop_adc.h"
+#include "wim_adc.h"
+#include "flow_metrics.h"
+#include "policy.h"
 
 LOG_MODULE_REGISTER(sensor_thread, LOG_LEVEL_INF);
 
@@ -12,16 +19,49 @@ LOG_MODULE_REGISTER(sensor_thread, LOG_LEVEL_INF);
 static const struct gpio_dt_spec sensor_start_spec = GPIO_DT_SPEC_GET(DT_ALIAS(sensor0), gpios);
 static const struct gpio_dt_spec sensor_end_spec = GPIO_DT_SPEC_GET(DT_ALIAS(sensor1), gpios);
 
-/* > FSM + lock */
-static sensor_fsm_t fsm;
+#if defined(CONFIG_RADAR_SPEED_FIT)
+/* Loops between the start and end sensors, and where every loop lies */
+#define LOOP_ARRAY_NODE DT_INST(0, radar_loop_array)
+#define LOOP_COUNT DT_PROP_LEN(LOOP_ARRAY_NODE, positions_mm)
+#define LOOP_INNER DT_PROP_LEN(LOOP_ARRAY_NODE, loop_gpios)
+
+BUILD_ASSERT(LOOP_COUNT == LOOP_INNER + 2, "positions-mm lists the start, inner and end loops");
+BUILD_ASSERT(LOOP_COUNT <= SPEED_FIT_MAX_LOOPS, "raise CONFIG_RADAR_SPEED_FIT_MAX_LOOPS");
+
+static const uint32_t loop_position_mm[] = DT_PROP(LOOP_ARRAY_NODE, positions_mm);
+static const struct gpio_dt_spec loop_specs[] = {
+    DT_FOREACH_PROP_ELEM_SEP(LOOP_ARRAY_NODE, loop_gpios, GPIO_DT_SPEC_GET_BY_IDX, (,))
+};
+static struct gpio_callback loop_cb_data[LOOP_INNER];
+static struct speed_fit_model loop_model;
+static bool loop_model_ready;
+#else
+#define LOOP_COUNT 2
+#endif
+
+/* > Lane: FSM and its axle-window deadline on the wheel */
+struct sensor_lane {
+    sensor_fsm_t fsm;
+    struct timer_wheel_entry timeout;
+    sensor_data_t done;  /* Finalized on expiry, published by the tick */
+    bool produced;
+    struct edge_filter start_filter;
+    struct edge_filter end_filter;
+    /* First axle over each loop of the array, start to end */
+    uint32_t loop_cyc[SPEED_FIT_MAX_LOOPS];
+    uint32_t loops_seen;
+    struct edge_filter loop_filter[SPEED_FIT_MAX_LOOPS - 2];
+    int fit_status; /* Of the last finalized vehicle */
+    uint32_t wim_axles; /* Axles its strip saw, likewise */
+};
+
+/* > Lanes + lock; the lock also covers the wheel */
+static struct sensor_lane lanes[CONFIG_RADAR_LANE_COUNT];
 static struct k_spinlock fsm_lock;
 
-static struct k_timer axle_timer;
-/**
- * Timer expiry callback for the axle counting timeout.
- * @param timer_id Pointer to the timer.
- */
-static void axle_timer_expiry(struct k_timer *timer_id);
+/* One periodic tick drives the axle-window deadlines of every lane */
+static struct timer_wheel axle_wheel;
+static struct k_timer axle_wheel_timer;
 
 /**
  * @brief GPIO Callbacks
@@ -29,6 +69,55 @@ static void axle_timer_expiry(struct k_timer *timer_id);
 static struct gpio_callback start_cb_data;
 static struct gpio_callback end_cb_data;
 
+/**
+ * @brief Arms the axle-window deadline of a lane. Called with fsm_lock held.
+ * @param lane The lane.
+ * @param delay_ms Time to wait for another axle; rounded up to wheel ticks.
+ */
+static void sensor_lane_arm(struct sensor_lane *lane, uint32_t delay_ms)
+{
+    timer_wheel_schedule(&axle_wheel, &lane->timeout,
+                         DIV_ROUND_UP(delay_ms, CONFIG_RADAR_AXLE_WHEEL_TICK_MS));
+}
+
+/**
+ * @brief Passes an edge through a lane's debounce. Called with fsm_lock held.
+ * @param f The filter of the sensor.
+ * @param spec The sensor input, read for the level after the edge.
+ * @param cyc The cycle count when the edge was seen; moved back to the
+ *        start of the accepted pulse.
+ * @param now The uptime when the edge was seen; moved back likewise.
+ * @return True if the edge completes an accepted pulse.
+ */
+static bool sensor_edge_accept(struct edge_filter *f, const struct gpio_dt_spec *spec,
+                               uint32_t *cyc, int64_t *now)
+{
+    if (!IS_ENABLED(CONFIG_RADAR_EDGE_FILTER)) {
+        return true;
+    }
+    if (!edge_filter_edge(f, gpio_pin_get_dt(spec) > 0, *cyc)) {
+        return false;
+    }
+    *now -= k_cyc_to_ms_floor32(*cyc - f->rise_cyc);
+    *cyc = f->rise_cyc;
+    return true;
+}
+
+/**
+ * @brief Records the first axle over a loop of the array. Called with
+ * fsm_lock held.
+ * @param lane The lane.
+ * @param loop The loop; 0 is the start sensor, LOOP_COUNT - 1 the end one.
+ * @param cyc The cycle count when the axle reached the loop.
+ */
+static void sensor_loop_crossed(struct sensor_lane *lane, uint32_t loop, uint32_t cyc)
+{
+    if (!(lane->loops_seen & BIT(loop))) {
+        lane->loop_cyc[loop] = cyc;
+        lane->loops_seen |= BIT(loop);
+    }
+}
+
 /**
  * @brief Start interrupt service routine for the sensor.
  * @param dev Pointer to the device.
@@ -36,13 +125,28 @@ static struct gpio_callback end_cb_data;
  * @param pins Pins that triggered the interrupt.
  */
 static void start_isr(const struct device *dev, struct gpio_callback *cb, uint32_t pins) {
+    struct sensor_lane *lane = &lanes[0];
+    uint32_t cyc = k_cycle_get_32();
     int64_t now = k_uptime_get();
     k_spinlock_key_t key = k_spin_lock(&fsm_lock);
-    sensor_fsm_handle_start(&fsm, now);
-    uint32_t window_ms = sensor_fsm_get_axle_window_ms(&fsm);
+    if (!sensor_edge_accept(&lane->start_filter, &sensor_start_spec, &cyc, &now)) {
+        k_spin_unlock(&fsm_lock, key);
+        return;
+    }
+    if (IS_ENABLED(CONFIG_RADAR_SPEED_FIT)) {
+        if (lane->fsm.state == SENSOR_IDLE) {
+            lane->loops_seen = 0;
+        }
+        sensor_loop_crossed(lane, 0, cyc);
+    }
+    const struct radar_policy *policy = policy_acquire();
+    /* Spacings and the axle window follow the sensor distance in force */
+    lane->fsm.distance_mm = policy->v.distance_mm;
+    policy_release(policy);
+    sensor_fsm_handle_start(&lane->fsm, now);
+    /* Start or refresh the lane's timeout (configurable) */
+    sensor_lane_arm(lane, sensor_fsm_close_delay_ms(&lane->fsm, now));
     k_spin_unlock(&fsm_lock, key);
-    /* Start or refresh timeout timer (configurable) */
-    k_timer_start(&axle_timer, K_MSEC(window_ms), K_NO_WAIT);
 }
 
 /**
@@ -52,38 +156,246 @@ static void start_isr(const struct device *dev, struct gpio_callback *cb, uint32
  * @param pins Pins that triggered the interrupt.
  */
 static void end_isr(const struct device *dev, struct gpio_callback *cb, uint32_t pins) {
+    struct sensor_lane *lane = &lanes[0];
+    uint32_t cyc = k_cycle_get_32();
     int64_t now = k_uptime_get();
     k_spinlock_key_t key = k_spin_lock(&fsm_lock);
-    bool window_updated = sensor_fsm_handle_end(&fsm, now);
-    uint32_t window_ms = sensor_fsm_get_axle_window_ms(&fsm);
-    k_spin_unlock(&fsm_lock, key);
-    if (window_updated) {
-        k_timer_start(&axle_timer, K_MSEC(window_ms), K_NO_WAIT);
+    if (sensor_edge_accept(&lane->end_filter, &sensor_end_spec, &cyc, &now) &&
+        sensor_fsm_handle_end(&lane->fsm, now)) {
+        if (IS_ENABLED(CONFIG_RADAR_SPEED_FIT)) {
+            sensor_loop_crossed(lane, LOOP_COUNT - 1, cyc);
+        }
+        /* With the speed known, the window may close before the full timeout */
+        sensor_lane_arm(lane, sensor_fsm_close_delay_ms(&lane->fsm, now));
     }
+    k_spin_unlock(&fsm_lock, key);
 }
 
+#if defined(CONFIG_RADAR_SPEED_FIT)
 /**
- * @brief Timer expiry callback for the axle counting timeout.
- * @param timer_id Pointer to the timer.
+ * @brief Interrupt service routine of the loops between start and end.
+ * @param dev Pointer to the device.
+ * @param cb Pointer to the callback, which tells the loop.
+ * @param pins Pins that triggered the interrupt.
  */
-static void axle_timer_expiry(struct k_timer *timer_id) {
-    /* Timeout reached, check if we can finalize a measurement */
-    sensor_data_t data;
-    bool produced = false;
+static void loop_isr(const struct device *dev, struct gpio_callback *cb, uint32_t pins) {
+    struct sensor_lane *lane = &lanes[0];
+    size_t inner = cb - loop_cb_data;
+    uint32_t cyc = k_cycle_get_32();
+    int64_t now = k_uptime_get();
+    k_spinlock_key_t key = k_spin_lock(&fsm_lock);
+    /* Only the first axle of a vehicle already over the start sensor counts */
+    if (sensor_edge_accept(&lane->loop_filter[inner], &loop_specs[inner], &cyc, &now) &&
+        lane->fsm.state == SENSOR_ACTIVE) {
+        sensor_loop_crossed(lane, inner + 1U, cyc);
+    }
+    k_spin_unlock(&fsm_lock, key);
+}
+#endif
+
+int sensor_filter_configure(uint8_t lane, uint32_t min_pulse_us, uint32_t refractory_us)
+{
+    if (lane >= CONFIG_RADAR_LANE_COUNT) {
+        return -EINVAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&fsm_lock);
+    struct edge_filter *filters[] = { &lanes[lane].start_filter, &lanes[lane].end_filter };
+
+    for (size_t i = 0; i < ARRAY_SIZE(filters); i++) {
+        filters[i]->min_pulse_cyc = k_us_to_cyc_ceil32(min_pulse_us);
+        filters[i]->refractory_cyc = k_us_to_cyc_ceil32(refractory_us);
+    }
+    /* The loops in between follow the same sensor settings */
+    for (size_t i = 0; i < ARRAY_SIZE(lanes[lane].loop_filter); i++) {
+        lanes[lane].loop_filter[i].min_pulse_cyc = filters[0]->min_pulse_cyc;
+        lanes[lane].loop_filter[i].refractory_cyc = filters[0]->refractory_cyc;
+    }
+    k_spin_unlock(&fsm_lock, key);
+    return 0;
+}
+
+int sensor_noise_get(uint8_t lane, struct sensor_noise *out)
+{
+    if (lane >= CONFIG_RADAR_LANE_COUNT) {
+        return -EINVAL;
+    }
+
     k_spinlock_key_t key = k_spin_lock(&fsm_lock);
-    produced = sensor_fsm_finalize(&fsm, &data);
+    out->start = lanes[lane].start_filter.stats;
+    out->end = lanes[lane].end_filter.stats;
     k_spin_unlock(&fsm_lock, key);
+    return 0;
+}
+
+/**
+ * @brief Fits speed and acceleration to the loop crossings of a finalized
+ * vehicle. Called with fsm_lock held.
+ * @param lane The lane; its vehicle keeps the transit speed alone if a loop
+ *        was missed or the fit is rejected.
+ */
+static void sensor_lane_fit(struct sensor_lane *lane)
+{
+#if defined(CONFIG_RADAR_SPEED_FIT)
+    uint32_t t_us[LOOP_COUNT];
+    struct speed_fit fit;
+
+    if (!loop_model_ready || lane->loops_seen != BIT_MASK(LOOP_COUNT)) {
+        lane->fit_status = -ENODATA;
+        return;
+    }
+    speed_fit_cycles_to_us(lane->loop_cyc, LOOP_COUNT, t_us);
+    lane->fit_status = speed_fit_run(&loop_model, t_us, &fit);
+    if (lane->fit_status == 0) {
+        lane->done.fit_speed_ckmh = fit.speed_ckmh;
+        lane->done.fit_accel_mm_s2 = fit.accel_mm_s2;
+        lane->done.fit_confidence = fit.confidence;
+    }
+#else
+    ARG_UNUSED(lane);
+#endif
+}
+
+#if defined(CONFIG_RADAR_LOOP_ADC) || defined(CONFIG_RADAR_WIM)
+/**
+ * @brief Speed of a finalized vehicle, the loop fit if there is one.
+ * @param lane The lane.
+ * @return The speed in mm/s; 0 without a transit time.
+ */
+static uint32_t sensor_lane_speed_mm_s(const struct sensor_lane *lane)
+{
+    const sensor_data_t *data = &lane->done;
+
+    if (data->fit_speed_ckmh != 0U) {
+        /* 1 ckm/h is 25/9 mm/s */
+        return (data->fit_speed_ckmh * 25U) / 9U;
+    }
+    return (data->duration_ms != 0U) ?
+           (uint32_t)(((uint64_t)lane->fsm.distance_mm * 1000U) / data->duration_ms) : 0U;
+}
+#endif
+
+/**
+ * @brief Refines the class of a finalized vehicle with the signature its
+ * loop recorded. Called with fsm_lock held.
+ * @param lane The lane; its vehicle keeps the axle class if the loop saw
+ *        nothing since the vehicle arrived.
+ */
+static void sensor_lane_signature(struct sensor_lane *lane)
+{
+#if defined(CONFIG_RADAR_LOOP_ADC)
+    sensor_data_t *data = &lane->done;
+    struct loop_signature sig;
+
+    if (loop_adc_take(data->lane, data->timestamp_start, &sig) != 0) {
+        return;
+    }
+    data->vclass = loop_signature_fuse(data->vclass,
+                                       loop_signature_classify(&sig,
+                                                               CONFIG_RADAR_LOOP_ADC_INTERVAL_US,
+                                                               sensor_lane_speed_mm_s(lane)));
+    data->type = vehicle_class_type(data->vclass);
+#else
+    ARG_UNUSED(lane);
+#endif
+}
+
+/**
+ * @brief Weighs a finalized vehicle from the axles its strip recorded.
+ * Called with fsm_lock held.
+ * @param lane The lane; its vehicle stays unweighed unless the strip saw
+ *        as many axles as the sensors counted.
+ */
+static void sensor_lane_weigh(struct sensor_lane *lane)
+{
+#if defined(CONFIG_RADAR_WIM)
+    sensor_data_t *data = &lane->done;
+
+    lane->wim_axles = wim_adc_weigh(data->lane, data->timestamp_start,
+                                    sensor_lane_speed_mm_s(lane), data->axle_weight_kg,
+                                    ARRAY_SIZE(data->axle_weight_kg));
+    if (lane->wim_axles != data->axle_count) {
+        memset(data->axle_weight_kg, 0, sizeof(data->axle_weight_kg));
+        return;
+    }
+    for (uint32_t i = 0; i < lane->wim_axles; i++) {
+        data->gross_weight_kg += data->axle_weight_kg[i];
+    }
+#else
+    ARG_UNUSED(lane);
+#endif
+}
+
+/**
+ * @brief Wheel callback: finalizes the lane of an expired deadline.
+ * Called with fsm_lock held.
+ * @param entry The lane's timeout.
+ * @param arg Mask of the expired lanes.
+ */
+static void axle_window_expired(struct timer_wheel_entry *entry, void *arg)
+{
+    struct sensor_lane *lane = CONTAINER_OF(entry, struct sensor_lane, timeout);
+    uint32_t *expired = arg;
+
+    lane->produced = sensor_fsm_finalize(&lane->fsm, &lane->done);
+    if (IS_ENABLED(CONFIG_RADAR_SPEED_FIT) && lane->produced) {
+        sensor_lane_fit(lane);
+    }
+    if (IS_ENABLED(CONFIG_RADAR_LOOP_ADC) && lane->produced) {
+        sensor_lane_signature(lane);
+    }
+    if (IS_ENABLED(CONFIG_RADAR_WIM) && lane->produced) {
+        sensor_lane_weigh(lane);
+    }
+    *expired |= BIT(lane - lanes);
+}
+
+/**
+ * @brief Publishes the vehicle of a lane whose axle window closed.
+ * @param lane The lane, finalized by axle_window_expired().
+ */
+static void sensor_lane_publish(const struct sensor_lane *lane) {
+    const sensor_data_t *data = &lane->done;
+
+    if (lane->produced) {
+        LOG_INF("Vehicle Detected: Axles=%d, Wheelbase=%u cm, Time=%d ms, Class=%s",
+                data->axle_count, data->axle_spacing_cm[0], data->duration_ms,
+                vehicle_class_name(data->vclass));
+        if (data->fit_speed_ckmh != 0U) {
+            LOG_INF("Loop fit: %u.%02u km/h, %d mm/s^2, confidence %u%%",
+                    data->fit_speed_ckmh / 100U, data->fit_speed_ckmh % 100U,
+                    data->fit_accel_mm_s2, data->fit_confidence);
+        } else if (IS_ENABLED(CONFIG_RADAR_SPEED_FIT) && lane->fit_status == -ERANGE) {
+            LOG_WRN("Loop readings disagree, using the transit speed");
+        }
+        if (data->gross_weight_kg != 0U) {
+            uint32_t heaviest = 0;
 
-    if (produced) {
-        LOG_INF("Vehicle Detected: Axles=%d, Time=%d ms, Type=%s", 
-                data.axle_count, data.duration_ms, 
-                data.type == VEHICLE_LIGHT ? "Light" : "Heavy");
-        int ret = k_msgq_put(&sensor_msgq, &data, K_NO_WAIT);
+            for (uint32_t i = 0; i < data->axle_count; i++) {
+                heaviest = MAX(heaviest, data->axle_weight_kg[i]);
+            }
+            if (heaviest > CONFIG_RADAR_WIM_MAX_AXLE_KG ||
+                data->gross_weight_kg > CONFIG_RADAR_WIM_MAX_GROSS_KG) {
+                LOG_WRN("Overload: %u kg gross, heaviest axle %u kg", data->gross_weight_kg,
+                        heaviest);
+            } else {
+                LOG_INF("Weight: %u kg gross, heaviest axle %u kg", data->gross_weight_kg,
+                        heaviest);
+            }
+        } else if (IS_ENABLED(CONFIG_RADAR_WIM) && lane->wim_axles != 0U) {
+            LOG_WRN("Strip saw %u axle(s), sensors %u: not weighed", lane->wim_axles,
+                    data->axle_count);
+        }
+        if (IS_ENABLED(CONFIG_RADAR_FLOW_METRICS)) {
+            (void)flow_metrics_vehicle(data->lane, data->timestamp_start,
+                                       data->timestamp_last_axle);
+        }
+        int ret = k_msgq_put(&sensor_msgq, data, K_NO_WAIT);
         if (ret != 0) {
             /* Drop oldest and retry once */
             sensor_data_t dropped;
             (void)k_msgq_get(&sensor_msgq, &dropped, K_NO_WAIT);
-            ret = k_msgq_put(&sensor_msgq, &data, K_NO_WAIT);
+            ret = k_msgq_put(&sensor_msgq, data, K_NO_WAIT);
             if (ret != 0) {
                 LOG_WRN("sensor_msgq full, dropping measurement");
             }
@@ -93,6 +405,27 @@ static void axle_timer_expiry(struct k_timer *timer_id) {
     }
 }
 
+/**
+ * @brief Periodic wheel tick: finalizes and publishes every lane whose
+ * axle window closed.
+ * @param timer_id Pointer to the timer.
+ */
+static void axle_wheel_tick(struct k_timer *timer_id) {
+    ARG_UNUSED(timer_id);
+    uint32_t expired = 0;
+
+    /* Timeout reached, check if we can finalize a measurement */
+    k_spinlock_key_t key = k_spin_lock(&fsm_lock);
+    (void)timer_wheel_tick(&axle_wheel, axle_window_expired, &expired);
+    k_spin_unlock(&fsm_lock, key);
+
+    for (uint8_t l = 0; l < CONFIG_RADAR_LANE_COUNT; l++) {
+        if (expired & BIT(l)) {
+            sensor_lane_publish(&lanes[l]);
+        }
+    }
+}
+
 /**
  * @brief Main entry point for the sensor thread.
  * @param p1 Unused.
@@ -107,7 +440,27 @@ void sensor_thread_entry(void *p1, void *p2, void *p3) {
 
     int ret;
 
-    sensor_fsm_init(&fsm);
+    for (uint8_t l = 0; l < CONFIG_RADAR_LANE_COUNT; l++) {
+        sensor_fsm_init(&lanes[l].fsm);
+        lanes[l].fsm.lane = l;
+        timer_wheel_entry_init(&lanes[l].timeout);
+        edge_filter_init(&lanes[l].start_filter,
+                         k_us_to_cyc_ceil32(CONFIG_RADAR_EDGE_MIN_PULSE_US),
+                         k_us_to_cyc_ceil32(CONFIG_RADAR_EDGE_REFRACTORY_US));
+        lanes[l].end_filter = lanes[l].start_filter;
+        for (size_t i = 0; i < ARRAY_SIZE(lanes[l].loop_filter); i++) {
+            lanes[l].loop_filter[i] = lanes[l].start_filter;
+        }
+    }
+    timer_wheel_init(&axle_wheel);
+
+#if defined(CONFIG_RADAR_SPEED_FIT)
+    ret = speed_fit_model_init(&loop_model, loop_position_mm, LOOP_COUNT);
+    loop_model_ready = (ret == 0);
+    if (ret < 0) {
+        LOG_ERR("Loop positions cannot be fitted: %d", ret);
+    }
+#endif
 
     /* Check if the start sensor is ready */
     if (!gpio_is_ready_dt(&sensor_start_spec)) {
@@ -135,15 +488,19 @@ void sensor_thread_entry(void *p1, void *p2, void *p3) {
         return;
     }
 
+    /* The debounce times pulses, so it needs both edges */
+    gpio_flags_t edges = IS_ENABLED(CONFIG_RADAR_EDGE_FILTER) ? GPIO_INT_EDGE_BOTH :
+                                                                GPIO_INT_EDGE_RISING;
+
     /* Configure the start sensor as interrupt */
-    ret = gpio_pin_interrupt_configure_dt(&sensor_start_spec, GPIO_INT_EDGE_RISING);
+    ret = gpio_pin_interrupt_configure_dt(&sensor_start_spec, edges);
     if (ret < 0) {
         LOG_ERR("Error configuring interrupt start: %d", ret);
         return;
     }
 
     /* Configure the end sensor as interrupt */
-    ret = gpio_pin_interrupt_configure_dt(&sensor_end_spec, GPIO_INT_EDGE_RISING);
+    ret = gpio_pin_interrupt_configure_dt(&sensor_end_spec, edges);
     if (ret < 0) {
         LOG_ERR("Error configuring interrupt end: %d", ret);
         return;
@@ -156,8 +513,30 @@ void sensor_thread_entry(void *p1, void *p2, void *p3) {
     /* Initialize the end callback */
     gpio_init_callback(&end_cb_data, end_isr, BIT(sensor_end_spec.pin));
     gpio_add_callback(sensor_end_spec.port, &end_cb_data);
+
+#if defined(CONFIG_RADAR_SPEED_FIT)
+    /* The loops in between only time the first axle of each vehicle */
+    for (size_t i = 0; i < LOOP_INNER; i++) {
+        if (!gpio_is_ready_dt(&loop_specs[i])) {
+            LOG_ERR("Loop %u GPIO not ready", (uint32_t)i + 1U);
+            return;
+        }
+        ret = gpio_pin_configure_dt(&loop_specs[i], GPIO_INPUT);
+        if (ret == 0) {
+            ret = gpio_pin_interrupt_configure_dt(&loop_specs[i], edges);
+        }
+        if (ret < 0) {
+            LOG_ERR("Error configuring loop %u: %d", (uint32_t)i + 1U, ret);
+            return;
+        }
+        gpio_init_callback(&loop_cb_data[i], loop_isr, BIT(loop_specs[i].pin));
+        gpio_add_callback(loop_specs[i].port, &loop_cb_data[i]);
+    }
+#endif
     
-    k_timer_init(&axle_timer, axle_timer_expiry, NULL);
+    k_timer_init(&axle_wheel_timer, axle_wheel_tick, NULL);
+    k_timer_start(&axle_wheel_timer, K_MSEC(CONFIG_RADAR_AXLE_WHEEL_TICK_MS),
+                  K_MSEC(CONFIG_RADAR_AXLE_WHEEL_TICK_MS));
 
     LOG_INF("Sensor Thread Initialized");
 
@@ -0,0 +1,268 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+#include "sha256.h"
+
+/* Round constants, also used by the SHA-NI kernel */
+const uint32_t sha256_round_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#if defined(CONFIG_RADAR_SHA256_SHANI)
+/* Provided by sha256_shani.c, built with SHA extensions enabled */
+bool sha256_shani_supported(void);
+void sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t blocks);
+#endif
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32U - (n))))
+#define CH(x, y, z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+#define BSIG0(x) (ROTR(x, 2U) ^ ROTR(x, 13U) ^ ROTR(x, 22U))
+#define BSIG1(x) (ROTR(x, 6U) ^ ROTR(x, 11U) ^ ROTR(x, 25U))
+#define SSIG0(x) (ROTR(x, 7U) ^ ROTR(x, 18U) ^ ((x) >> 3U))
+#define SSIG1(x) (ROTR(x, 17U) ^ ROTR(x, 19U) ^ ((x) >> 10U))
+
+/* Message schedule kept in a 16-word ring: 64 bytes of stack, not 256 */
+#define SCHED(i)                                                                   \
+    (w[(i) & 15U] += SSIG1(w[((i) - 2U) & 15U]) + w[((i) - 7U) & 15U] +         \
+                     SSIG0(w[((i) - 15U) & 15U]))
+
+/* One round; the caller rotates the working variables by renaming them */
+#define ROUND(a, b, c, d, e, f, g, h, i, wi)                                       \
+    do {                                                                           \
+        uint32_t t1 = (h) + BSIG1(e) + CH(e, f, g) + sha256_round_k[i] + (wi);     \
+        (d) += t1;                                                                 \
+        (h) = t1 + BSIG0(a) + MAJ(a, b, c);                                        \
+    } while (0)
+
+/* Eight rounds: after them the variables are back in their original roles */
+#define ROUNDS8(i, W)                                                              \
+    do {                                                                           \
+        ROUND(a, b, c, d, e, f, g, h, (i) + 0U, W((i) + 0U));                      \
+        ROUND(h, a, b, c, d, e, f, g, (i) + 1U, W((i) + 1U));                      \
+        ROUND(g, h, a, b, c, d, e, f, (i) + 2U, W((i) + 2U));                      \
+        ROUND(f, g, h, a, b, c, d, e, (i) + 3U, W((i) + 3U));                      \
+        ROUND(e, f, g, h, a, b, c, d, (i) + 4U, W((i) + 4U));                      \
+        ROUND(d, e, f, g, h, a, b, c, (i) + 5U, W((i) + 5U));                      \
+        ROUND(c, d, e, f, g, h, a, b, (i) + 6U, W((i) + 6U));                      \
+        ROUND(b, c, d, e, f, g, h, a, (i) + 7U, W((i) + 7U));                      \
+    } while (0)
+
+#define LOAD(i) (w[i])
+
+/**
+ * @brief Portable compression function, unrolled eight rounds at a time so
+ * the working variables stay in registers (Cortex-M3 has 13 usable).
+ * @param state The chaining state.
+ * @param data The input blocks.
+ * @param blocks The number of 64-byte blocks.
+ */
+static void sha256_blocks_portable(uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+    uint32_t w[16];
+
+    while (blocks-- > 0U) {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (uint32_t i = 0; i < 16U; i++) {
+            w[i] = sys_get_be32(data + 4U * i);
+        }
+
+        ROUNDS8(0U, LOAD);
+        ROUNDS8(8U, LOAD);
+        for (uint32_t i = 16U; i < 64U; i += 8U) {
+            ROUNDS8(i, SCHED);
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        data += SHA256_BLOCK_SIZE;
+    }
+}
+
+/**
+ * @brief Runs the compression function with the best available kernel.
+ */
+static void sha256_blocks(uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+#if defined(CONFIG_RADAR_SHA256_SHANI)
+    if (sha256_shani_supported()) {
+        sha256_blocks_shani(state, data, blocks);
+        return;
+    }
+#endif
+    sha256_blocks_portable(state, data, blocks);
+}
+
+/**
+ * @brief Starts a SHA-256 computation.
+ * @param ctx The context to initialize.
+ */
+void sha256_init(struct sha256_ctx *ctx)
+{
+    static const uint32_t iv[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    memcpy(ctx->state, iv, sizeof(iv));
+    ctx->length = 0;
+    ctx->block_len = 0;
+}
+
+/**
+ * @brief Feeds data into a SHA-256 computation.
+ * @param ctx The context.
+ * @param data The data.
+ * @param len The size of the data.
+ */
+void sha256_update(struct sha256_ctx *ctx, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+
+    ctx->length += len;
+    if (ctx->block_len > 0U) {
+        size_t take = MIN(len, SHA256_BLOCK_SIZE - ctx->block_len);
+
+        memcpy(ctx->block + ctx->block_len, p, take);
+        ctx->block_len += take;
+        p += take;
+        len -= take;
+        if (ctx->block_len < SHA256_BLOCK_SIZE) {
+            return;
+        }
+        sha256_blocks(ctx->state, ctx->block, 1);
+        ctx->block_len = 0;
+    }
+
+    /* Whole blocks straight from the input, no copy */
+    if (len >= SHA256_BLOCK_SIZE) {
+        size_t blocks = len / SHA256_BLOCK_SIZE;
+
+        sha256_blocks(ctx->state, p, blocks);
+        p += blocks * SHA256_BLOCK_SIZE;
+        len -= blocks * SHA256_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->block, p, len);
+    ctx->block_len = len;
+}
+
+/**
+ * @brief Finishes a SHA-256 computation.
+ * @param ctx The context.
+ * @param digest Receives the digest.
+ */
+void sha256_final(struct sha256_ctx *ctx, uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    uint64_t bits = ctx->length * 8U;
+    size_t n = ctx->block_len;
+
+    ctx->block[n++] = 0x80;
+    if (n > SHA256_BLOCK_SIZE - 8U) {
+        memset(ctx->block + n, 0, SHA256_BLOCK_SIZE - n);
+        sha256_blocks(ctx->state, ctx->block, 1);
+        n = 0;
+    }
+    memset(ctx->block + n, 0, SHA256_BLOCK_SIZE - 8U - n);
+    sys_put_be64(bits, ctx->block + SHA256_BLOCK_SIZE - 8U);
+    sha256_blocks(ctx->state, ctx->block, 1);
+
+    for (size_t i = 0; i < 8U; i++) {
+        sys_put_be32(ctx->state[i], digest + 4U * i);
+    }
+}
+
+/**
+ * @brief Computes the SHA-256 digest of a buffer in one call.
+ * @param data The data.
+ * @param len The size of the data.
+ * @param digest Receives the digest.
+ */
+void sha256(const void *data, size_t len, uint8_t digest[SHA256_DIGEST_SIZE])
+{
+    struct sha256_ctx ctx;
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, digest);
+}
+
+/**
+ * @brief Checks a buffer against an expected SHA-256 digest.
+ * @param data The data.
+ * @param len The size of the data.
+ * @param expected The expected digest.
+ * @return True if the digest of the data matches.
+ */
+bool sha256_verify(const void *data, size_t len, const uint8_t expected[SHA256_DIGEST_SIZE])
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    uint8_t diff = 0;
+
+    sha256(data, len, digest);
+    for (size_t i = 0; i < SHA256_DIGEST_SIZE; i++) {
+        diff |= digest[i] ^ expected[i];
+    }
+    return diff == 0U;
+}
+
+/**
+ * @brief Computes HMAC-SHA256 (RFC 2104).
+ * @param key The key.
+ * @param key_len The size of the key.
+ * @param data The message.
+ * @param len The size of the message.
+ * @param mac Receives the authentication code.
+ */
+void hmac_sha256(const void *key, size_t key_len, const void *data, size_t len,
+                 uint8_t mac[SHA256_DIGEST_SIZE])
+{
+    uint8_t pad[SHA256_BLOCK_SIZE] = {0};
+    uint8_t inner[SHA256_DIGEST_SIZE];
+    struct sha256_ctx ctx;
+
+    if (key_len > SHA256_BLOCK_SIZE) {
+        sha256(key, key_len, pad);
+    } else {
+        memcpy(pad, key, key_len);
+    }
+
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        pad[i] ^= 0x36;
+    }
+    sha256_init(&ctx);
+    sha256_update(&ctx, pad, sizeof(pad));
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, inner);
+
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        pad[i] ^= 0x36 ^ 0x5c;
+    }
+    sha256_init(&ctx);
+    sha256_update(&ctx, pad, sizeof(pad));
+    sha256_update(&ctx, inner, sizeof(inner));
+    sha256_final(&ctx, mac);
+}
+
+/**
+ * @brief Names the compression kernel in use.
+ * @return The kernel name.
+ */
+const char *sha256_kernel(void)
+{
+#if defined(CONFIG_RADAR_SHA256_SHANI)
+    if (sha256_shani_supported()) {
+        return "sha-ni";
+    }
+#endif
+    return "portable";
+}
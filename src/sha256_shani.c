@@ -0,0 +1,88 @@
+/*
+ * SHA-256 compression with the x86 SHA extensions (native_sim only).
+ * Built with -msha -msse4.1; only called after sha256_shani_supported()
+ * confirmed the host CPU has them.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <cpuid.h>
+#include <immintrin.h>
+
+extern const uint32_t sha256_round_k[64];
+
+/**
+ * @brief Checks once whether the host CPU supports SHA, SSSE3 and SSE4.1.
+ * @return True if sha256_blocks_shani() can run.
+ */
+bool sha256_shani_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        unsigned int eax, ebx, ecx, edx;
+        bool ok = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3) &&
+                  (ecx & bit_SSE4_1) && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+                  (ebx & bit_SHA);
+
+        supported = ok ? 1 : 0;
+    }
+    return supported == 1;
+}
+
+/**
+ * @brief Compresses 64-byte blocks with SHA256RNDS2/MSG1/MSG2.
+ * @param state The chaining state.
+ * @param data The input blocks.
+ * @param blocks The number of blocks.
+ */
+void sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+
+    /* Reorder into the ABEF / CDGH layout the instructions work on */
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    while (blocks-- > 0U) {
+        const __m128i abef = state0;
+        const __m128i cdgh = state1;
+        __m128i m[4];
+
+        for (int i = 0; i < 4; i++) {
+            m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+        }
+
+#pragma GCC unroll 16
+        for (int i = 0; i < 16; i++) {
+            __m128i msg = _mm_add_epi32(m[i & 3],
+                                        _mm_loadu_si128((const __m128i *)&sha256_round_k[4 * i]));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+
+            /* W[4i+16..4i+19] replaces W[4i..4i+3] in the ring */
+            if (i < 12) {
+                __m128i t = _mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]);
+
+                t = _mm_add_epi32(t, _mm_alignr_epi8(m[(i + 3) & 3], m[(i + 2) & 3], 4));
+                m[i & 3] = _mm_sha256msg2_epu32(t, m[(i + 3) & 3]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
@@ -0,0 +1,209 @@
+#include <zephyr/kernel.h>
+#include "speed_fit.h"
+
+/* Rows of the pseudo-inverse are scaled to this magnitude */
+#define SPEED_FIT_WEIGHT_MAX (1LL << 30)
+
+int speed_fit_model_init(struct speed_fit_model *model, const uint32_t *position_mm,
+                         size_t loops)
+{
+    if (loops < 3U || loops > SPEED_FIT_MAX_LOOPS) {
+        return -EINVAL;
+    }
+
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < loops; i++) {
+        if (position_mm[i] > SPEED_FIT_MAX_POSITION_MM ||
+            (i > 0 && position_mm[i] <= position_mm[i - 1])) {
+            return -EINVAL;
+        }
+        sum += position_mm[i];
+    }
+
+    /* Centroid rounded to the mm, so the per-vehicle path uses exact u */
+    int32_t centre = (int32_t)((sum + loops / 2U) / loops);
+    /* Moments of u in metres, which keeps the 3x3 system well scaled */
+    double s[5] = { 0 };
+
+    for (size_t i = 0; i < loops; i++) {
+        double p = 1.0;
+
+        model->u_mm[i] = (int32_t)position_mm[i] - centre;
+        for (int k = 0; k < 5; k++) {
+            s[k] += p;
+            p *= model->u_mm[i] / 1000.0;
+        }
+    }
+
+    /* Inverse of the normal matrix [s0 s1 s2; s1 s2 s3; s2 s3 s4], by cofactors */
+    double inv[3][3] = {
+        { s[2] * s[4] - s[3] * s[3], s[2] * s[3] - s[1] * s[4], s[1] * s[3] - s[2] * s[2] },
+        { 0, s[0] * s[4] - s[2] * s[2], s[1] * s[2] - s[0] * s[3] },
+        { 0, 0, s[0] * s[2] - s[1] * s[1] },
+    };
+    double det = s[0] * inv[0][0] + s[1] * inv[0][1] + s[2] * inv[0][2];
+
+    if (!(det > 0.0)) {
+        return -EINVAL;
+    }
+    inv[1][0] = inv[0][1];
+    inv[2][0] = inv[0][2];
+    inv[2][1] = inv[1][2];
+
+    /* Undo the metre scaling: c1 is per mm, c2 per mm^2 */
+    static const double unit[3] = { 1.0, 1e-3, 1e-6 };
+    double w[3][SPEED_FIT_MAX_LOOPS];
+
+    for (int k = 0; k < 3; k++) {
+        double max = 0.0;
+
+        for (size_t i = 0; i < loops; i++) {
+            double v = model->u_mm[i] / 1000.0;
+
+            w[k][i] = (inv[k][0] + inv[k][1] * v + inv[k][2] * v * v) * unit[k] / det;
+            max = MAX(max, (w[k][i] < 0.0) ? -w[k][i] : w[k][i]);
+        }
+
+        uint8_t shift = 0;
+
+        while (shift < 62U && max * (double)(1ULL << (shift + 1U)) < SPEED_FIT_WEIGHT_MAX) {
+            shift++;
+        }
+        model->shift[k] = shift;
+        for (size_t i = 0; i < loops; i++) {
+            double scaled = w[k][i] * (double)(1ULL << shift);
+
+            model->w[k][i] = (int32_t)((scaled < 0.0) ? scaled - 0.5 : scaled + 0.5);
+        }
+    }
+    model->loops = (uint8_t)loops;
+    return 0;
+}
+
+/**
+ * @brief Computes one fit coefficient.
+ * @param model The loop array.
+ * @param k The coefficient: 0 for c0, 1 for c1, 2 for c2.
+ * @param t Crossing times from the first loop, in us.
+ * @param q Fraction bits of the result.
+ * @return The coefficient, rounded to 2^-q.
+ */
+static int64_t speed_fit_coef(const struct speed_fit_model *model, int k, const int32_t *t,
+                              int q)
+{
+    int64_t acc = 0;
+
+    for (uint8_t i = 0; i < model->loops; i++) {
+        acc += (int64_t)model->w[k][i] * t[i];
+    }
+
+    int s = model->shift[k] - q;
+
+    if (s > 0) {
+        return (acc + (1LL << (s - 1))) >> s;
+    }
+    return acc * (1LL << -s);
+}
+
+/**
+ * @brief Integer square root.
+ * @param x The value.
+ * @return floor(sqrt(x)).
+ */
+static uint32_t speed_fit_isqrt(uint64_t x)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0U) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+int speed_fit_run(const struct speed_fit_model *model, const uint32_t *t_us,
+                  struct speed_fit *out)
+{
+    int32_t t[SPEED_FIT_MAX_LOOPS];
+
+    for (uint8_t i = 0; i < model->loops; i++) {
+        uint32_t d = t_us[i] - t_us[0];
+
+        if (d >= SPEED_FIT_MAX_SPAN_US || (i > 0 && (int32_t)d <= t[i - 1])) {
+            return -EINVAL;
+        }
+        t[i] = (int32_t)d;
+    }
+
+    /* c0 in us (Q8), c1 in us/mm (Q16), c2 in us/mm^2 (Q32) */
+    int64_t c0 = speed_fit_coef(model, 0, t, 8);
+    int64_t c1 = speed_fit_coef(model, 1, t, 16);
+    int64_t c2 = speed_fit_coef(model, 2, t, 32);
+
+    /* Bounds that keep the products below in 64 bits */
+    if (c1 <= 0 || c2 > (1LL << 32) || c2 < -(1LL << 32)) {
+        return -ERANGE;
+    }
+
+    const int64_t limit = (int64_t)CONFIG_RADAR_SPEED_FIT_MAX_RESIDUAL_US << 8;
+    uint64_t sq = 0;
+    int64_t worst = 0;
+
+    for (uint8_t i = 0; i < model->loops; i++) {
+        int64_t u = model->u_mm[i];
+        int64_t r = ((int64_t)t[i] << 8) - (c0 + ((c1 * u) >> 8) + ((c2 * u * u) >> 24));
+
+        r = (r < 0) ? -r : r;
+        if (r > limit) {
+            return -ERANGE;
+        }
+        worst = MAX(worst, r);
+        sq += (uint64_t)(r * r);
+    }
+
+    uint8_t dof = model->loops - 3U;
+    int64_t rms = (dof > 0U) ? speed_fit_isqrt(sq / dof) : 0;
+
+    if (rms > limit) {
+        return -ERANGE;
+    }
+
+    /* km/h = 3600 / (us/mm) */
+    uint64_t speed_ckmh = (360000ULL << 16) / (uint64_t)c1;
+
+    if (speed_ckmh > SPEED_FIT_MAX_KMH * 100U) {
+        return -ERANGE;
+    }
+
+    /* a = -2 c2 v^3, with v in mm/ms (Q8): c2 v^3 comes out in 1e-3 mm/ms^2 */
+    int64_t v = (int64_t)((1000ULL << 24) / (uint64_t)c1);
+    int64_t y = c2;
+
+    for (int i = 0; i < 3; i++) {
+        y = (y * v) >> 8;
+    }
+
+    int64_t accel = -(((y >> 12) * 2000) >> 20);
+
+    if (accel > CONFIG_RADAR_SPEED_FIT_MAX_ACCEL_MM_S2 ||
+        accel < -CONFIG_RADAR_SPEED_FIT_MAX_ACCEL_MM_S2) {
+        return -ERANGE;
+    }
+
+    out->speed_ckmh = (uint32_t)speed_ckmh;
+    out->accel_mm_s2 = (int32_t)accel;
+    out->rms_us = (uint32_t)((rms + 128) >> 8);
+    out->max_residual_us = (uint32_t)((worst + 128) >> 8);
+    out->confidence = (dof > 0U) ? (uint8_t)(100 - (100 * rms) / (limit + 1)) : 0U;
+    return 0;
+}
@@ -0,0 +1,352 @@
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <math.h>
+#include <string.h>
+#include "speed_stats.h"
+
+#define SPEED_STATS_LANES    CONFIG_RADAR_LANE_COUNT
+#define SPEED_STATS_HISTORY  CONFIG_RADAR_SPEED_STATS_HISTORY
+#define SPEED_STATS_INTERVAL_MS ((int64_t)CONFIG_RADAR_SPEED_STATS_INTERVAL_S * 1000)
+#define SPEED_STATS_QUANTILE 0.85f
+
+static struct speed_stats_acc lanes[SPEED_STATS_LANES];
+/* Interval k occupies row k % SPEED_STATS_HISTORY, one column per lane. A
+ * row whose start_ms is not interval k's was skipped over and reads as empty.
+ */
+static struct speed_stats_summary history[SPEED_STATS_HISTORY][SPEED_STATS_LANES];
+static int64_t epoch_ms;     /* Start of interval 0 */
+static int64_t current_start_ms;
+static uint32_t closed_count; /* Intervals closed since init */
+static struct k_spinlock stats_lock;
+
+/**
+ * @brief Initializes a P² estimator.
+ * @param p2 The estimator.
+ */
+void speed_p2_init(struct speed_p2 *p2)
+{
+    memset(p2, 0, sizeof(*p2));
+}
+
+/**
+ * @brief Sorts a handful of floats in place (insertion sort).
+ */
+static void p2_sort(float *v, uint32_t n)
+{
+    for (uint32_t i = 1; i < n; i++) {
+        float x = v[i];
+        uint32_t j = i;
+
+        while (j > 0 && v[j - 1] > x) {
+            v[j] = v[j - 1];
+            j--;
+        }
+        v[j] = x;
+    }
+}
+
+/**
+ * @brief Adds an observation to a P² estimator.
+ * Five markers track the minimum, p/2, p, (1+p)/2 and the maximum; the
+ * middle three move by piecewise-parabolic interpolation.
+ * @param p2 The estimator.
+ * @param p The quantile tracked, in (0, 1).
+ * @param x The observation.
+ */
+void speed_p2_add(struct speed_p2 *p2, float p, float x)
+{
+    if (p2->count < 5U) {
+        p2->q[p2->count++] = x;
+        if (p2->count == 5U) {
+            p2_sort(p2->q, 5U);
+            for (int i = 0; i < 5; i++) {
+                p2->n[i] = i;
+            }
+            p2->np[0] = 0.0f;
+            p2->np[1] = 2.0f * p;
+            p2->np[2] = 4.0f * p;
+            p2->np[3] = 2.0f + 2.0f * p;
+            p2->np[4] = 4.0f;
+        }
+        return;
+    }
+
+    int k;
+    if (x < p2->q[0]) {
+        p2->q[0] = x;
+        k = 0;
+    } else if (x >= p2->q[4]) {
+        p2->q[4] = x;
+        k = 3;
+    } else {
+        k = 0;
+        while (x >= p2->q[k + 1]) {
+            k++;
+        }
+    }
+
+    for (int i = k + 1; i < 5; i++) {
+        p2->n[i]++;
+    }
+    p2->np[1] += p / 2.0f;
+    p2->np[2] += p;
+    p2->np[3] += (1.0f + p) / 2.0f;
+    p2->np[4] += 1.0f;
+    p2->count++;
+
+    for (int i = 1; i < 4; i++) {
+        float d = p2->np[i] - (float)p2->n[i];
+        int32_t right = p2->n[i + 1] - p2->n[i];
+        int32_t left = p2->n[i - 1] - p2->n[i];
+
+        if ((d >= 1.0f && right > 1) || (d <= -1.0f && left < -1)) {
+            int s = (d > 0.0f) ? 1 : -1;
+            float nl = (float)(p2->n[i] - p2->n[i - 1]);
+            float nr = (float)(p2->n[i + 1] - p2->n[i]);
+            float qp = p2->q[i] + (float)s / (nl + nr) *
+                       ((nl + (float)s) * (p2->q[i + 1] - p2->q[i]) / nr +
+                        (nr - (float)s) * (p2->q[i] - p2->q[i - 1]) / nl);
+
+            if (p2->q[i - 1] < qp && qp < p2->q[i + 1]) {
+                p2->q[i] = qp;
+            } else {
+                /* Parabola overshoots a neighbour: move linearly */
+                p2->q[i] += (float)s * (p2->q[i + s] - p2->q[i]) /
+                            (float)(p2->n[i + s] - p2->n[i]);
+            }
+            p2->n[i] += s;
+        }
+    }
+}
+
+/**
+ * @brief Gets the quantile estimate of a P² estimator.
+ * @param p2 The estimator.
+ * @param p The quantile tracked.
+ * @return The estimate, 0 without observations.
+ */
+float speed_p2_get(const struct speed_p2 *p2, float p)
+{
+    if (p2->count == 0U) {
+        return 0.0f;
+    }
+    if (p2->count >= 5U) {
+        return p2->q[2];
+    }
+
+    /* Too few samples for markers: exact nearest-rank quantile */
+    float v[4];
+    memcpy(v, p2->q, p2->count * sizeof(float));
+    p2_sort(v, p2->count);
+    uint32_t rank = (uint32_t)ceilf(p * (float)p2->count);
+    return v[(rank > 0U) ? rank - 1U : 0U];
+}
+
+/**
+ * @brief Resets a lane accumulator for a new interval.
+ */
+static void acc_reset(struct speed_stats_acc *acc)
+{
+    memset(acc, 0, sizeof(*acc));
+    acc->min_kmh = UINT16_MAX;
+    speed_p2_init(&acc->p85);
+}
+
+/**
+ * @brief Builds the summary of a lane accumulator.
+ */
+static void acc_summarize(const struct speed_stats_acc *acc, uint8_t lane, int64_t start_ms,
+                          struct speed_stats_summary *out)
+{
+    out->start_ms = start_ms;
+    out->count = acc->count;
+    out->lane = lane;
+    out->min_kmh = (acc->count > 0U) ? acc->min_kmh : 0U;
+    out->max_kmh = acc->max_kmh;
+    out->mean_kmh = (float)acc->mean;
+    out->stddev_kmh = (acc->count > 1U) ? sqrtf((float)(acc->m2 / (acc->count - 1U))) : 0.0f;
+    out->p85_kmh = speed_p2_get(&acc->p85, SPEED_STATS_QUANTILE);
+    for (uint32_t b = 0; b < SPEED_STATS_BUCKETS; b++) {
+        out->hist[b] = (uint16_t)MIN(acc->hist[b], UINT16_MAX);
+    }
+}
+
+/**
+ * @brief Closes the current interval of every lane into the history.
+ * Must be called with stats_lock held.
+ */
+static void close_interval_locked(void)
+{
+    struct speed_stats_summary *row = history[closed_count % SPEED_STATS_HISTORY];
+
+    for (uint8_t lane = 0; lane < SPEED_STATS_LANES; lane++) {
+        acc_summarize(&lanes[lane], lane, current_start_ms, &row[lane]);
+        acc_reset(&lanes[lane]);
+    }
+    current_start_ms += SPEED_STATS_INTERVAL_MS;
+    closed_count++;
+}
+
+/**
+ * @brief Closes every elapsed interval. Must be called with stats_lock held.
+ * Only the open interval is written; the empty ones after it keep stale
+ * rows, so a long pause costs the same as a single interval.
+ */
+static void advance_locked(int64_t now_ms)
+{
+    if (now_ms < current_start_ms + SPEED_STATS_INTERVAL_MS) {
+        return;
+    }
+
+    int64_t skip = (now_ms - current_start_ms) / SPEED_STATS_INTERVAL_MS - 1;
+
+    close_interval_locked();
+    closed_count += (uint32_t)skip;
+    current_start_ms += skip * SPEED_STATS_INTERVAL_MS;
+}
+
+/**
+ * @brief Resets the accumulators and the history.
+ * @param now_ms Start of the first interval.
+ */
+void speed_stats_init(int64_t now_ms)
+{
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+    for (uint8_t lane = 0; lane < SPEED_STATS_LANES; lane++) {
+        acc_reset(&lanes[lane]);
+    }
+    /* Stamp every row as an interval before the first */
+    for (uint32_t k = 0; k < SPEED_STATS_HISTORY; k++) {
+        for (uint8_t lane = 0; lane < SPEED_STATS_LANES; lane++) {
+            history[k][lane].start_ms = now_ms - SPEED_STATS_INTERVAL_MS;
+        }
+    }
+    epoch_ms = now_ms;
+    current_start_ms = now_ms;
+    closed_count = 0;
+    k_spin_unlock(&stats_lock, key);
+}
+
+/**
+ * @brief Adds a vehicle to its lane's current interval.
+ * @param lane The lane.
+ * @param speed_kmh The measured speed.
+ * @param now_ms The measurement time.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int speed_stats_add(uint8_t lane, uint32_t speed_kmh, int64_t now_ms)
+{
+    if (lane >= SPEED_STATS_LANES) {
+        return -EINVAL;
+    }
+
+    uint16_t kmh = (uint16_t)MIN(speed_kmh, UINT16_MAX);
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+    struct speed_stats_acc *acc = &lanes[lane];
+
+    advance_locked(now_ms);
+
+    /* Welford: numerically stable running mean and variance */
+    acc->count++;
+    double delta = (double)kmh - acc->mean;
+    acc->mean += delta / acc->count;
+    acc->m2 += delta * ((double)kmh - acc->mean);
+
+    acc->min_kmh = MIN(acc->min_kmh, kmh);
+    acc->max_kmh = MAX(acc->max_kmh, kmh);
+    acc->hist[MIN(kmh / SPEED_STATS_BUCKET_KMH, SPEED_STATS_BUCKETS - 1U)]++;
+    speed_p2_add(&acc->p85, SPEED_STATS_QUANTILE, (float)kmh);
+
+    k_spin_unlock(&stats_lock, key);
+    return 0;
+}
+
+/**
+ * @brief Closes every interval that ended before now_ms.
+ * @param now_ms The current time.
+ */
+void speed_stats_advance(int64_t now_ms)
+{
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+    advance_locked(now_ms);
+    k_spin_unlock(&stats_lock, key);
+}
+
+/**
+ * @brief Summarizes a lane's current, still open, interval.
+ * @param lane The lane.
+ * @param out Receives the summary.
+ * @return 0 on success, -EINVAL for an unknown lane.
+ */
+int speed_stats_current(uint8_t lane, struct speed_stats_summary *out)
+{
+    if (lane >= SPEED_STATS_LANES) {
+        return -EINVAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+    acc_summarize(&lanes[lane], lane, current_start_ms, out);
+    k_spin_unlock(&stats_lock, key);
+    return 0;
+}
+
+/**
+ * @brief Finds the first interval starting at or after a time, capped at
+ * the number of closed intervals. Must be called with stats_lock held.
+ */
+static int64_t interval_at_or_after(int64_t t_ms)
+{
+    if (t_ms <= epoch_ms) {
+        return 0;
+    }
+    if (t_ms - epoch_ms > (int64_t)closed_count * SPEED_STATS_INTERVAL_MS) {
+        return closed_count;
+    }
+    return DIV_ROUND_UP(t_ms - epoch_ms, SPEED_STATS_INTERVAL_MS);
+}
+
+/**
+ * @brief Gets the closed intervals of a lane that started in [from_ms, to_ms).
+ * Intervals have a fixed length, so the range maps straight to ring rows.
+ * @param lane The lane.
+ * @param from_ms The start of the time range.
+ * @param to_ms The end of the time range.
+ * @param out The array to store the summaries, oldest first.
+ * @param max The capacity of out.
+ * @return The number of summaries copied.
+ */
+size_t speed_stats_query(uint8_t lane, int64_t from_ms, int64_t to_ms,
+                         struct speed_stats_summary *out, size_t max)
+{
+    size_t copied = 0;
+
+    if (lane >= SPEED_STATS_LANES || to_ms <= from_ms) {
+        return 0;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+    int64_t oldest = (closed_count > SPEED_STATS_HISTORY) ? closed_count - SPEED_STATS_HISTORY : 0;
+    int64_t first = interval_at_or_after(from_ms);
+    int64_t end = interval_at_or_after(to_ms);
+
+    first = MAX(first, oldest);
+    for (int64_t k = first; k < end && copied < max; k++) {
+        const struct speed_stats_summary *row = &history[k % SPEED_STATS_HISTORY][lane];
+        int64_t start_ms = epoch_ms + k * SPEED_STATS_INTERVAL_MS;
+
+        if (row->start_ms == start_ms) {
+            out[copied] = *row;
+        } else {
+            /* Skipped over: an interval without traffic */
+            memset(&out[copied], 0, sizeof(out[copied]));
+            out[copied].start_ms = start_ms;
+            out[copied].lane = lane;
+        }
+        copied++;
+    }
+    k_spin_unlock(&stats_lock, key);
+    return copied;
+}
@@ -0,0 +1,53 @@
+#include <zephyr/kernel.h>
+#include "timer_wheel.h"
+
+void timer_wheel_init(struct timer_wheel *wheel)
+{
+    for (uint32_t i = 0; i < TIMER_WHEEL_SLOTS; i++) {
+        sys_dlist_init(&wheel->slots[i]);
+    }
+    wheel->now = 0;
+    wheel->pending = 0;
+}
+
+void timer_wheel_schedule(struct timer_wheel *wheel, struct timer_wheel_entry *entry,
+                          uint32_t ticks)
+{
+    if (sys_dnode_is_linked(&entry->node)) {
+        sys_dlist_remove(&entry->node);
+    } else {
+        wheel->pending++;
+    }
+    entry->expiry = wheel->now + MAX(ticks, 1U);
+    sys_dlist_append(&wheel->slots[entry->expiry & (TIMER_WHEEL_SLOTS - 1U)], &entry->node);
+}
+
+void timer_wheel_cancel(struct timer_wheel *wheel, struct timer_wheel_entry *entry)
+{
+    if (sys_dnode_is_linked(&entry->node)) {
+        sys_dlist_remove(&entry->node);
+        wheel->pending--;
+    }
+}
+
+uint32_t timer_wheel_tick(struct timer_wheel *wheel, timer_wheel_expire_t expire, void *arg)
+{
+    struct timer_wheel_entry *entry;
+    struct timer_wheel_entry *next;
+    uint32_t expired = 0;
+
+    wheel->now++;
+    sys_dlist_t *slot = &wheel->slots[wheel->now & (TIMER_WHEEL_SLOTS - 1U)];
+
+    SYS_DLIST_FOR_EACH_CONTAINER_SAFE(slot, entry, next, node) {
+        /* Entries more than a turn away share the slot; wrap-safe compare */
+        if ((int32_t)(entry->expiry - wheel->now) > 0) {
+            continue;
+        }
+        sys_dlist_remove(&entry->node);
+        wheel->pending--;
+        expired++;
+        expire(entry, arg);
+    }
+    return expired;
+}
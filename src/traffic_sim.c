@@ -4,7 +4,113 @@
 
 LOG_MODULE_REGISTER(traffic_sim, LOG_LEVEL_INF);
 
+#include <string.h>
 #include "common.h"
+#include "threads.h"
+#include "flow_metrics.h"
+#include "doppler.h"
+#include "doppler_synth.h"
+#include "policy.h"
+
+#if defined(CONFIG_RADAR_DOPPLER)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_RADAR_DOPPLER_POINTS),
+             "Doppler frame points must be a power of two");
+#endif
+
+/* > Axle spacings of the simulated vehicles, cm */
+static const uint16_t sim_car_axles[] = { 260 };
+static const uint16_t sim_truck_axles[] = { 480, 135 };
+
+/**
+ * @brief Reads the speed of a simulated vehicle off a synthetic radar frame.
+ * The vehicle approaches at its transit speed, over mixer offset and noise.
+ * @param s_data The measurement; its transit gives the speed.
+ * @return The Doppler speed in ckm/h, 0 when disabled or no target stood out.
+ */
+static uint32_t traffic_sim_doppler(const sensor_data_t *s_data)
+{
+#if defined(CONFIG_RADAR_DOPPLER)
+    static struct doppler radar;
+    static struct doppler_iq frame[CONFIG_RADAR_DOPPLER_POINTS];
+    static uint32_t noise_state = 0x2545F491U;
+    static int ready = -EAGAIN;
+    struct doppler_result result;
+
+    if (ready == -EAGAIN) {
+        ready = doppler_init(&radar, CONFIG_RADAR_DOPPLER_POINTS,
+                             CONFIG_RADAR_DOPPLER_SAMPLE_RATE_HZ,
+                             CONFIG_RADAR_DOPPLER_CARRIER_MHZ, CONFIG_RADAR_DOPPLER_MIN_KMH);
+        if (ready != 0) {
+            LOG_ERR("Doppler frame of %u points unsupported", CONFIG_RADAR_DOPPLER_POINTS);
+        }
+    }
+    if (ready != 0 || s_data->duration_ms == 0U) {
+        return 0;
+    }
+
+    /* The transit speed over the distance enforcement will use */
+    const struct radar_policy *policy = policy_acquire();
+    double kmh = policy->v.distance_mm * 3.6 / s_data->duration_ms;
+
+    policy_release(policy);
+
+    doppler_synth_frame(frame, ARRAY_SIZE(frame),
+                        doppler_synth_hz(kmh, CONFIG_RADAR_DOPPLER_CARRIER_MHZ),
+                        CONFIG_RADAR_DOPPLER_SAMPLE_RATE_HZ, 4000, 300, 400, &noise_state);
+    if (doppler_measure(&radar, frame, CONFIG_RADAR_DOPPLER_MIN_SNR, &result) != 0) {
+        LOG_WRN("Doppler: no target");
+        return 0;
+    }
+    LOG_INF("Doppler: %u.%02u km/h %s, SNR %u", result.speed_ckmh / 100U,
+            result.speed_ckmh % 100U, result.approaching ? "approaching" : "receding",
+            result.snr);
+    return result.approaching ? result.speed_ckmh : 0U;
+#else
+    ARG_UNUSED(s_data);
+    return 0;
+#endif
+}
+
+/**
+ * @brief Completes a simulated measurement and hands it to the main thread.
+ * Vehicles take the lanes in turn, and the flow metrics see the same
+ * edges the sensor thread would report.
+ * @param s_data The measurement; lane, axles and class are filled in.
+ * @param vclass The class the sensor thread would have assigned.
+ * @param spacing_cm The axle spacings of the vehicle.
+ * @param spacings The number of spacings (axles - 1).
+ */
+static void traffic_sim_emit(sensor_data_t *s_data, vehicle_class_t vclass,
+                             const uint16_t *spacing_cm, size_t spacings)
+{
+    static uint32_t vehicle_n;
+    uint32_t length_cm = 0;
+
+    s_data->lane = (uint8_t)(vehicle_n++ % CONFIG_RADAR_LANE_COUNT);
+    s_data->vclass = vclass;
+    s_data->type = vehicle_class_type(vclass);
+    s_data->axle_count = spacings + 1U;
+    s_data->fit_speed_ckmh = 0;
+    s_data->fit_accel_mm_s2 = 0;
+    s_data->fit_confidence = 0;
+    memset(s_data->axle_weight_kg, 0, sizeof(s_data->axle_weight_kg));
+    s_data->gross_weight_kg = 0;
+    s_data->doppler_speed_ckmh = traffic_sim_doppler(s_data);
+    memset(s_data->axle_spacing_cm, 0, sizeof(s_data->axle_spacing_cm));
+    for (size_t i = 0; i < spacings && i < ARRAY_SIZE(s_data->axle_spacing_cm); i++) {
+        s_data->axle_spacing_cm[i] = spacing_cm[i];
+        length_cm += spacing_cm[i];
+    }
+    /* The last axle crosses the start sensor once the vehicle moved its length */
+    s_data->timestamp_last_axle = s_data->timestamp_start +
+                                  (int64_t)length_cm * 10 * s_data->duration_ms /
+                                  CONFIG_RADAR_SENSOR_DISTANCE_MM;
+    if (IS_ENABLED(CONFIG_RADAR_FLOW_METRICS)) {
+        (void)flow_metrics_vehicle(s_data->lane, s_data->timestamp_start,
+                                   s_data->timestamp_last_axle);
+    }
+    k_msgq_put(&sensor_msgq, s_data, K_NO_WAIT);
+}
 
 /**
  * @brief Main entry point for the traffic simulator thread.
@@ -20,6 +126,11 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
 
     k_sleep(K_SECONDS(2));
 
+#if defined(CONFIG_RADAR_SECTION_ROLE_EXIT)
+    /* The entry site's vehicles arrive after crossing the section */
+    k_sleep(K_SECONDS(CONFIG_RADAR_SECTION_SIM_TRAVEL_S));
+#endif
+
     while (1) {
         sensor_data_t s_data;
 
@@ -27,11 +138,9 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
         s_data.timestamp_start = k_uptime_get();
         s_data.duration_ms = 360; 
         s_data.timestamp_end = s_data.timestamp_start + 360;
-        s_data.axle_count = 2;
-        s_data.type = VEHICLE_LIGHT;
         
         LOG_INF("SIMULATION: Generating Light Vehicle (50 km/h)");
-        k_msgq_put(&sensor_msgq, &s_data, K_NO_WAIT);
+        traffic_sim_emit(&s_data, VEHICLE_CLASS_CAR, sim_car_axles, ARRAY_SIZE(sim_car_axles));
         
         k_sleep(K_SECONDS(10));
 
@@ -39,11 +148,9 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
         s_data.timestamp_start = k_uptime_get();
         s_data.duration_ms = 310;
         s_data.timestamp_end = s_data.timestamp_start + 310;
-        s_data.axle_count = 2;
-        s_data.type = VEHICLE_LIGHT;
 
         LOG_INF("SIMULATION: Generating Light Vehicle (58 km/h - Warning)");
-        k_msgq_put(&sensor_msgq, &s_data, K_NO_WAIT);
+        traffic_sim_emit(&s_data, VEHICLE_CLASS_CAR, sim_car_axles, ARRAY_SIZE(sim_car_axles));
 
         k_sleep(K_SECONDS(10));
 
@@ -51,11 +158,10 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
         s_data.timestamp_start = k_uptime_get();
         s_data.duration_ms = 360; 
         s_data.timestamp_end = s_data.timestamp_start + 360;
-        s_data.axle_count = 3;
-        s_data.type = VEHICLE_HEAVY;
 
         LOG_INF("SIMULATION: Generating Heavy Vehicle (50 km/h - Infraction!)");
-        k_msgq_put(&sensor_msgq, &s_data, K_NO_WAIT);
+        traffic_sim_emit(&s_data, VEHICLE_CLASS_TRUCK_3, sim_truck_axles,
+                         ARRAY_SIZE(sim_truck_axles));
 
         k_sleep(K_SECONDS(10));
         
@@ -63,11 +169,9 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
         s_data.timestamp_start = k_uptime_get();
         s_data.duration_ms = 225; 
         s_data.timestamp_end = s_data.timestamp_start + 225;
-        s_data.axle_count = 2;
-        s_data.type = VEHICLE_LIGHT;
 
         LOG_INF("SIMULATION: Generating Light Vehicle (80 km/h - Infraction!)");
-        k_msgq_put(&sensor_msgq, &s_data, K_NO_WAIT);
+        traffic_sim_emit(&s_data, VEHICLE_CLASS_CAR, sim_car_axles, ARRAY_SIZE(sim_car_axles));
         
         k_sleep(K_SECONDS(10));
 
@@ -75,11 +179,10 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
         s_data.timestamp_start = k_uptime_get();
         s_data.duration_ms = 474;
         s_data.timestamp_end = s_data.timestamp_start + 474;
-        s_data.axle_count = 3;
-        s_data.type = VEHICLE_HEAVY;
 
         LOG_INF("SIMULATION: Generating Heavy Vehicle (38 km/h - Warning)");
-        k_msgq_put(&sensor_msgq, &s_data, K_NO_WAIT);
+        traffic_sim_emit(&s_data, VEHICLE_CLASS_TRUCK_3, sim_truck_axles,
+                         ARRAY_SIZE(sim_truck_axles));
 
         k_sleep(K_SECONDS(10));
     }
@@ -88,5 +191,6 @@ void traffic_sim_thread_entry(void *p1, void *p2, void *p3) {
 /**
  * @brief Thread Definition for Traffic Simulator
  */
-K_THREAD_DEFINE(traffic_sim_tid, 1024, traffic_sim_thread_entry, NULL, NULL, NULL, 8, 0, 0);
+K_THREAD_DEFINE(traffic_sim_tid, 1024, traffic_sim_thread_entry, NULL, NULL, NULL, 8, 0,
+                RADAR_STAGE_START_DELAY);
 
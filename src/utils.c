@@ -1,70 +1,128 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 #include "common.h"
+#include "plate_signature.h"
 
 /**
- * @brief Converts a character to uppercase.
- * @param c The character to convert.
- * @return The uppercase character.
+ * @brief Character class of every byte value.
+ * Letters are accepted in either case; separators are skipped.
  */
-static inline char util_to_upper_char(char c) {
-	if (c >= 'a' && c <= 'z') return (char)(c - 'a' + 'A');
-	return c;
-}
+const uint8_t plate_char_class[256] = {
+	['0' ... '9'] = PLATE_CLASS_DIGIT,
+	['A' ... 'Z'] = PLATE_CLASS_LETTER,
+	['a' ... 'z'] = PLATE_CLASS_LETTER,
+	[' '] = PLATE_CLASS_SEPARATOR,
+	['-'] = PLATE_CLASS_SEPARATOR,
+	['_'] = PLATE_CLASS_SEPARATOR,
+};
 
 /**
- * @brief Checks if a character is a letter.
- * @param c The character to check.
- * @return True if the character is a letter, false otherwise.
+ * @brief Mercosul patterns indexed by signature ('L' letter, 'N' digit).
+ * Every pattern is matched at once by a single lookup.
  */
-static inline bool util_is_letter(char c) {
-	char u = util_to_upper_char(c);
-	return (u >= 'A' && u <= 'Z');
+const uint8_t plate_signature_country[PLATE_SIG_COUNT] = {
+	[PLATE_SIG('L', 'L', 'L', 'N', 'L', 'N', 'N')] = PLATE_COUNTRY_BR,
+	[PLATE_SIG('L', 'L', 'N', 'N', 'N', 'L', 'L')] = PLATE_COUNTRY_AR,
+	[PLATE_SIG('L', 'L', 'L', 'N', 'N', 'N', 'N')] = PLATE_COUNTRY_UY,
+	[PLATE_SIG('L', 'L', 'L', 'L', 'N', 'N', 'N')] = PLATE_COUNTRY_PY_CAR,
+	[PLATE_SIG('N', 'N', 'N', 'L', 'L', 'L', 'L')] = PLATE_COUNTRY_PY_MOTO,
+	[PLATE_SIG('L', 'L', 'N', 'N', 'N', 'N', 'N')] = PLATE_COUNTRY_BO,
+};
+
+/**
+ * @brief Classifies a plate in a single pass.
+ * Builds the plate signature, matched against all patterns with one table
+ * lookup, and optionally the radix-36 packing of the significant characters.
+ * @param plate The plate text.
+ * @param packed If not NULL, receives the radix-36 value of the plate.
+ * @return The matched country, PLATE_COUNTRY_NONE if the plate is invalid.
+ */
+static inline plate_country_t plate_scan(const char *plate, uint64_t *packed)
+{
+	uint32_t signature = 0;
+	uint32_t len = 0;
+	uint64_t value = 0;
+
+	for (const uint8_t *p = (const uint8_t *)plate; *p != '\0'; ++p) {
+		uint8_t cls = plate_char_class[*p];
+
+		if (cls == PLATE_CLASS_SEPARATOR) {
+			continue;
+		}
+		if (cls == PLATE_CLASS_INVALID || len >= PLATE_SIGNIFICANT_CHARS) {
+			return PLATE_COUNTRY_NONE;
+		}
+		signature |= (uint32_t)(cls == PLATE_CLASS_LETTER) << len;
+		len++;
+		if (packed != NULL) {
+			uint32_t digit = (cls == PLATE_CLASS_DIGIT) ? (uint32_t)(*p - '0') :
+								      (uint32_t)((*p | 0x20) - 'a' + 10);
+			value = value * 36U + digit;
+		}
+	}
+
+	if (len != PLATE_SIGNIFICANT_CHARS) {
+		return PLATE_COUNTRY_NONE;
+	}
+	if (packed != NULL) {
+		*packed = value;
+	}
+	return (plate_country_t)plate_signature_country[signature];
 }
 
 /**
- * @brief Checks if a character is a digit.
- * @param c The character to check.
- * @return True if the character is a digit, false otherwise.
+ * @brief Validates a Mercosul plate number and identifies its country.
+ * @param plate The plate number to validate.
+ * @return The matched country, PLATE_COUNTRY_NONE if the plate is invalid.
  */
-static inline bool util_is_digit(char c) {
-	return (c >= '0' && c <= '9');
+plate_country_t validate_plate_country(const char *plate)
+{
+	return plate_scan(plate, NULL);
 }
 
 /**
- * @brief Checks whether a plate matches a symbolic pattern.
- * Pattern tokens:
- *  - 'L': alphabetic character (case-insensitive)
- *  - 'N': numeric character
- *  - any other char: must match literally
+ * @brief Validates a plate and encodes it as a plate_id_t in a single pass.
+ * @param plate The plate text.
+ * @return The plate identifier, PLATE_ID_NONE if the plate is invalid.
  */
-static inline bool util_matches_pattern(const char *plate, const char *pattern)
+plate_id_t plate_id_from_str(const char *plate)
 {
-	size_t plate_len = strlen(plate);
-	size_t pattern_len = strlen(pattern);
+	uint64_t value = 0;
+	plate_country_t country = plate_scan(plate, &value);
 
-	if (plate_len != pattern_len) {
-		return false;
+	if (country == PLATE_COUNTRY_NONE) {
+		return PLATE_ID_NONE;
 	}
+	return ((plate_id_t)country << PLATE_ID_COUNTRY_SHIFT) | value;
+}
 
-	for (size_t i = 0; i < pattern_len; ++i) {
-		char token = pattern[i];
-		char c = util_to_upper_char(plate[i]);
-
-		if (token == 'L') {
-			if (!util_is_letter(c)) {
-				return false;
-			}
-		} else if (token == 'N') {
-			if (!util_is_digit(c)) {
-				return false;
-			}
-		} else if (token != c) {
-			return false;
-		}
+/**
+ * @brief Writes the canonical text of a plate.
+ * @param id The plate identifier.
+ * @param buf The output buffer.
+ * @param len The size of the output buffer.
+ * @return 0 on success, -EINVAL for PLATE_ID_NONE, -ENOMEM if buf is too small.
+ */
+int plate_id_to_str(plate_id_t id, char *buf, size_t len)
+{
+	static const char radix36[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+	if (buf == NULL || len < PLATE_TEXT_SIZE) {
+		return -ENOMEM;
+	}
+	if (!plate_id_is_valid(id)) {
+		buf[0] = '\0';
+		return -EINVAL;
 	}
 
-	return true;
+	uint64_t value = id & PLATE_ID_VALUE_MASK;
+
+	for (int i = PLATE_SIGNIFICANT_CHARS - 1; i >= 0; i--) {
+		buf[i] = radix36[value % 36U];
+		value /= 36U;
+	}
+	buf[PLATE_SIGNIFICANT_CHARS] = '\0';
+	return 0;
 }
 
 /**
@@ -73,41 +131,7 @@ static inline bool util_matches_pattern(const char *plate, const char *pattern)
  * @return True if the plate number is valid, false otherwise.
  */
 bool validate_plate(const char *plate) {
-	char sanitized[16];
-	size_t sanitized_len = 0;
-
-	for (size_t i = 0; plate[i] != '\0'; ++i) {
-		char c = plate[i];
-		if (c == ' ' || c == '-' || c == '_') {
-			continue;
-		}
-		if (sanitized_len >= ARRAY_SIZE(sanitized) - 1) {
-			return false;
-		}
-		sanitized[sanitized_len++] = c;
-	}
-	sanitized[sanitized_len] = '\0';
-
-	if (sanitized_len != 7) {
-		return false;
-	}
-
-	static const char *mercosur_patterns[] = {
-		"LLLNLNN", /* Brasil */
-		"LLNNNLL", /* Argentina */
-		"LLLNNNN", /* Uruguay */
-		"LLLLNNN", /* Paraguay cars */
-		"NNNLLLL", /* Paraguay motorcycles */
-		"LLNNNNN", /* Bolivia */
-	};
-
-	for (size_t i = 0; i < ARRAY_SIZE(mercosur_patterns); ++i) {
-		if (util_matches_pattern(sanitized, mercosur_patterns[i])) {
-			return true;
-		}
-	}
-
-	return false;
+	return validate_plate_country(plate) != PLATE_COUNTRY_NONE;
 }
 
 
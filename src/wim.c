@@ -0,0 +1,80 @@
+#include <zephyr/kernel.h>
+#include "wim.h"
+
+void wim_init(struct wim_detector *det, uint16_t on_counts, uint16_t hold)
+{
+    *det = (struct wim_detector){
+        .on_counts = on_counts,
+        .off_counts = on_counts / 2U,
+        .hold = MAX(hold, 1U),
+        .state = WIM_IDLE,
+    };
+}
+
+uint32_t wim_feed(struct wim_detector *det, const uint16_t *samples, size_t n, size_t stride,
+                  wim_axle_cb_t cb, void *arg)
+{
+    uint32_t closed = 0;
+
+    if (!det->primed && n > 0U) {
+        det->baseline_q8 = (uint32_t)samples[0] << 8;
+        det->primed = true;
+    }
+
+    for (size_t i = 0; i < n; i++, det->sample++) {
+        uint32_t x = samples[i * stride];
+        uint32_t base = det->baseline_q8 >> 8;
+        uint32_t d = (x > base) ? x - base : 0U;
+        struct wim_axle *cur = &det->cur;
+
+        if (det->state == WIM_IDLE) {
+            if (d <= det->on_counts) {
+                /* baseline += (x - baseline) / 2^shift */
+                det->baseline_q8 = (uint32_t)((int32_t)det->baseline_q8 +
+                                              (((int32_t)(x << 8) - (int32_t)det->baseline_q8) >>
+                                               WIM_BASELINE_SHIFT));
+                continue;
+            }
+            *cur = (struct wim_axle){ 0 };
+            det->below = 0;
+            det->below_area = 0;
+            det->state = WIM_AXLE;
+        }
+
+        cur->samples++;
+        cur->area += d;
+        cur->peak = MAX(cur->peak, (uint16_t)MIN(d, UINT16_MAX));
+
+        if (d >= det->off_counts) {
+            det->below = 0;
+            det->below_area = 0;
+            continue;
+        }
+        det->below++;
+        det->below_area += d;
+        if (det->below < det->hold) {
+            continue;
+        }
+
+        /* Trim the hold: the axle left on its first low sample */
+        cur->samples -= det->below;
+        cur->area -= det->below_area;
+        cur->end_sample = det->sample - det->below;
+        det->state = WIM_IDLE;
+        closed++;
+        if (cb != NULL) {
+            cb(cur, arg);
+        }
+    }
+    return closed;
+}
+
+uint16_t wim_axle_kg(const struct wim_axle *axle, uint32_t sample_us, uint32_t speed_mm_s,
+                     uint32_t g_per_count_mm)
+{
+    /* Signal over the travel: area x sample time x speed, in count.mm */
+    uint64_t g = ((uint64_t)axle->area * sample_us * speed_mm_s / USEC_PER_SEC) * g_per_count_mm;
+    uint64_t kg = (g + 500U) / 1000U;
+
+    return (uint16_t)MIN(kg, UINT16_MAX);
+}
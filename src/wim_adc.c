@@ -0,0 +1,293 @@
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/logging/log.h>
+#include "common.h"
+#include "block_ring.h"
+#include "wim.h"
+#include "wim_adc.h"
+
+LOG_MODULE_REGISTER(wim_adc, LOG_LEVEL_INF);
+
+/* One strip per lane, in lane order, all on the same ADC */
+#define WIM_NODE DT_INST(0, radar_wim_strip)
+#define WIM_CHANNELS DT_PROP_LEN(WIM_NODE, io_channels)
+#define WIM_LANES MIN(WIM_CHANNELS, CONFIG_RADAR_LANE_COUNT)
+
+BUILD_ASSERT(DT_PROP_LEN(WIM_NODE, g_per_count_mm) == WIM_CHANNELS,
+             "g-per-count-mm lists one calibration per strip");
+BUILD_ASSERT((CONFIG_RADAR_WIM_BLOCKS & (CONFIG_RADAR_WIM_BLOCKS - 1)) == 0,
+             "CONFIG_RADAR_WIM_BLOCKS must be a power of two");
+
+#define WIM_SPEC(node_id, prop, idx) ADC_DT_SPEC_GET_BY_IDX(node_id, idx)
+
+static const struct adc_dt_spec wim_specs[] = {
+    DT_FOREACH_PROP_ELEM_SEP(WIM_NODE, io_channels, WIM_SPEC, (,))
+};
+static const uint32_t wim_g_per_count_mm[] = DT_PROP(WIM_NODE, g_per_count_mm);
+
+/* > Axle kept for the sensor thread */
+struct wim_kept {
+    struct wim_axle axle;
+    int64_t end_ms;
+};
+
+/* > Strip of one lane */
+struct wim_lane {
+    struct wim_detector det;
+    size_t offset;             /* Rank of its channel within a sampling */
+    int64_t block_end_ms;      /* Block being fed: when it ended, */
+    uint64_t block_end_sample; /* and the sample count it ends at */
+    /* Last axles, oldest overwritten */
+    struct wim_kept kept[CONFIG_RADAR_MAX_AXLES];
+    uint32_t kept_next;
+    uint32_t kept_count;
+};
+
+static uint16_t wim_buf[CONFIG_RADAR_WIM_BLOCKS][CONFIG_RADAR_WIM_BLOCK * WIM_CHANNELS];
+static int64_t wim_block_end_ms[CONFIG_RADAR_WIM_BLOCKS];
+static struct block_ring wim_ring;
+static struct wim_lane wim_lanes[WIM_LANES];
+static struct k_spinlock wim_lock; /* Covers kept */
+static atomic_t wim_blocks;
+static atomic_t wim_overruns;
+static atomic_t wim_axles;
+
+/* Filled blocks for the processor, released blocks for the sampler */
+K_SEM_DEFINE(wim_filled, 0, CONFIG_RADAR_WIM_BLOCKS);
+K_SEM_DEFINE(wim_released, 0, 1);
+
+#if defined(CONFIG_ADC_EMUL)
+#include <zephyr/drivers/adc/adc_emul.h>
+#include "wim_synth.h"
+
+/* The emulated strips idle here and see one vehicle per period, at 60 km/h */
+#define WIM_EMUL_BASELINE 200
+#define WIM_EMUL_PERIOD_S 3
+#define WIM_EMUL_SPEED_MM_S 16667
+
+static const struct wim_synth_vehicle *const wim_emul_traffic[] = {
+    &wim_synth_car, &wim_synth_truck_3, &wim_synth_truck_5_overload,
+};
+
+/* > Emulated strip: where it is in its traffic */
+struct wim_emul {
+    const struct adc_dt_spec *spec;
+    uint32_t sample;
+};
+
+static struct wim_emul wim_emul[WIM_CHANNELS];
+
+/**
+ * @brief ADC emulator callback: the strip level at the next sample.
+ * @param dev The ADC.
+ * @param chan The channel.
+ * @param data The emulated strip.
+ * @param result Receives the level, in mV.
+ * @return 0.
+ */
+static int wim_emul_value(const struct device *dev, unsigned int chan, void *data,
+                          uint32_t *result)
+{
+    ARG_UNUSED(chan);
+    struct wim_emul *e = data;
+    const uint32_t period = WIM_EMUL_PERIOD_S * USEC_PER_SEC / CONFIG_RADAR_WIM_INTERVAL_US;
+    uint32_t n = e->sample++;
+    size_t lane = e - wim_emul;
+    const struct wim_synth_vehicle *v =
+        wim_emul_traffic[(n / period + lane) % ARRAY_SIZE(wim_emul_traffic)];
+    int64_t front_mm = (int64_t)(n % period) * CONFIG_RADAR_WIM_INTERVAL_US *
+                       WIM_EMUL_SPEED_MM_S / USEC_PER_SEC;
+    uint32_t counts = MIN(WIM_EMUL_BASELINE + wim_synth_response(v, (int32_t)front_mm),
+                          BIT_MASK(e->spec->resolution));
+
+    *result = (counts * adc_ref_internal(dev)) >> e->spec->resolution;
+    return 0;
+}
+#endif
+
+/**
+ * @brief Detector callback: keeps a closed axle for the sensor thread.
+ * @param axle The axle.
+ * @param arg The lane.
+ */
+static void wim_axle_closed(const struct wim_axle *axle, void *arg)
+{
+    struct wim_lane *lane = arg;
+    int64_t end_ms = lane->block_end_ms -
+                     (int64_t)((lane->block_end_sample - axle->end_sample) *
+                               CONFIG_RADAR_WIM_INTERVAL_US / USEC_PER_MSEC);
+
+    k_spinlock_key_t key = k_spin_lock(&wim_lock);
+    lane->kept[lane->kept_next] = (struct wim_kept){ .axle = *axle, .end_ms = end_ms };
+    lane->kept_next = (lane->kept_next + 1U) % ARRAY_SIZE(lane->kept);
+    lane->kept_count = MIN(lane->kept_count + 1U, ARRAY_SIZE(lane->kept));
+    k_spin_unlock(&wim_lock, key);
+    (void)atomic_inc(&wim_axles);
+}
+
+/**
+ * @brief Configures the strip channels and the sequence of one block.
+ * @param seq Receives the sequence.
+ * @return 0 on success, negative error code otherwise.
+ */
+static int wim_setup(struct adc_sequence *seq)
+{
+    static struct adc_sequence_options options = {
+        .interval_us = CONFIG_RADAR_WIM_INTERVAL_US,
+        .extra_samplings = CONFIG_RADAR_WIM_BLOCK - 1,
+    };
+    uint32_t channels = 0;
+
+    for (size_t i = 0; i < WIM_CHANNELS; i++) {
+        const struct adc_dt_spec *spec = &wim_specs[i];
+
+        if (!adc_is_ready_dt(spec) || spec->dev != wim_specs[0].dev) {
+            LOG_ERR("Strip %u: ADC not ready or not shared with strip 0", (unsigned int)i);
+            return -ENODEV;
+        }
+        int ret = adc_channel_setup_dt(spec);
+        if (ret != 0) {
+            LOG_ERR("Strip %u: channel setup failed (%d)", (unsigned int)i, ret);
+            return ret;
+        }
+        channels |= BIT(spec->channel_id);
+#if defined(CONFIG_ADC_EMUL)
+        wim_emul[i].spec = spec;
+        (void)adc_emul_value_func_set(spec->dev, spec->channel_id, wim_emul_value, &wim_emul[i]);
+#endif
+    }
+
+    /* A sampling stores the channels in ascending order */
+    for (size_t i = 0; i < WIM_LANES; i++) {
+        struct wim_lane *lane = &wim_lanes[i];
+
+        lane->offset = POPCOUNT(channels & BIT_MASK(wim_specs[i].channel_id));
+        wim_init(&lane->det, CONFIG_RADAR_WIM_ON_COUNTS, CONFIG_RADAR_WIM_HOLD_SAMPLES);
+    }
+    block_ring_init(&wim_ring, &wim_buf[0][0], ARRAY_SIZE(wim_buf[0]), CONFIG_RADAR_WIM_BLOCKS);
+
+    int ret = adc_sequence_init_dt(&wim_specs[0], seq);
+    seq->channels = channels;
+    seq->options = &options;
+    seq->buffer_size = sizeof(wim_buf[0]);
+    return ret;
+}
+
+/**
+ * @brief Sampler thread: has the ADC fill the ring block by block.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void wim_sampler_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    struct adc_sequence seq = { 0 };
+    uint32_t produced = 0;
+
+    if (wim_setup(&seq) != 0) {
+        return;
+    }
+    LOG_INF("Weighing on %u strip(s) every %u us", (unsigned int)WIM_LANES,
+            CONFIG_RADAR_WIM_INTERVAL_US);
+
+    while (1) {
+        uint16_t *block = block_ring_claim(&wim_ring);
+
+        if (block == NULL) {
+            /* The processor is behind by the whole ring */
+            (void)atomic_inc(&wim_overruns);
+            do {
+                (void)k_sem_take(&wim_released, K_FOREVER);
+                block = block_ring_claim(&wim_ring);
+            } while (block == NULL);
+        }
+        seq.buffer = block;
+        int ret = adc_read(wim_specs[0].dev, &seq);
+        if (ret != 0) {
+            LOG_ERR("Strip sampling failed (%d)", ret);
+            k_msleep(1000);
+            continue;
+        }
+        wim_block_end_ms[produced % CONFIG_RADAR_WIM_BLOCKS] = k_uptime_get();
+        produced++;
+        block_ring_commit(&wim_ring);
+        k_sem_give(&wim_filled);
+    }
+}
+
+/**
+ * @brief Processor thread: runs the detectors over each filled block, in place.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void wim_processor_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    uint32_t consumed = 0;
+
+    while (1) {
+        (void)k_sem_take(&wim_filled, K_FOREVER);
+        const uint16_t *block = block_ring_peek(&wim_ring);
+        int64_t end_ms = wim_block_end_ms[consumed % CONFIG_RADAR_WIM_BLOCKS];
+
+        for (size_t i = 0; i < WIM_LANES; i++) {
+            struct wim_lane *lane = &wim_lanes[i];
+
+            lane->block_end_ms = end_ms;
+            lane->block_end_sample = lane->det.sample + CONFIG_RADAR_WIM_BLOCK;
+            (void)wim_feed(&lane->det, &block[lane->offset], CONFIG_RADAR_WIM_BLOCK,
+                           WIM_CHANNELS, wim_axle_closed, lane);
+        }
+        consumed++;
+        block_ring_release(&wim_ring);
+        k_sem_give(&wim_released);
+        (void)atomic_inc(&wim_blocks);
+    }
+}
+
+K_THREAD_DEFINE(wim_sampler_tid, 1024, wim_sampler_entry, NULL, NULL, NULL, 4, 0, 0);
+K_THREAD_DEFINE(wim_processor_tid, 1024, wim_processor_entry, NULL, NULL, NULL, 5, 0, 0);
+
+uint32_t wim_adc_weigh(uint8_t lane, int64_t since_ms, uint32_t speed_mm_s, uint16_t *axle_kg,
+                       uint32_t max)
+{
+    struct wim_kept kept[CONFIG_RADAR_MAX_AXLES];
+    uint32_t n = 0;
+
+    if (lane >= WIM_LANES) {
+        return 0;
+    }
+    struct wim_lane *l = &wim_lanes[lane];
+    k_spinlock_key_t key = k_spin_lock(&wim_lock);
+    /* Oldest first: the kept axles end just before kept_next */
+    for (uint32_t i = 0; i < l->kept_count; i++) {
+        const struct wim_kept *k = &l->kept[(l->kept_next + ARRAY_SIZE(l->kept) -
+                                             l->kept_count + i) % ARRAY_SIZE(l->kept)];
+
+        if (k->end_ms >= since_ms && n < MIN(max, ARRAY_SIZE(kept))) {
+            kept[n++] = *k;
+        }
+    }
+    l->kept_count = 0;
+    k_spin_unlock(&wim_lock, key);
+
+    for (uint32_t i = 0; i < n; i++) {
+        axle_kg[i] = wim_axle_kg(&kept[i].axle, CONFIG_RADAR_WIM_INTERVAL_US, speed_mm_s,
+                                 wim_g_per_count_mm[lane]);
+    }
+    return n;
+}
+
+void wim_adc_stats_get(struct wim_adc_stats *out)
+{
+    out->blocks = (uint32_t)atomic_get(&wim_blocks);
+    out->overruns = (uint32_t)atomic_get(&wim_overruns);
+    out->axles = (uint32_t)atomic_get(&wim_axles);
+}
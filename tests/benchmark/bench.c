@@ -0,0 +1,117 @@
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_baselines.h"
+
+#if defined(CONFIG_NATIVE_LIBRARY)
+/* Provided by bench_native_clock.c, linked into the native_sim runner */
+uint64_t bench_native_host_ns(void);
+#elif !defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+/* k_cycle_get_64() would read 0 and every benchmark would time nothing */
+#error "The benchmark clock needs a 64-bit cycle counter; see boards/mps2_an385.conf"
+#endif
+
+volatile uint32_t bench_sink;
+
+/**
+ * @brief Reads the benchmark clock.
+ * @return The current time in nanoseconds.
+ */
+uint64_t bench_now_ns(void)
+{
+#if defined(CONFIG_NATIVE_LIBRARY)
+    return bench_native_host_ns();
+#else
+    return k_cyc_to_ns_floor64(k_cycle_get_64());
+#endif
+}
+
+/**
+ * @brief Finds the stored baseline for a benchmark on the current board.
+ * @param name The benchmark name.
+ * @return The baseline in picoseconds per operation, 0 if none is stored.
+ */
+static uint64_t bench_baseline_ps(const char *name)
+{
+    for (size_t i = 0; bench_baselines[i].name != NULL; i++) {
+        if (strcmp(bench_baselines[i].board, CONFIG_BOARD_TARGET) == 0 &&
+            strcmp(bench_baselines[i].name, name) == 0) {
+            return bench_baselines[i].ps_per_op;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reports a measurement and checks it against the stored baseline.
+ * @param name The benchmark name.
+ * @param iterations The number of operations measured.
+ * @param elapsed_ns The total time spent on those operations.
+ * @return 0 on success, -ERANGE on an enforced regression, -ENOENT on a
+ *         required but missing baseline, -EIO if no time elapsed.
+ */
+int bench_report(const char *name, uint32_t iterations, uint64_t elapsed_ns)
+{
+    if (iterations == 0U) {
+        iterations = 1U;
+    }
+
+    uint64_t ps_per_op = (elapsed_ns * 1000ULL) / iterations;
+    uint64_t ops_per_sec = (elapsed_ns > 0U) ?
+                           ((uint64_t)iterations * 1000000000ULL) / elapsed_ns : 0U;
+    uint64_t baseline_ps = bench_baseline_ps(name);
+    const char *status = "new";
+    int ret = 0;
+
+    if (elapsed_ns == 0U) {
+        /* A clock that did not advance measured nothing */
+        status = "no_clock";
+        ret = -EIO;
+    } else if (baseline_ps == 0U) {
+        if (IS_ENABLED(CONFIG_RADAR_BENCH_REQUIRE_BASELINES)) {
+            status = "missing";
+            ret = -ENOENT;
+        }
+    } else {
+        uint64_t limit_ps = baseline_ps *
+                            (100U + CONFIG_RADAR_BENCH_REGRESSION_THRESHOLD_PERCENT) / 100U;
+        if (ps_per_op > limit_ps) {
+            status = "regression";
+            if (IS_ENABLED(CONFIG_RADAR_BENCH_ENFORCE_BASELINES)) {
+                ret = -ERANGE;
+            }
+        } else {
+            status = "pass";
+        }
+    }
+
+    printk("BENCH_JSON: {\"board\":\"%s\",\"name\":\"%s\",\"iterations\":%u,"
+           "\"elapsed_ns\":%llu,\"ps_per_op\":%llu,\"ops_per_sec\":%llu,"
+           "\"baseline_ps_per_op\":%llu,\"threshold_pct\":%d,\"status\":\"%s\"}\n",
+           CONFIG_BOARD_TARGET, name, iterations,
+           (unsigned long long)elapsed_ns, (unsigned long long)ps_per_op,
+           (unsigned long long)ops_per_sec, (unsigned long long)baseline_ps,
+           CONFIG_RADAR_BENCH_REGRESSION_THRESHOLD_PERCENT, status);
+
+    return ret;
+}
+
+/**
+ * @brief Warms up, times and reports a benchmark body.
+ * @param name The benchmark name.
+ * @param fn The benchmark body.
+ * @param ctx Opaque context passed to the body.
+ * @param iterations The number of operations to time.
+ * @return The result of bench_report().
+ */
+int bench_run(const char *name, bench_fn_t fn, void *ctx, uint32_t iterations)
+{
+    /* Warm caches and branch predictors before timing */
+    fn(ctx, (iterations / 10U) + 1U);
+
+    uint64_t start = bench_now_ns();
+    fn(ctx, iterations);
+    uint64_t elapsed = bench_now_ns() - start;
+
+    return bench_report(name, iterations, elapsed);
+}
@@ -0,0 +1,50 @@
+#ifndef BENCH_H
+#define BENCH_H
+#include <zephyr/kernel.h>
+
+/**
+ * @brief Benchmark body: performs the operation under test @p iterations times.
+ * @param ctx Opaque context given to bench_run().
+ * @param iterations Number of operations to perform.
+ */
+typedef void (*bench_fn_t)(void *ctx, uint32_t iterations);
+
+/**
+ * @brief Sink written by benchmark bodies so the compiler keeps their results.
+ */
+extern volatile uint32_t bench_sink;
+
+/**
+ * @brief Reads the benchmark clock.
+ * Uses k_cycle_get_64() on hardware/QEMU targets, which must have a 64-bit
+ * cycle counter, and the host monotonic clock on native_sim, where
+ * simulated time stands still while code runs.
+ * @return The current time in nanoseconds.
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * @brief Reports a measurement as a BENCH_JSON line and checks it against
+ * the stored baseline for the current board.
+ * @param name The benchmark name (baseline key).
+ * @param iterations The number of operations measured.
+ * @param elapsed_ns The total time spent on those operations.
+ * @return 0 on success, -ERANGE if the result regressed past the threshold
+ *         and CONFIG_RADAR_BENCH_ENFORCE_BASELINES is enabled, -ENOENT if
+ *         the board has no baseline for it and
+ *         CONFIG_RADAR_BENCH_REQUIRE_BASELINES is enabled, -EIO if the clock
+ *         did not advance.
+ */
+int bench_report(const char *name, uint32_t iterations, uint64_t elapsed_ns);
+
+/**
+ * @brief Warms up, times and reports a benchmark body.
+ * @param name The benchmark name (baseline key).
+ * @param fn The benchmark body.
+ * @param ctx Opaque context passed to @p fn.
+ * @param iterations The number of operations to time.
+ * @return The result of bench_report().
+ */
+int bench_run(const char *name, bench_fn_t fn, void *ctx, uint32_t iterations);
+
+#endif
@@ -0,0 +1,15 @@
+/*
+ * Runner-side helper for native_sim: compiled against the host libc so the
+ * benchmark harness can read wall-clock time, which the simulated kernel
+ * clock does not advance while code is executing.
+ */
+#include <stdint.h>
+#include <time.h>
+
+uint64_t bench_native_host_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,496 @@
+#include <zephyr/ztest.h>
+#include <zephyr/zbus/zbus.h>
+#include <string.h>
+#include "common.h"
+#include "sensor_fsm.h"
+#include "infraction_log.h"
+#include "plate_batch.h"
+#include "sha256.h"
+#include "enforcement.h"
+#include "policy.h"
+#include "bench.h"
+
+/* > Mixed valid/invalid reads, shaped like the camera service table */
+static const char *const bench_plates[] = {
+    "EGG3D02", "AB 123 CD", "ABCD 123", "123 ABCD", "SAB1234", "AB12345",
+    "UZ@48G FT", "C0 0S7 PY", "888Z", "abc1d23", "A1B2C3D", "XYZ9W88",
+    "VF DSK47 OG", "777 HH2", "JOT5F76", "12AB34C",
+};
+
+/**
+ * @brief Benchmark body for calculate_speed over a sweep of durations.
+ */
+static void bench_calculate_speed(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        acc += calculate_speed(CONFIG_RADAR_SENSOR_DISTANCE_MM, 100U + (i & 1023U));
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Benchmark body for the per-vehicle decision computed with
+ * divisions: calculate_speed, then enforcement_decide.
+ * @param ctx The pinned policy.
+ */
+static void bench_decide_arith(void *ctx, uint32_t iterations)
+{
+    const struct radar_policy *policy = ctx;
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t speed = calculate_speed(policy->v.distance_mm, 100U + (i & 1023U));
+        uint32_t limit;
+
+        acc += enforcement_decide(policy, speed,
+                                  (vehicle_class_t)(i % VEHICLE_CLASS_COUNT), &limit) + speed;
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Benchmark body for the same decision through the policy's
+ * decision table (direct lookups and tail searches, no division).
+ * @param ctx The pinned policy.
+ */
+static void bench_decide_table(void *ctx, uint32_t iterations)
+{
+    const struct radar_policy *policy = ctx;
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t speed, limit;
+
+        acc += policy_decide(policy, 100U + (i & 1023U),
+                             (vehicle_class_t)(i % VEHICLE_CLASS_COUNT), &speed, &limit) + speed;
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Benchmark body for validate_plate over the mixed plate set.
+ */
+static void bench_validate_plate(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        acc += validate_plate(bench_plates[i % ARRAY_SIZE(bench_plates)]) ? 1U : 0U;
+    }
+    bench_sink = acc;
+}
+
+/* > Batch input: the mixed plate set replicated into fixed-size slots */
+#define BENCH_BATCH_SIZE 256U
+static char bench_batch_plates[BENCH_BATCH_SIZE][PLATE_STR_SIZE];
+static uint8_t bench_batch_country[BENCH_BATCH_SIZE];
+
+/**
+ * @brief Benchmark body for validate_plates_batch (one operation = one plate).
+ */
+static void bench_validate_plates_batch(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    uint32_t acc = 0;
+
+    for (uint32_t done = 0; done < iterations; done += BENCH_BATCH_SIZE) {
+        size_t n = MIN(BENCH_BATCH_SIZE, iterations - done);
+
+        acc += validate_plates_batch(bench_batch_plates, n, bench_batch_country);
+    }
+    bench_sink = acc;
+}
+
+/* > Captures with their digests, verified like main() does */
+static uint8_t bench_plate_hashes[ARRAY_SIZE(bench_plates)][SHA256_DIGEST_SIZE];
+
+/**
+ * @brief Benchmark body for the per-capture plate hash verification.
+ */
+static void bench_sha256_verify(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        size_t k = i % ARRAY_SIZE(bench_plates);
+
+        acc += sha256_verify(bench_plates[k], strlen(bench_plates[k]), bench_plate_hashes[k]) ?
+               1U : 0U;
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Benchmark body for SHA-256 throughput (one operation = one 1 KiB buffer).
+ */
+static void bench_sha256_1k(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    static uint8_t buf[1024];
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        buf[0] = (uint8_t)i;
+        sha256(buf, sizeof(buf), digest);
+    }
+    bench_sink = digest[0];
+}
+
+/**
+ * @brief Benchmark body for a full vehicle through the sensor FSM
+ * (start, start, end, finalize).
+ */
+static void bench_sensor_fsm(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    struct sensor_fsm fsm;
+    sensor_data_t out;
+    uint32_t acc = 0;
+
+    sensor_fsm_init(&fsm);
+    for (uint32_t i = 0; i < iterations; i++) {
+        int64_t t = (int64_t)i * 1000;
+
+        sensor_fsm_handle_start(&fsm, t);
+        sensor_fsm_handle_start(&fsm, t + 100);
+        (void)sensor_fsm_handle_end(&fsm, t + 300 + (i & 127U));
+        acc += sensor_fsm_get_axle_window_ms(&fsm);
+        if (sensor_fsm_finalize(&fsm, &out)) {
+            acc += out.duration_ms;
+        }
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Benchmark body for infraction_log_add.
+ */
+static void bench_log_add(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    infraction_record_t rec = {
+        .type = VEHICLE_LIGHT,
+        .limit_kmh = CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH,
+        .valid_read = true,
+    };
+
+    rec.plate = plate_id_from_str("ABC1D23");
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        rec.timestamp_ms = i;
+        rec.speed_kmh = 61U + (i & 63U);
+        rec.type = (i & 1U) ? VEHICLE_HEAVY : VEHICLE_LIGHT;
+        infraction_log_add(&rec);
+    }
+}
+
+/**
+ * @brief Benchmark body for infraction_log_get_recent (8 records per call).
+ */
+static void bench_log_get_recent(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    infraction_record_t out[8];
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        acc += infraction_log_get_recent(ARRAY_SIZE(out), out);
+        acc += out[0].speed_kmh;
+    }
+    bench_sink = acc;
+}
+
+ZTEST(radar_bench, test_calculate_speed)
+{
+    zassert_ok(bench_run("calculate_speed", bench_calculate_speed, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "calculate_speed regressed");
+}
+
+ZTEST(radar_bench, test_decide)
+{
+    const struct radar_policy *policy = policy_acquire();
+
+    zassert_ok(bench_run("decide_arith", bench_decide_arith, (void *)policy,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "decide_arith regressed");
+    zassert_ok(bench_run("decide_table", bench_decide_table, (void *)policy,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "decide_table regressed");
+    policy_release(policy);
+}
+
+ZTEST(radar_bench, test_validate_plate)
+{
+    zassert_ok(bench_run("validate_plate", bench_validate_plate, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "validate_plate regressed");
+}
+
+ZTEST(radar_bench, test_validate_plates_batch)
+{
+    for (size_t i = 0; i < BENCH_BATCH_SIZE; i++) {
+        strncpy(bench_batch_plates[i], bench_plates[i % ARRAY_SIZE(bench_plates)],
+                PLATE_STR_SIZE - 1);
+    }
+
+    TC_PRINT("validate_plates_batch kernel: %s\n", validate_plates_batch_kernel());
+    zassert_ok(bench_run("validate_plates_batch", bench_validate_plates_batch, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "validate_plates_batch regressed");
+}
+
+ZTEST(radar_bench, test_sha256)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(bench_plates); i++) {
+        sha256(bench_plates[i], strlen(bench_plates[i]), bench_plate_hashes[i]);
+    }
+
+    TC_PRINT("sha256 kernel: %s\n", sha256_kernel());
+    zassert_ok(bench_run("sha256_plate_verify", bench_sha256_verify, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "sha256 verify regressed");
+    zassert_ok(bench_run("sha256_1k", bench_sha256_1k, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS / 100U), "sha256 throughput regressed");
+}
+
+ZTEST(radar_bench, test_sensor_fsm_vehicle)
+{
+    zassert_ok(bench_run("sensor_fsm_vehicle", bench_sensor_fsm, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "sensor_fsm regressed");
+}
+
+/* > Replayed vehicle: axle positions behind the first axle, mm */
+struct bench_replay_vehicle {
+    const char *name;
+    uint32_t axle_mm[5];
+    uint32_t axles;
+};
+
+static const struct bench_replay_vehicle bench_replay_vehicles[] = {
+    { "car", { 0, 2600 }, 2 },
+    { "car_trailer", { 0, 2600, 7100 }, 3 },
+    { "bus", { 0, 6500 }, 2 },
+    { "truck3", { 0, 4800, 6150 }, 3 },
+    { "semi5", { 0, 3600, 4900, 11900, 13200 }, 5 },
+};
+
+/**
+ * @brief Replays one vehicle through the FSM, arming the axle timer the way
+ * the sensor ISRs do.
+ * @param v The vehicle.
+ * @param speed_kmh Its speed.
+ * @param predictive Use sensor_fsm_close_delay_ms() rather than the plain
+ *        axle window.
+ * @param split Set if the timer would have fired before an axle or the end
+ *        sensor, splitting the vehicle.
+ * @return The finalize latency: timer expiry minus the last sensor edge, ms.
+ */
+static int64_t bench_replay_close(const struct bench_replay_vehicle *v, uint32_t speed_kmh,
+                                  bool predictive, bool *split)
+{
+    struct sensor_fsm fsm;
+    int64_t end_ms = (36LL * CONFIG_RADAR_SENSOR_DISTANCE_MM) / (10LL * speed_kmh);
+    int64_t expiry = INT64_MAX;
+    int64_t last_edge = 0;
+    uint32_t next_axle = 0;
+    bool ended = false;
+
+    sensor_fsm_init(&fsm);
+    while (next_axle < v->axles || !ended) {
+        int64_t axle_ms = (next_axle < v->axles) ?
+                          (36LL * v->axle_mm[next_axle]) / (10LL * speed_kmh) : INT64_MAX;
+        int64_t now = MIN(axle_ms, ended ? INT64_MAX : end_ms);
+        uint32_t delay;
+
+        *split |= (expiry < now);
+        if (now == axle_ms) {
+            sensor_fsm_handle_start(&fsm, now);
+            next_axle++;
+        } else {
+            ended = true;
+            if (!sensor_fsm_handle_end(&fsm, now)) {
+                continue;
+            }
+        }
+        delay = predictive ? sensor_fsm_close_delay_ms(&fsm, now) :
+                             sensor_fsm_get_axle_window_ms(&fsm);
+        expiry = now + delay;
+        last_edge = now;
+    }
+    return expiry - last_edge;
+}
+
+ZTEST(radar_bench, test_axle_close_latency)
+{
+    int64_t fixed_total = 0;
+    int64_t predictive_total = 0;
+    uint32_t n = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(bench_replay_vehicles); i++) {
+        for (uint32_t speed = 20U; speed <= 140U; speed += 10U) {
+            bool split = false;
+            int64_t fixed = bench_replay_close(&bench_replay_vehicles[i], speed, false, &split);
+            int64_t predictive = bench_replay_close(&bench_replay_vehicles[i], speed, true,
+                                                    &split);
+
+            zassert_false(split, "%s at %u km/h split", bench_replay_vehicles[i].name, speed);
+            zassert_true(predictive <= fixed, "%s at %u km/h closed later",
+                         bench_replay_vehicles[i].name, speed);
+            fixed_total += fixed;
+            predictive_total += predictive;
+            n++;
+        }
+    }
+    TC_PRINT("axle window close latency: %lld ms fixed, %lld ms predictive (mean of %u)\n",
+             (long long)(fixed_total / n), (long long)(predictive_total / n), n);
+}
+
+/* Chained and plain builds run as separate scenarios; keep their baselines apart */
+#define BENCH_LOG_NAME(n) (IS_ENABLED(CONFIG_RADAR_INFRACTION_LOG_CHAIN) ? n "_chain" : n)
+
+ZTEST(radar_bench, test_infraction_log)
+{
+    /* With chaining and a starved worker, this is the back-pressure path */
+    zassert_ok(bench_run(BENCH_LOG_NAME("infraction_log_add"), bench_log_add, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "infraction_log_add regressed");
+    zassert_ok(bench_run(BENCH_LOG_NAME("infraction_log_get_recent8"), bench_log_get_recent, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "infraction_log_get_recent regressed");
+}
+
+#if defined(CONFIG_RADAR_INFRACTION_LOG_CHAIN)
+/* Bursts small enough for the chain to catch up between them */
+#define BENCH_CHAIN_BURST (CONFIG_RADAR_INFRACTION_LOG_SIZE / 2U + 1U)
+
+/**
+ * @brief Benchmark body for appends with the chain kept up to date
+ * (one operation = one record added and chained).
+ */
+static void bench_log_add_chained(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+
+    for (uint32_t done = 0; done < iterations; done += BENCH_CHAIN_BURST) {
+        bench_log_add(NULL, MIN(BENCH_CHAIN_BURST, iterations - done));
+        infraction_log_chain_sync();
+    }
+}
+
+ZTEST(radar_bench, test_infraction_log_chain)
+{
+    uint64_t caller_ns = 0;
+
+    /* Caller path only: the chaining between bursts is not timed */
+    infraction_log_chain_sync();
+    for (uint32_t done = 0; done < CONFIG_RADAR_BENCH_ITERATIONS; done += BENCH_CHAIN_BURST) {
+        uint32_t n = MIN(BENCH_CHAIN_BURST, CONFIG_RADAR_BENCH_ITERATIONS - done);
+        uint64_t start = bench_now_ns();
+
+        bench_log_add(NULL, n);
+        caller_ns += bench_now_ns() - start;
+        infraction_log_chain_sync();
+    }
+    zassert_ok(bench_report("infraction_log_add_chain_caller", CONFIG_RADAR_BENCH_ITERATIONS,
+                            caller_ns), "chained add caller path regressed");
+
+    /* Append plus chaining: sustained throughput of the chained log */
+    zassert_ok(bench_run("infraction_log_add_chain_total", bench_log_add_chained, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS / 10U), "chained append regressed");
+}
+#endif
+
+/* > msgq round-trip: the test thread sends a request, the echo thread replies */
+K_MSGQ_DEFINE(bench_req_msgq, sizeof(sensor_data_t), 1, 4);
+K_MSGQ_DEFINE(bench_rsp_msgq, sizeof(sensor_data_t), 1, 4);
+
+/**
+ * @brief Echo thread for the msgq round-trip benchmark.
+ */
+static void bench_msgq_echo_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    sensor_data_t data;
+
+    while (1) {
+        if (k_msgq_get(&bench_req_msgq, &data, K_FOREVER) == 0) {
+            (void)k_msgq_put(&bench_rsp_msgq, &data, K_FOREVER);
+        }
+    }
+}
+
+K_THREAD_DEFINE(bench_msgq_echo_tid, 1024, bench_msgq_echo_entry, NULL, NULL, NULL, 5, 0, 0);
+
+ZTEST(radar_bench, test_msgq_round_trip)
+{
+    sensor_data_t req = { .duration_ms = 360, .axle_count = 2, .type = VEHICLE_LIGHT,
+                          .vclass = VEHICLE_CLASS_CAR };
+    sensor_data_t rsp;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < CONFIG_RADAR_BENCH_IPC_ITERATIONS; i++) {
+        req.timestamp_start = i;
+        zassert_ok(k_msgq_put(&bench_req_msgq, &req, K_FOREVER), "put failed");
+        zassert_ok(k_msgq_get(&bench_rsp_msgq, &rsp, K_FOREVER), "get failed");
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    zassert_equal(rsp.timestamp_start, req.timestamp_start, "Echo mismatch");
+    zassert_ok(bench_report("msgq_round_trip", CONFIG_RADAR_BENCH_IPC_ITERATIONS, elapsed),
+               "msgq round-trip regressed");
+}
+
+/* > zbus round-trip: request channel observed by the echo thread, response by the test */
+ZBUS_SUBSCRIBER_DEFINE(bench_echo_sub, 1);
+ZBUS_SUBSCRIBER_DEFINE(bench_client_sub, 1);
+
+ZBUS_CHAN_DEFINE(bench_req_chan, camera_trigger_t, NULL, NULL, ZBUS_OBSERVERS(bench_echo_sub),
+                 ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(bench_rsp_chan, camera_trigger_t, NULL, NULL, ZBUS_OBSERVERS(bench_client_sub),
+                 ZBUS_MSG_INIT(0));
+
+/**
+ * @brief Echo thread for the zbus round-trip benchmark.
+ */
+static void bench_zbus_echo_entry(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    const struct zbus_channel *chan;
+    camera_trigger_t msg;
+
+    while (1) {
+        if (zbus_sub_wait(&bench_echo_sub, &chan, K_FOREVER) == 0 &&
+            zbus_chan_read(&bench_req_chan, &msg, K_FOREVER) == 0) {
+            (void)zbus_chan_pub(&bench_rsp_chan, &msg, K_FOREVER);
+        }
+    }
+}
+
+K_THREAD_DEFINE(bench_zbus_echo_tid, 1024, bench_zbus_echo_entry, NULL, NULL, NULL, 5, 0, 0);
+
+ZTEST(radar_bench, test_zbus_round_trip)
+{
+    const struct zbus_channel *chan;
+    camera_trigger_t req = { .type = VEHICLE_LIGHT };
+    camera_trigger_t rsp;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < CONFIG_RADAR_BENCH_IPC_ITERATIONS; i++) {
+        req.speed_kmh = i;
+        zassert_ok(zbus_chan_pub(&bench_req_chan, &req, K_FOREVER), "publish failed");
+        zassert_ok(zbus_sub_wait(&bench_client_sub, &chan, K_FOREVER), "wait failed");
+        zassert_ok(zbus_chan_read(&bench_rsp_chan, &rsp, K_FOREVER), "read failed");
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    zassert_equal(rsp.speed_kmh, req.speed_kmh, "Echo mismatch");
+    zassert_ok(bench_report("zbus_round_trip", CONFIG_RADAR_BENCH_IPC_ITERATIONS, elapsed),
+               "zbus round-trip regressed");
+}
+
+/**
+ * @brief Test suite for radar micro-benchmarks
+ */
+ZTEST_SUITE(radar_bench, NULL, NULL, NULL, NULL, NULL);
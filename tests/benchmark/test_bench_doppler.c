@@ -0,0 +1,75 @@
+#include <zephyr/ztest.h>
+#include "doppler.h"
+#include "doppler_synth.h"
+#include "bench.h"
+
+#define BENCH_DOPPLER_RATE_HZ 20000U
+#define BENCH_DOPPLER_CARRIER_MHZ 24125U
+#define BENCH_DOPPLER_KMH 87.5
+
+/* > One frame size and a recorded frame to measure */
+struct bench_doppler_ctx {
+    struct doppler radar;
+    struct doppler_iq frame[DOPPLER_MAX_POINTS];
+};
+
+static struct bench_doppler_ctx bench_doppler;
+
+/**
+ * @brief Records a vehicle at 87.5 km/h over offset and noise.
+ * @param ctx The context to fill.
+ * @param points Frame size.
+ */
+static void bench_doppler_setup(struct bench_doppler_ctx *ctx, uint16_t points)
+{
+    uint32_t state = 0x2545F491U;
+
+    zassert_ok(doppler_init(&ctx->radar, points, BENCH_DOPPLER_RATE_HZ,
+                            BENCH_DOPPLER_CARRIER_MHZ, 5));
+    doppler_synth_frame(ctx->frame, points,
+                        doppler_synth_hz(BENCH_DOPPLER_KMH, BENCH_DOPPLER_CARRIER_MHZ),
+                        BENCH_DOPPLER_RATE_HZ, 4000, 300, 400, &state);
+}
+
+/**
+ * @brief Benchmark body: one frame per iteration, window to speed.
+ */
+static void bench_doppler_frame(void *ctx, uint32_t iterations)
+{
+    struct bench_doppler_ctx *c = ctx;
+    struct doppler_result r;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        (void)doppler_measure(&c->radar, c->frame, 1, &r);
+        bench_sink += r.speed_ckmh;
+    }
+}
+
+ZTEST(radar_bench_doppler, test_doppler)
+{
+    static const struct {
+        const char *name;
+        uint16_t points;
+    } sizes[] = {
+        { "doppler_fft_256", 256 },
+        { "doppler_fft_512", 512 },
+        { "doppler_fft_1024", 1024 },
+    };
+
+    for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+        struct doppler_result r;
+
+        bench_doppler_setup(&bench_doppler, sizes[s].points);
+
+        /* The timed path must read the recorded vehicle */
+        zassert_ok(doppler_measure(&bench_doppler.radar, bench_doppler.frame, 1, &r));
+        zassert_within(r.speed_ckmh, 8750, 50, "%s read %u ckm/h", sizes[s].name,
+                       r.speed_ckmh);
+
+        zassert_ok(bench_run(sizes[s].name, bench_doppler_frame, &bench_doppler,
+                             CONFIG_RADAR_BENCH_ITERATIONS / 100U),
+                   "%s regressed", sizes[s].name);
+    }
+}
+
+ZTEST_SUITE(radar_bench_doppler, NULL, NULL, NULL, NULL, NULL);
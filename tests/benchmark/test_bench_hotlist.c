@@ -0,0 +1,90 @@
+#include <zephyr/ztest.h>
+#include "common.h"
+#include "hotlist.h"
+#include "bench.h"
+
+#define BENCH_HOTLIST_ENTRIES CONFIG_RADAR_BENCH_HOTLIST_ENTRIES
+#define BENCH_HOTLIST_QUERIES 4096U
+
+/* > Hotlist input, blob and the plates looked up by the benchmarks */
+static plate_id_t bench_hot_ids[BENCH_HOTLIST_ENTRIES];
+static uint8_t bench_hot_blob[HOTLIST_BLOB_MAX_SIZE(BENCH_HOTLIST_ENTRIES)];
+static size_t bench_hot_len;
+static plate_id_t bench_hot_hits[BENCH_HOTLIST_QUERIES];
+static plate_id_t bench_hot_misses[BENCH_HOTLIST_QUERIES];
+
+/**
+ * @brief Maps an index to a distinct BR plate (LLLNLNN).
+ */
+static plate_id_t bench_hot_plate(uint32_t i)
+{
+    char text[PLATE_TEXT_SIZE] = {
+        (char)('A' + (i / 17576000U) % 26U), (char)('A' + (i / 676000U) % 26U),
+        (char)('A' + (i / 26000U) % 26U),    (char)('0' + (i / 2600U) % 10U),
+        (char)('A' + (i / 100U) % 26U),      (char)('0' + (i / 10U) % 10U),
+        (char)('0' + i % 10U),               '\0',
+    };
+    return plate_id_from_str(text);
+}
+
+/**
+ * @brief Benchmark body for hotlist_contains over a query set.
+ * @param ctx The query set (BENCH_HOTLIST_QUERIES plates).
+ */
+static void bench_hotlist_contains(void *ctx, uint32_t iterations)
+{
+    const plate_id_t *queries = ctx;
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        acc += hotlist_contains(queries[i % BENCH_HOTLIST_QUERIES]) ? 1U : 0U;
+    }
+    bench_sink = acc;
+}
+
+/**
+ * @brief Builds and loads the hotlist: even indexes are listed, odd are not.
+ * Queries are spread over the whole list so lookups miss the cache.
+ */
+static void *bench_hotlist_setup(void)
+{
+    for (uint32_t i = 0; i < BENCH_HOTLIST_ENTRIES; i++) {
+        bench_hot_ids[i] = bench_hot_plate(2U * i);
+    }
+    zassert_ok(hotlist_build(bench_hot_ids, BENCH_HOTLIST_ENTRIES, 1, bench_hot_blob,
+                             sizeof(bench_hot_blob), &bench_hot_len), "build failed");
+    zassert_ok(hotlist_load(bench_hot_blob, bench_hot_len), "load failed");
+
+    uint32_t stride = BENCH_HOTLIST_ENTRIES / BENCH_HOTLIST_QUERIES + 1U;
+    for (uint32_t q = 0; q < BENCH_HOTLIST_QUERIES; q++) {
+        uint32_t i = (q * 2654435761U) % BENCH_HOTLIST_QUERIES * stride % BENCH_HOTLIST_ENTRIES;
+
+        bench_hot_hits[q] = bench_hot_plate(2U * i);
+        bench_hot_misses[q] = bench_hot_plate(2U * i + 1U);
+    }
+    return NULL;
+}
+
+ZTEST(radar_bench_hotlist, test_hotlist_contains)
+{
+    zassert_equal(hotlist_count(), BENCH_HOTLIST_ENTRIES, "hotlist not loaded");
+    zassert_true(hotlist_contains(bench_hot_hits[0]), "listed plate not found");
+    zassert_false(hotlist_contains(bench_hot_misses[0]), "unlisted plate found");
+
+    zassert_ok(bench_run("hotlist_contains_hit", bench_hotlist_contains, bench_hot_hits,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "hotlist hit lookup regressed");
+    zassert_ok(bench_run("hotlist_contains_miss", bench_hotlist_contains, bench_hot_misses,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "hotlist miss lookup regressed");
+}
+
+ZTEST(radar_bench_hotlist, test_hotlist_reload)
+{
+    /* One operation = one plate validated while swapping the list in */
+    uint64_t start = bench_now_ns();
+
+    zassert_ok(hotlist_load(bench_hot_blob, bench_hot_len), "reload failed");
+    zassert_ok(bench_report("hotlist_reload_per_plate", BENCH_HOTLIST_ENTRIES,
+                            bench_now_ns() - start), "hotlist reload regressed");
+}
+
+ZTEST_SUITE(radar_bench_hotlist, NULL, bench_hotlist_setup, NULL, NULL, NULL);
@@ -0,0 +1,83 @@
+#include <zephyr/ztest.h>
+#include "loop_signature.h"
+#include "loop_synth.h"
+#include "bench.h"
+
+#define BENCH_LOOP_SAMPLES 8192U
+#define BENCH_LOOP_BLOCK 64U
+#define BENCH_LOOP_SAMPLE_US 1000U
+
+/* > One lane of recorded traffic and its detector */
+struct bench_loop_ctx {
+    struct loop_sig_detector det;
+    uint16_t samples[BENCH_LOOP_SAMPLES];
+    size_t pos;
+};
+
+static struct bench_loop_ctx bench_loop;
+
+/**
+ * @brief Detector callback: classifies the vehicle, as the sensor thread would.
+ */
+static void bench_loop_vehicle(const struct loop_signature *sig, void *arg)
+{
+    ARG_UNUSED(arg);
+    bench_sink += loop_signature_classify(sig, BENCH_LOOP_SAMPLE_US, 16667);
+}
+
+/**
+ * @brief Records a car, a van, a truck and a motorcycle at 60 km/h, with
+ * idle loop between them.
+ * @param ctx The context to fill.
+ * @return The number of vehicles recorded.
+ */
+static uint32_t bench_loop_setup(struct bench_loop_ctx *ctx)
+{
+    static const struct loop_synth_vehicle *const traffic[] = {
+        &loop_synth_car, &loop_synth_van, &loop_synth_truck, &loop_synth_motorcycle,
+    };
+    const size_t slot = BENCH_LOOP_SAMPLES / ARRAY_SIZE(traffic);
+
+    for (size_t i = 0; i < ARRAY_SIZE(traffic); i++) {
+        loop_synth_samples(traffic[i], 16667, BENCH_LOOP_SAMPLE_US,
+                           CONFIG_RADAR_LOOP_LENGTH_CM, 1200, 100, &ctx->samples[i * slot],
+                           slot);
+    }
+    loop_signature_init(&ctx->det, CONFIG_RADAR_LOOP_SIG_ON_COUNTS,
+                        CONFIG_RADAR_LOOP_SIG_HOLD_SAMPLES);
+    ctx->pos = 0;
+    return ARRAY_SIZE(traffic);
+}
+
+/**
+ * @brief Benchmark body: one sample per iteration, fed in ADC-sized blocks.
+ */
+static void bench_loop_signature(void *ctx, uint32_t iterations)
+{
+    struct bench_loop_ctx *c = ctx;
+
+    while (iterations > 0U) {
+        size_t n = MIN(MIN(iterations, BENCH_LOOP_BLOCK), BENCH_LOOP_SAMPLES - c->pos);
+
+        bench_sink += loop_signature_feed(&c->det, &c->samples[c->pos], n, 1,
+                                          bench_loop_vehicle, NULL);
+        c->pos = (c->pos + n) % BENCH_LOOP_SAMPLES;
+        iterations -= n;
+    }
+}
+
+ZTEST(radar_bench_loop_signature, test_loop_signature)
+{
+    uint32_t vehicles = bench_loop_setup(&bench_loop);
+
+    /* The timed path must close every recorded vehicle */
+    zassert_equal(loop_signature_feed(&bench_loop.det, bench_loop.samples, BENCH_LOOP_SAMPLES, 1,
+                                      NULL, NULL), vehicles);
+
+    /* ops_per_sec is the sampling rate one lane could sustain */
+    zassert_ok(bench_run("loop_signature_samples", bench_loop_signature, &bench_loop,
+                         CONFIG_RADAR_BENCH_ITERATIONS),
+               "loop signature extraction regressed");
+}
+
+ZTEST_SUITE(radar_bench_loop_signature, NULL, NULL, NULL, NULL, NULL);
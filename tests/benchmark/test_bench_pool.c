@@ -0,0 +1,90 @@
+#include <zephyr/ztest.h>
+#include "enforcement.h"
+#include "lane_pool.h"
+#include "speed_stats.h"
+#include "rrd.h"
+#include "bench.h"
+
+#define BENCH_POOL_VEHICLES 1024U
+
+static sensor_data_t bench_pool_vehicles[BENCH_POOL_VEHICLES];
+static atomic_t bench_pool_infractions;
+
+/**
+ * @brief Enforcement work of one vehicle, without the I/O (log, display,
+ * camera) the benchmark image does not have.
+ * @param s_data The measurement.
+ */
+static void bench_pool_handler(const sensor_data_t *s_data)
+{
+    const struct radar_policy *policy = policy_acquire();
+    uint32_t speed;
+    uint32_t limit;
+    display_status_t status = policy_decide(policy, s_data->duration_ms, s_data->vclass,
+                                            &speed, &limit);
+
+    policy_release(policy);
+
+    (void)speed_stats_add(s_data->lane, speed, s_data->timestamp_end);
+    rrd_add((s_data->type == VEHICLE_LIGHT) ? RRD_VEHICLE_LIGHT : RRD_VEHICLE_HEAVY,
+            s_data->timestamp_end, 1);
+    rrd_add((enum rrd_metric)(RRD_STATUS_NORMAL + status), s_data->timestamp_end, 1);
+    if (status == STATUS_INFRACTION) {
+        atomic_inc(&bench_pool_infractions);
+    }
+}
+
+/**
+ * @brief Single-thread baseline: the handler called in a loop.
+ */
+static void bench_pool_inline(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_pool_handler(&bench_pool_vehicles[i % BENCH_POOL_VEHICLES]);
+    }
+}
+
+ZTEST(radar_bench_pool, test_pool_vs_inline)
+{
+    uint32_t seed = 1U;
+    int prio = k_thread_priority_get(k_current_get());
+
+    for (uint32_t i = 0; i < BENCH_POOL_VEHICLES; i++) {
+        seed = seed * 1103515245U + 12345U;
+        bench_pool_vehicles[i] = (sensor_data_t){
+            .timestamp_end = (int64_t)i * 100,
+            .duration_ms = 150U + (seed >> 16) % 300U,
+            .type = (seed & 0x100U) ? VEHICLE_HEAVY : VEHICLE_LIGHT,
+            .vclass = (seed & 0x100U) ? VEHICLE_CLASS_TRUCK_3 : VEHICLE_CLASS_CAR,
+            .lane = (uint8_t)(i % CONFIG_RADAR_LANE_COUNT),
+        };
+    }
+    speed_stats_init(0);
+    rrd_init(0);
+    zassert_ok(lane_pool_init(bench_pool_handler));
+
+    zassert_ok(bench_run("enforcement_inline", bench_pool_inline, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "enforcement_inline regressed");
+
+    /* Share the CPU with the workers, as the enforcement thread does */
+    k_thread_priority_set(k_current_get(), LANE_POOL_PRIORITY);
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < CONFIG_RADAR_BENCH_ITERATIONS; i++) {
+        while (lane_pool_submit(&bench_pool_vehicles[i % BENCH_POOL_VEHICLES]) == -ENOBUFS) {
+            k_yield();
+        }
+    }
+    while (!lane_pool_idle()) {
+        k_yield();
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    k_thread_priority_set(k_current_get(), prio);
+
+    bench_sink = (uint32_t)atomic_get(&bench_pool_infractions);
+    zassert_ok(bench_report("enforcement_pool", CONFIG_RADAR_BENCH_ITERATIONS, elapsed),
+               "enforcement_pool regressed");
+}
+
+ZTEST_SUITE(radar_bench_pool, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,54 @@
+#include <zephyr/ztest.h>
+#include "rrd.h"
+#include "bench.h"
+
+#define BENCH_RRD_DAY_MS (24LL * 60 * 60 * 1000)
+
+static uint32_t bench_rrd_out[CONFIG_RADAR_RRD_MINUTES];
+
+/**
+ * @brief Benchmark body for rrd_add: ten events per simulated second, so
+ * the timed loop also pays for the bucket rollups.
+ */
+static void bench_rrd_add(void *ctx, uint32_t iterations)
+{
+    int64_t *now = ctx;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        *now += 100;
+        rrd_add((enum rrd_metric)(i % RRD_METRIC_COUNT), *now, 1);
+    }
+}
+
+/**
+ * @brief Benchmark body for a one-hour query of the minutes tier.
+ */
+static void bench_rrd_query(void *ctx, uint32_t iterations)
+{
+    int64_t *now = ctx;
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        int n = rrd_query(RRD_TIER_MINUTE, (enum rrd_metric)(i % RRD_METRIC_COUNT),
+                          *now - 60 * 60 * 1000, *now, bench_rrd_out, 60, NULL);
+        acc += (uint32_t)n + bench_rrd_out[0];
+    }
+    bench_sink = acc;
+}
+
+ZTEST(radar_bench_rrd, test_rrd)
+{
+    int64_t now = 0;
+
+    rrd_init(0);
+    zassert_ok(bench_run("rrd_add", bench_rrd_add, &now, CONFIG_RADAR_BENCH_ITERATIONS),
+               "rrd_add regressed");
+
+    /* Fill a full day of history, then query the last hour */
+    now = BENCH_RRD_DAY_MS;
+    rrd_advance(now);
+    zassert_ok(bench_run("rrd_query_hour", bench_rrd_query, &now, CONFIG_RADAR_BENCH_ITERATIONS),
+               "rrd_query regressed");
+}
+
+ZTEST_SUITE(radar_bench_rrd, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,96 @@
+#include <zephyr/ztest.h>
+#include "common.h"
+#include "section.h"
+#include "bench.h"
+
+/* Hold the table at its configured capacity: 100k vehicles on native_sim */
+#define BENCH_SECTION_IN_FLIGHT CONFIG_RADAR_SECTION_CAPACITY
+#define BENCH_SECTION_T0 1000000
+/* Later than every entry read the benchmark makes */
+#define BENCH_SECTION_EXIT_MS (BENCH_SECTION_T0 + BENCH_SECTION_IN_FLIGHT)
+
+static plate_id_t bench_section_ids[BENCH_SECTION_IN_FLIGHT];
+
+/**
+ * @brief Maps an index to a distinct BR plate (LLLNLNN).
+ */
+static plate_id_t bench_section_plate(uint32_t i)
+{
+    char text[PLATE_TEXT_SIZE] = {
+        (char)('A' + (i / 17576000U) % 26U), (char)('A' + (i / 676000U) % 26U),
+        (char)('A' + (i / 26000U) % 26U),    (char)('0' + (i / 2600U) % 10U),
+        (char)('A' + (i / 100U) % 26U),      (char)('0' + (i / 10U) % 10U),
+        (char)('0' + i % 10U),               '\0',
+    };
+    return plate_id_from_str(text);
+}
+
+/**
+ * @brief Fills the table with one entry read per millisecond.
+ */
+static void bench_section_fill(void)
+{
+    section_init();
+    for (uint32_t i = 0; i < BENCH_SECTION_IN_FLIGHT; i++) {
+        zassert_ok(section_entry(bench_section_ids[i], BENCH_SECTION_T0 + i), "fill failed");
+    }
+}
+
+/**
+ * @brief Benchmark body: one exit match plus one entry read, keeping the
+ * number of in-flight vehicles constant.
+ */
+static void bench_section_match(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+    uint32_t acc = 0;
+    int64_t entry_ms;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        /* Scattered order so probes miss the cache like real traffic */
+        plate_id_t plate = bench_section_ids[(i * 2654435761U) % BENCH_SECTION_IN_FLIGHT];
+
+        acc += (section_exit(plate, BENCH_SECTION_EXIT_MS, &entry_ms) == 0) ? 1U : 0U;
+        (void)section_entry(plate, BENCH_SECTION_T0 + i % BENCH_SECTION_IN_FLIGHT);
+    }
+    bench_sink = acc;
+}
+
+static void *bench_section_setup(void)
+{
+    for (uint32_t i = 0; i < BENCH_SECTION_IN_FLIGHT; i++) {
+        bench_section_ids[i] = bench_section_plate(i);
+    }
+    return NULL;
+}
+
+ZTEST(radar_bench_section, test_section_match)
+{
+    bench_section_fill();
+    zassert_equal(section_in_flight(), BENCH_SECTION_IN_FLIGHT, "table not full");
+
+    zassert_ok(bench_run("section_exit_entry", bench_section_match, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "section matching regressed");
+    zassert_equal(section_in_flight(), BENCH_SECTION_IN_FLIGHT, "vehicles lost");
+}
+
+ZTEST(radar_bench_section, test_section_expire)
+{
+    /* One operation = one stale read evicted, swept in one-second steps */
+    int64_t max_travel_ms = (int64_t)CONFIG_RADAR_SECTION_MAX_TRAVEL_S * 1000;
+    int64_t last_ms = BENCH_SECTION_T0 + BENCH_SECTION_IN_FLIGHT + max_travel_ms;
+    size_t dropped = 0;
+
+    bench_section_fill();
+    uint64_t start = bench_now_ns();
+    for (int64_t now = BENCH_SECTION_T0 + max_travel_ms; now <= last_ms + 1000; now += 1000) {
+        dropped += section_expire(now);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    zassert_equal(dropped, BENCH_SECTION_IN_FLIGHT, "dropped %u", (unsigned int)dropped);
+    zassert_ok(bench_report("section_expire_per_read", BENCH_SECTION_IN_FLIGHT, elapsed),
+               "section expiry regressed");
+}
+
+ZTEST_SUITE(radar_bench_section, NULL, bench_section_setup, NULL, NULL, NULL);
@@ -0,0 +1,238 @@
+#include <zephyr/ztest.h>
+#include "enforcement.h"
+#include "speed_stats.h"
+#include "flow_metrics.h"
+#include "rrd.h"
+#include "pcpu_counter.h"
+#include "bench.h"
+
+#define BENCH_SMP_MAX_WORKERS 4
+#define BENCH_SMP_STACK_SIZE 2048
+#define BENCH_SMP_QUEUE_DEPTH 64
+/* Lane of the marker that stops a consumer */
+#define BENCH_SMP_STOP UINT8_MAX
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_smp_stacks, BENCH_SMP_MAX_WORKERS, BENCH_SMP_STACK_SIZE);
+static struct k_thread bench_smp_threads[BENCH_SMP_MAX_WORKERS];
+K_THREAD_STACK_DEFINE(bench_smp_producer_stack, BENCH_SMP_STACK_SIZE);
+static struct k_thread bench_smp_producer_thread;
+K_MSGQ_DEFINE(bench_smp_msgq, sizeof(sensor_data_t), BENCH_SMP_QUEUE_DEPTH, 8);
+static uint32_t bench_smp_per_worker;
+static atomic_t bench_smp_atomic;
+static struct pcpu_counter bench_smp_pcpu;
+static atomic_t bench_smp_infractions;
+
+/**
+ * @brief Producer body: the sensor stage. Accounts the flow of each
+ * vehicle, as the sensor thread does, and queues it for enforcement.
+ * @param p1 The number of vehicles, cast to a pointer.
+ * @param p2 The number of consumers to stop, cast to a pointer.
+ * @param p3 Unused.
+ */
+static void bench_smp_producer(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p3);
+
+    uint32_t vehicles = POINTER_TO_UINT(p1);
+    uint32_t seed = 1U;
+    sensor_data_t s_data = { 0 };
+
+    for (uint32_t i = 0; i < vehicles; i++) {
+        seed = seed * 1103515245U + 12345U;
+        s_data.lane = (uint8_t)(i % CONFIG_RADAR_LANE_COUNT);
+        s_data.timestamp_start = (int64_t)(i / CONFIG_RADAR_LANE_COUNT) * 500;
+        s_data.duration_ms = 150U + (seed >> 16) % 300U;
+        s_data.timestamp_end = s_data.timestamp_start + s_data.duration_ms;
+        s_data.timestamp_last_axle = s_data.timestamp_start + 80;
+        s_data.vclass = (seed & 0x100U) ? VEHICLE_CLASS_TRUCK_3 : VEHICLE_CLASS_CAR;
+        s_data.type = vehicle_class_type(s_data.vclass);
+
+        (void)flow_metrics_vehicle(s_data.lane, s_data.timestamp_start,
+                                   s_data.timestamp_last_axle);
+        (void)k_msgq_put(&bench_smp_msgq, &s_data, K_FOREVER);
+    }
+
+    s_data.lane = BENCH_SMP_STOP;
+    for (uint32_t w = 0; w < POINTER_TO_UINT(p2); w++) {
+        (void)k_msgq_put(&bench_smp_msgq, &s_data, K_FOREVER);
+    }
+}
+
+/**
+ * @brief Consumer body: the enforcement stage, without the I/O (log,
+ * display, camera) the benchmark image does not have. Takes vehicles off
+ * the queue until the stop marker.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void bench_smp_consumer(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    sensor_data_t s_data;
+
+    while (k_msgq_get(&bench_smp_msgq, &s_data, K_FOREVER) == 0 &&
+           s_data.lane != BENCH_SMP_STOP) {
+        const struct radar_policy *policy = policy_acquire();
+        uint32_t speed;
+        uint32_t limit;
+        display_status_t status = policy_decide(policy, s_data.duration_ms, s_data.vclass,
+                                                &speed, &limit);
+
+        policy_release(policy);
+
+        (void)speed_stats_add(s_data.lane, speed, s_data.timestamp_end);
+        rrd_add((s_data.type == VEHICLE_LIGHT) ? RRD_VEHICLE_LIGHT : RRD_VEHICLE_HEAVY,
+                s_data.timestamp_end, 1);
+        rrd_add((enum rrd_metric)(RRD_STATUS_NORMAL + status), s_data.timestamp_end, 1);
+        if (status == STATUS_INFRACTION) {
+            atomic_inc(&bench_smp_infractions);
+        }
+    }
+}
+
+/**
+ * @brief Worker body: one shared atomic counter, bumped by every CPU.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void bench_smp_atomic_worker(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (uint32_t i = 0; i < bench_smp_per_worker; i++) {
+        atomic_inc(&bench_smp_atomic);
+    }
+}
+
+/**
+ * @brief Worker body: the same count on a per-CPU sharded counter.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void bench_smp_pcpu_worker(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (uint32_t i = 0; i < bench_smp_per_worker; i++) {
+        pcpu_counter_inc(&bench_smp_pcpu);
+    }
+}
+
+/**
+ * @brief Runs CONFIG_RADAR_BENCH_ITERATIONS operations split over
+ * @p workers threads, each pinned to its own CPU.
+ * @param name The benchmark name.
+ * @param fn The worker body; gets its worker index as first argument.
+ * @param workers Number of worker threads (and CPUs).
+ * @return The result of bench_report().
+ */
+static int bench_smp_run(const char *name, k_thread_entry_t fn, unsigned int workers)
+{
+    /* Below the test thread, so it starts every worker before yielding */
+    int prio = k_thread_priority_get(k_current_get()) + 1;
+
+    bench_smp_per_worker = CONFIG_RADAR_BENCH_ITERATIONS / workers;
+
+    for (unsigned int w = 0; w < workers; w++) {
+        k_thread_create(&bench_smp_threads[w], bench_smp_stacks[w], BENCH_SMP_STACK_SIZE,
+                        fn, UINT_TO_POINTER(w), NULL, NULL,
+                        prio, 0, K_FOREVER);
+        zassert_ok(k_thread_cpu_pin(&bench_smp_threads[w], (int)w));
+    }
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int w = 0; w < workers; w++) {
+        k_thread_start(&bench_smp_threads[w]);
+    }
+    for (unsigned int w = 0; w < workers; w++) {
+        zassert_ok(k_thread_join(&bench_smp_threads[w], K_FOREVER));
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    return bench_report(name, bench_smp_per_worker * workers, elapsed);
+}
+
+/**
+ * @brief Runs CONFIG_RADAR_BENCH_ITERATIONS vehicles through the pipeline,
+ * from the producer's msgq put to the consumers' decision, with @p workers
+ * consumers each pinned to its own CPU. The producer shares CPU 0.
+ * @param name The benchmark name.
+ * @param workers Number of consumer threads (and CPUs).
+ * @return The result of bench_report().
+ */
+static int bench_smp_pipeline_run(const char *name, unsigned int workers)
+{
+    /* Below the test thread, so it starts every stage before yielding */
+    int prio = k_thread_priority_get(k_current_get()) + 1;
+    uint32_t vehicles = CONFIG_RADAR_BENCH_ITERATIONS;
+
+    k_msgq_purge(&bench_smp_msgq);
+    k_thread_create(&bench_smp_producer_thread, bench_smp_producer_stack,
+                    BENCH_SMP_STACK_SIZE, bench_smp_producer, UINT_TO_POINTER(vehicles),
+                    UINT_TO_POINTER(workers), NULL, prio, 0, K_FOREVER);
+    zassert_ok(k_thread_cpu_pin(&bench_smp_producer_thread, 0));
+    for (unsigned int w = 0; w < workers; w++) {
+        k_thread_create(&bench_smp_threads[w], bench_smp_stacks[w], BENCH_SMP_STACK_SIZE,
+                        bench_smp_consumer, NULL, NULL, NULL, prio, 0, K_FOREVER);
+        zassert_ok(k_thread_cpu_pin(&bench_smp_threads[w], (int)w));
+    }
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int w = 0; w < workers; w++) {
+        k_thread_start(&bench_smp_threads[w]);
+    }
+    k_thread_start(&bench_smp_producer_thread);
+    zassert_ok(k_thread_join(&bench_smp_producer_thread, K_FOREVER));
+    for (unsigned int w = 0; w < workers; w++) {
+        zassert_ok(k_thread_join(&bench_smp_threads[w], K_FOREVER));
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink = (uint32_t)atomic_get(&bench_smp_infractions);
+    return bench_report(name, vehicles, elapsed);
+}
+
+ZTEST(radar_bench_smp, test_smp_scaling)
+{
+    static const char *const names[BENCH_SMP_MAX_WORKERS] = {
+        "smp_vehicles_1cpu", "smp_vehicles_2cpu", "smp_vehicles_3cpu", "smp_vehicles_4cpu",
+    };
+    unsigned int cpus = MIN(arch_num_cpus(), BENCH_SMP_MAX_WORKERS);
+
+    /* 1, 2 and 4 CPUs, as far as the target has them */
+    for (unsigned int workers = 1; workers <= cpus; workers *= 2) {
+        speed_stats_init(0);
+        flow_metrics_reset(0);
+        rrd_init(0);
+        atomic_clear(&bench_smp_infractions);
+        zassert_ok(bench_smp_pipeline_run(names[workers - 1], workers),
+                   "smp_vehicles (%u CPUs) regressed", workers);
+    }
+}
+
+ZTEST(radar_bench_smp, test_counter_contention)
+{
+    unsigned int cpus = MIN(arch_num_cpus(), BENCH_SMP_MAX_WORKERS);
+
+    atomic_clear(&bench_smp_atomic);
+    pcpu_counter_reset(&bench_smp_pcpu);
+
+    /* Every CPU bumping the same line, then each its own */
+    zassert_ok(bench_smp_run("smp_counter_atomic", bench_smp_atomic_worker, cpus),
+               "smp_counter_atomic regressed");
+    zassert_ok(bench_smp_run("smp_counter_pcpu", bench_smp_pcpu_worker, cpus),
+               "smp_counter_pcpu regressed");
+    zassert_equal(pcpu_counter_get(&bench_smp_pcpu), (uint64_t)atomic_get(&bench_smp_atomic));
+}
+
+ZTEST_SUITE(radar_bench_smp, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,74 @@
+#include <zephyr/ztest.h>
+#include "speed_fit.h"
+#include "bench.h"
+
+/* > Loop array under test and one vehicle's crossings per speed */
+struct bench_fit_ctx {
+    struct speed_fit_model model;
+    uint32_t t_us[16][SPEED_FIT_MAX_LOOPS];
+};
+
+static struct bench_fit_ctx bench_fit4;
+static struct bench_fit_ctx bench_fit8;
+
+/**
+ * @brief Builds a loop array of evenly spaced loops over 5 m and the
+ * crossings of vehicles from 30 to 180 km/h, braking at 2 m/s^2.
+ * @param ctx The context to fill.
+ * @param loops Number of loops.
+ */
+static void bench_fit_setup(struct bench_fit_ctx *ctx, uint32_t loops)
+{
+    uint32_t pos[SPEED_FIT_MAX_LOOPS];
+
+    for (uint32_t i = 0; i < loops; i++) {
+        pos[i] = (5000U * i) / (loops - 1U);
+    }
+    zassert_ok(speed_fit_model_init(&ctx->model, pos, loops));
+
+    for (uint32_t v = 0; v < ARRAY_SIZE(ctx->t_us); v++) {
+        /* mm/ms, i.e. m/s */
+        double v0 = (30.0 + 10.0 * v) / 3.6;
+
+        for (uint32_t i = 0; i < loops; i++) {
+            double x = pos[i] / 1000.0;
+            /* t(x) under constant deceleration, to second order */
+            double s = x / v0 + x * x / (v0 * v0 * v0);
+
+            ctx->t_us[v][i] = 1000U * v + (uint32_t)(s * 1e6);
+        }
+    }
+}
+
+/**
+ * @brief Benchmark body: one least-squares fit per vehicle.
+ */
+static void bench_speed_fit(void *ctx, uint32_t iterations)
+{
+    struct bench_fit_ctx *c = ctx;
+    struct speed_fit fit;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (speed_fit_run(&c->model, c->t_us[i % ARRAY_SIZE(c->t_us)], &fit) == 0) {
+            bench_sink += fit.speed_ckmh;
+        }
+    }
+}
+
+ZTEST(radar_bench_speed_fit, test_speed_fit)
+{
+    struct speed_fit fit;
+
+    bench_fit_setup(&bench_fit4, 4);
+    bench_fit_setup(&bench_fit8, MIN(8, SPEED_FIT_MAX_LOOPS));
+    /* The timed path must be the accepting one */
+    zassert_ok(speed_fit_run(&bench_fit4.model, bench_fit4.t_us[0], &fit));
+    zassert_ok(speed_fit_run(&bench_fit8.model, bench_fit8.t_us[15], &fit));
+
+    zassert_ok(bench_run("speed_fit_4_loops", bench_speed_fit, &bench_fit4,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "4-loop fit regressed");
+    zassert_ok(bench_run("speed_fit_8_loops", bench_speed_fit, &bench_fit8,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "8-loop fit regressed");
+}
+
+ZTEST_SUITE(radar_bench_speed_fit, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,39 @@
+#include <zephyr/ztest.h>
+#include "speed_stats.h"
+#include "bench.h"
+
+#define BENCH_STATS_SPEEDS 1024U
+
+static uint32_t bench_stats_speeds[BENCH_STATS_SPEEDS];
+
+/**
+ * @brief Benchmark body for speed_stats_add, spread over the lanes.
+ */
+static void bench_speed_stats_add(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        (void)speed_stats_add((uint8_t)(i % CONFIG_RADAR_LANE_COUNT),
+                              bench_stats_speeds[i % BENCH_STATS_SPEEDS], 0);
+    }
+}
+
+ZTEST(radar_bench_speed_stats, test_speed_stats_add)
+{
+    uint32_t seed = 1U;
+    struct speed_stats_summary sum;
+
+    for (uint32_t i = 0; i < BENCH_STATS_SPEEDS; i++) {
+        seed = seed * 1103515245U + 12345U;
+        bench_stats_speeds[i] = 20U + (seed >> 16) % 100U;
+    }
+    speed_stats_init(0);
+
+    zassert_ok(bench_run("speed_stats_add", bench_speed_stats_add, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "speed_stats_add regressed");
+    zassert_ok(speed_stats_current(0, &sum));
+    bench_sink = (uint32_t)sum.p85_kmh;
+}
+
+ZTEST_SUITE(radar_bench_speed_stats, NULL, NULL, NULL, NULL, NULL);
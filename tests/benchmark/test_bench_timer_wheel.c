@@ -0,0 +1,85 @@
+#include <zephyr/ztest.h>
+#include "timer_wheel.h"
+#include "bench.h"
+
+/* Lanes refreshed round-robin, one start pulse per operation */
+#define BENCH_WHEEL_LANES 64U
+/* Start pulses between ticks: every lane once per tick */
+#define BENCH_WHEEL_PULSES_PER_TICK BENCH_WHEEL_LANES
+
+static struct k_timer bench_wheel_timers[BENCH_WHEEL_LANES];
+static struct timer_wheel bench_wheel;
+static struct timer_wheel_entry bench_wheel_entries[BENCH_WHEEL_LANES];
+
+/**
+ * @brief k_timer expiry handler; counts into the sink.
+ */
+static void bench_wheel_timer_expired(struct k_timer *timer)
+{
+    ARG_UNUSED(timer);
+    bench_sink++;
+}
+
+/**
+ * @brief Wheel expiry callback.
+ */
+static void bench_wheel_expired(struct timer_wheel_entry *entry, void *arg)
+{
+    ARG_UNUSED(entry);
+    ARG_UNUSED(arg);
+    bench_sink++;
+}
+
+/**
+ * @brief Benchmark body: each start pulse restarts its lane's own k_timer,
+ * as the sensor ISR did before the wheel.
+ */
+static void bench_axle_k_timer(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        /* Windows vary per pulse, as they follow the measured speed */
+        k_timer_start(&bench_wheel_timers[i % BENCH_WHEEL_LANES],
+                      K_MSEC(1000U + (i & 511U)), K_NO_WAIT);
+    }
+}
+
+/**
+ * @brief Benchmark body: each start pulse refreshes its lane's wheel entry;
+ * the wheel ticks once every BENCH_WHEEL_PULSES_PER_TICK pulses, and
+ * that tick is timed too.
+ */
+static void bench_axle_wheel(void *ctx, uint32_t iterations)
+{
+    ARG_UNUSED(ctx);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        timer_wheel_schedule(&bench_wheel, &bench_wheel_entries[i % BENCH_WHEEL_LANES],
+                             DIV_ROUND_UP(1000U + (i & 511U), CONFIG_RADAR_AXLE_WHEEL_TICK_MS));
+        if ((i % BENCH_WHEEL_PULSES_PER_TICK) == BENCH_WHEEL_PULSES_PER_TICK - 1U) {
+            (void)timer_wheel_tick(&bench_wheel, bench_wheel_expired, NULL);
+        }
+    }
+}
+
+ZTEST(radar_bench_timer_wheel, test_axle_timeouts_64_lanes)
+{
+    for (uint32_t l = 0; l < BENCH_WHEEL_LANES; l++) {
+        k_timer_init(&bench_wheel_timers[l], bench_wheel_timer_expired, NULL);
+        timer_wheel_entry_init(&bench_wheel_entries[l]);
+    }
+    timer_wheel_init(&bench_wheel);
+
+    zassert_ok(bench_run("axle_timeout_k_timer_64", bench_axle_k_timer, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "k_timer refresh regressed");
+    for (uint32_t l = 0; l < BENCH_WHEEL_LANES; l++) {
+        k_timer_stop(&bench_wheel_timers[l]);
+    }
+
+    zassert_ok(bench_run("axle_timeout_wheel_64", bench_axle_wheel, NULL,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "timer wheel refresh regressed");
+    zassert_equal(bench_wheel.pending, BENCH_WHEEL_LANES);
+}
+
+ZTEST_SUITE(radar_bench_timer_wheel, NULL, NULL, NULL, NULL, NULL);
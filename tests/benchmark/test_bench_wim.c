@@ -0,0 +1,86 @@
+#include <zephyr/ztest.h>
+#include "wim.h"
+#include "wim_synth.h"
+#include "bench.h"
+
+#define BENCH_WIM_SAMPLES 8192U
+#define BENCH_WIM_BLOCK 128U
+#define BENCH_WIM_SPEED_MM_S 16667U
+
+/* > One lane of recorded axles and its detector */
+struct bench_wim_ctx {
+    struct wim_detector det;
+    uint16_t samples[BENCH_WIM_SAMPLES];
+    size_t pos;
+};
+
+static struct bench_wim_ctx bench_wim;
+
+/**
+ * @brief Detector callback: weighs the axle, as the sensor thread would.
+ */
+static void bench_wim_axle(const struct wim_axle *axle, void *arg)
+{
+    ARG_UNUSED(arg);
+    bench_sink += wim_axle_kg(axle, CONFIG_RADAR_WIM_INTERVAL_US, BENCH_WIM_SPEED_MM_S,
+                              WIM_SYNTH_G_PER_COUNT_MM);
+}
+
+/**
+ * @brief Records a car and a three-axle truck at 60 km/h.
+ * @param ctx The context to fill.
+ * @return The number of axles recorded.
+ */
+static uint32_t bench_wim_setup(struct bench_wim_ctx *ctx)
+{
+    const size_t half = BENCH_WIM_SAMPLES / 2U;
+
+    wim_synth_samples(&wim_synth_car, BENCH_WIM_SPEED_MM_S, CONFIG_RADAR_WIM_INTERVAL_US, 200,
+                      100, ctx->samples, half);
+    wim_synth_samples(&wim_synth_truck_3, BENCH_WIM_SPEED_MM_S, CONFIG_RADAR_WIM_INTERVAL_US,
+                      200, 100, &ctx->samples[half], half);
+    wim_init(&ctx->det, CONFIG_RADAR_WIM_ON_COUNTS, CONFIG_RADAR_WIM_HOLD_SAMPLES);
+    ctx->pos = 0;
+    return wim_synth_car.axles + wim_synth_truck_3.axles;
+}
+
+/**
+ * @brief Benchmark body: one sample per iteration, fed in ADC-sized blocks.
+ */
+static void bench_wim_feed(void *ctx, uint32_t iterations)
+{
+    struct bench_wim_ctx *c = ctx;
+
+    while (iterations > 0U) {
+        size_t n = MIN(MIN(iterations, BENCH_WIM_BLOCK), BENCH_WIM_SAMPLES - c->pos);
+
+        bench_sink += wim_feed(&c->det, &c->samples[c->pos], n, 1, bench_wim_axle, NULL);
+        c->pos = (c->pos + n) % BENCH_WIM_SAMPLES;
+        iterations -= n;
+    }
+}
+
+ZTEST(radar_bench_wim, test_wim)
+{
+    uint32_t axles = bench_wim_setup(&bench_wim);
+    const uint32_t rate_hz = USEC_PER_SEC / CONFIG_RADAR_WIM_INTERVAL_US;
+
+    /* The timed path must close every recorded axle */
+    zassert_equal(wim_feed(&bench_wim.det, bench_wim.samples, BENCH_WIM_SAMPLES, 1, NULL, NULL),
+                  axles);
+
+    zassert_ok(bench_run("wim_samples", bench_wim_feed, &bench_wim,
+                         CONFIG_RADAR_BENCH_ITERATIONS), "weigh-in-motion kernel regressed");
+
+    /* One second of every lane at the configured rate, on this core */
+    uint64_t start = bench_now_ns();
+    bench_wim_feed(&bench_wim, rate_hz * CONFIG_RADAR_LANE_COUNT);
+    uint64_t elapsed_ns = bench_now_ns() - start;
+
+    TC_PRINT("wim: %u lane(s) at %u Hz take %llu us of every second on one core\n",
+             CONFIG_RADAR_LANE_COUNT, rate_hz, (unsigned long long)(elapsed_ns / 1000U));
+    zassert_true(elapsed_ns > 0U, "the benchmark clock did not advance");
+    zassert_true(elapsed_ns < NSEC_PER_SEC, "the kernel cannot keep up in real time");
+}
+
+ZTEST_SUITE(radar_bench_wim, NULL, NULL, NULL, NULL, NULL);
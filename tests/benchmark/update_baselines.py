@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Merge BENCH_JSON results from benchmark logs into bench_baselines.h.
+
+Usage: update_baselines.py <handler.log> [<handler.log> ...]
+
+Every result line replaces the stored baseline for its (board, name) pair;
+entries for other boards or benchmarks are kept.
+"""
+
+import json
+import pathlib
+import re
+import sys
+
+HEADER = pathlib.Path(__file__).with_name("bench_baselines.h")
+BEGIN = "/* BEGIN BASELINES */"
+END = "/* END BASELINES */"
+ENTRY_RE = re.compile(r'BENCH_BASELINE\("([^"]+)",\s*"([^"]+)",\s*(\d+)ULL\)')
+
+
+def main(logs):
+    text = HEADER.read_text()
+    start = text.index(BEGIN) + len(BEGIN)
+    stop = text.index(END)
+
+    baselines = {(b, n): int(ps) for b, n, ps in ENTRY_RE.findall(text[start:stop])}
+
+    for log in logs:
+        for line in pathlib.Path(log).read_text(errors="replace").splitlines():
+            _, sep, payload = line.partition("BENCH_JSON: ")
+            if not sep:
+                continue
+            result = json.loads(payload)
+            baselines[(result["board"], result["name"])] = int(result["ps_per_op"])
+
+    body = "".join(
+        f'\n    BENCH_BASELINE("{board}", "{name}", {ps}ULL),'
+        for (board, name), ps in sorted(baselines.items())
+    )
+    HEADER.write_text(text[:start] + body + "\n    " + text[stop:])
+    print(f"{HEADER.name}: {len(baselines)} baselines")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    main(sys.argv[1:])
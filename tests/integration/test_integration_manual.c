@@ -64,12 +64,15 @@ ZTEST(integration_simple, test_camera_trigger_structure)
 ZTEST(integration_simple, test_camera_result_structure)
 {
     camera_result_t result = {
-        .valid_read = true
+        .valid_read = true,
+        .plate = plate_id_from_str("ABC1D23")
     };
-    strcpy(result.plate, "ABC1D23");
+    char text[PLATE_TEXT_SIZE];
     
     zassert_true(result.valid_read, "Should be valid read");
-    zassert_true(validate_plate(result.plate), "Plate should be valid");
+    zassert_true(plate_id_is_valid(result.plate), "Plate should be valid");
+    zassert_equal(plate_id_to_str(result.plate, text, sizeof(text)), 0, "Decode failed");
+    zassert_true(validate_plate(text), "Decoded plate should be valid");
 }
 
 /**
@@ -0,0 +1,118 @@
+#include <zephyr/ztest.h>
+#include "axle_class.h"
+#include "sensor_fsm.h"
+
+/* > Axle pattern and the class it must get */
+struct axle_case {
+    uint32_t axles;
+    uint16_t spacing_cm[2];
+    vehicle_class_t expected;
+};
+
+static const struct axle_case axle_cases[] = {
+    { 0, { 0, 0 }, VEHICLE_CLASS_UNKNOWN },
+    { 1, { 0, 0 }, VEHICLE_CLASS_UNKNOWN },
+    { 2, { 140, 0 }, VEHICLE_CLASS_MOTORCYCLE },
+    { 2, { CONFIG_RADAR_AXLE_MOTORCYCLE_MAX_CM, 0 }, VEHICLE_CLASS_MOTORCYCLE },
+    { 2, { CONFIG_RADAR_AXLE_MOTORCYCLE_MAX_CM + 1, 0 }, VEHICLE_CLASS_CAR },
+    { 2, { CONFIG_RADAR_AXLE_CAR_MAX_CM, 0 }, VEHICLE_CLASS_CAR },
+    { 2, { CONFIG_RADAR_AXLE_CAR_MAX_CM + 1, 0 }, VEHICLE_CLASS_TRUCK_2 },
+    { 2, { CONFIG_RADAR_AXLE_BUS_MIN_CM - 1, 0 }, VEHICLE_CLASS_TRUCK_2 },
+    { 2, { CONFIG_RADAR_AXLE_BUS_MIN_CM, 0 }, VEHICLE_CLASS_BUS },
+    { 3, { 260, 480 }, VEHICLE_CLASS_CAR_TRAILER },
+    { 3, { 260, CONFIG_RADAR_AXLE_TANDEM_MAX_CM }, VEHICLE_CLASS_TRUCK_3 },
+    { 3, { 480, 135 }, VEHICLE_CLASS_TRUCK_3 },
+    { 3, { CONFIG_RADAR_AXLE_BUS_MIN_CM, 140 }, VEHICLE_CLASS_BUS },
+    { 4, { 260, 450 }, VEHICLE_CLASS_CAR_TRAILER },
+    { 4, { 400, 130 }, VEHICLE_CLASS_TRUCK_4 },
+    { 5, { 360, 130 }, VEHICLE_CLASS_TRUCK_5PLUS },
+    { 9, { 360, 130 }, VEHICLE_CLASS_TRUCK_5PLUS },
+};
+
+ZTEST(radar_axle_class, test_tree_leaves)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(axle_cases); i++) {
+        uint16_t spacing[CONFIG_RADAR_MAX_AXLES - 1] = { 0 };
+
+        spacing[0] = axle_cases[i].spacing_cm[0];
+        spacing[1] = axle_cases[i].spacing_cm[1];
+        zassert_equal(axle_classify(axle_cases[i].axles, spacing), axle_cases[i].expected,
+                      "case %zu: class %d, expected %d", i,
+                      axle_classify(axle_cases[i].axles, spacing), axle_cases[i].expected);
+    }
+}
+
+ZTEST(radar_axle_class, test_class_type)
+{
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_MOTORCYCLE), VEHICLE_LIGHT);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_CAR_TRAILER), VEHICLE_LIGHT);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_VAN), VEHICLE_LIGHT);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_BUS), VEHICLE_HEAVY);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_TRUCK_5PLUS), VEHICLE_HEAVY);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_UNKNOWN), VEHICLE_UNKNOWN);
+    zassert_equal(vehicle_class_type(VEHICLE_CLASS_COUNT), VEHICLE_UNKNOWN);
+}
+
+ZTEST(radar_axle_class, test_names_round_trip)
+{
+    for (int c = 0; c < VEHICLE_CLASS_COUNT; c++) {
+        zassert_equal(vehicle_class_from_name(vehicle_class_name((vehicle_class_t)c)), c);
+    }
+    zassert_equal(vehicle_class_from_name("light"), VEHICLE_CLASS_COUNT);
+    zassert_str_equal(vehicle_class_name(VEHICLE_CLASS_COUNT), "unknown");
+}
+
+/**
+ * @brief Test the FSM turns axle times into spacings at the measured speed
+ */
+ZTEST(radar_axle_class, test_fsm_spacings)
+{
+    struct sensor_fsm fsm;
+    sensor_data_t out;
+
+    /* 5 m in 200 ms is 25 mm/ms: a car with a 2.6 m wheelbase */
+    sensor_fsm_init(&fsm);
+    fsm.distance_mm = 5000;
+    sensor_fsm_handle_start(&fsm, 1000);
+    sensor_fsm_handle_start(&fsm, 1104);
+    sensor_fsm_handle_end(&fsm, 1200);
+    zassert_true(sensor_fsm_finalize(&fsm, &out));
+    zassert_equal(out.axle_spacing_cm[0], 260);
+    zassert_equal(out.vclass, VEHICLE_CLASS_CAR);
+    zassert_equal(out.type, VEHICLE_LIGHT);
+
+    /* Same timing over a 10 m sensor pair: twice the speed and spacing */
+    fsm.distance_mm = 10000;
+    sensor_fsm_handle_start(&fsm, 1000);
+    sensor_fsm_handle_start(&fsm, 1104);
+    sensor_fsm_handle_end(&fsm, 1200);
+    zassert_true(sensor_fsm_finalize(&fsm, &out));
+    zassert_equal(out.axle_spacing_cm[0], 520);
+    zassert_equal(out.vclass, VEHICLE_CLASS_TRUCK_2);
+}
+
+/**
+ * @brief Test axles past CONFIG_RADAR_MAX_AXLES are counted, not timed
+ */
+ZTEST(radar_axle_class, test_axles_past_capacity)
+{
+    struct sensor_fsm fsm;
+    sensor_data_t out;
+    uint32_t axles = CONFIG_RADAR_MAX_AXLES + 3;
+
+    sensor_fsm_init(&fsm);
+    fsm.distance_mm = 5000;
+    for (uint32_t i = 0; i < axles; i++) {
+        sensor_fsm_handle_start(&fsm, 1000 + 60 * i);
+    }
+    sensor_fsm_handle_end(&fsm, 1200);
+    zassert_true(sensor_fsm_finalize(&fsm, &out));
+    zassert_equal(out.axle_count, axles);
+    /* 60 ms at 25 mm/ms */
+    for (uint32_t i = 0; i < CONFIG_RADAR_MAX_AXLES - 1; i++) {
+        zassert_equal(out.axle_spacing_cm[i], 150, "spacing %u", i);
+    }
+    zassert_equal(out.vclass, VEHICLE_CLASS_TRUCK_5PLUS);
+}
+
+ZTEST_SUITE(radar_axle_class, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,108 @@
+#include <zephyr/ztest.h>
+#include "common.h"
+#include "decision_table.h"
+
+static struct decision_table dt_table;
+
+/* > Policy under test */
+struct dt_case {
+    uint32_t distance_mm;
+    uint32_t limit_light_kmh;
+    uint32_t limit_heavy_kmh;
+    uint32_t warning_percent;
+};
+
+static const struct dt_case dt_cases[] = {
+    { CONFIG_RADAR_SENSOR_DISTANCE_MM, 60, 40, 90 },
+    { 1, 1, 1, 0 },
+    { 7777, 300, 1, 100 },
+    { 3000, 45, 300, 50 },
+    { DECISION_MAX_DISTANCE_MM, 120, 80, 95 },
+};
+
+/**
+ * @brief Gets the limit of a vehicle class under a test case: light
+ * classes take the light limit, the rest (unknown included) the heavy one.
+ */
+static uint32_t dt_limit(const struct dt_case *tc, vehicle_class_t vclass)
+{
+    return (vehicle_class_type(vclass) == VEHICLE_LIGHT) ? tc->limit_light_kmh :
+                                                           tc->limit_heavy_kmh;
+}
+
+/**
+ * @brief The decision as enforcement made it before the table: limit by
+ * class, warning threshold and speed computed per vehicle.
+ */
+static display_status_t dt_reference(const struct dt_case *tc, uint32_t duration_ms,
+                                     vehicle_class_t vclass, uint32_t *speed_kmh,
+                                     uint32_t *limit_kmh)
+{
+    uint32_t speed = calculate_speed(tc->distance_mm, duration_ms);
+    uint32_t limit = dt_limit(tc, vclass);
+
+    *speed_kmh = speed;
+    *limit_kmh = limit;
+    if (speed > limit) {
+        return STATUS_INFRACTION;
+    }
+    if (speed >= (limit * tc->warning_percent) / 100) {
+        return STATUS_WARNING;
+    }
+    return STATUS_NORMAL;
+}
+
+/**
+ * @brief Builds the table of a test case.
+ */
+static void dt_build(const struct dt_case *tc)
+{
+    struct decision_class classes[DECISION_CLASSES];
+
+    for (int c = 0; c < DECISION_CLASSES; c++) {
+        classes[c].limit_kmh = dt_limit(tc, (vehicle_class_t)c);
+        classes[c].warning_kmh = (classes[c].limit_kmh * tc->warning_percent) / 100;
+    }
+    decision_table_build(&dt_table, tc->distance_mm, classes);
+}
+
+ZTEST(radar_decision_table, test_equivalent_for_every_duration)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(dt_cases); i++) {
+        const struct dt_case *tc = &dt_cases[i];
+        /* Past this duration every vehicle is measured at 0 km/h */
+        uint32_t last_ms = (36U * tc->distance_mm) / 10U + 2U;
+
+        dt_build(tc);
+        for (uint32_t d = 0; d <= last_ms; d++) {
+            /* Out-of-range classes are decided as unknown */
+            for (int c = 0; c <= VEHICLE_CLASS_COUNT; c++) {
+                uint32_t speed, limit, ref_speed, ref_limit;
+                display_status_t status = decision_lookup(&dt_table, d, (vehicle_class_t)c,
+                                                          &speed, &limit);
+                display_status_t ref = dt_reference(tc, d, (vehicle_class_t)c,
+                                                    &ref_speed, &ref_limit);
+
+                zassert_equal(speed, ref_speed, "case %zu, %u ms: speed %u, expected %u",
+                              i, d, speed, ref_speed);
+                zassert_equal(limit, ref_limit, "case %zu, %u ms", i, d);
+                zassert_equal(status, ref, "case %zu, %u ms, class %d: status %d, expected %d",
+                              i, d, c, status, ref);
+            }
+        }
+    }
+}
+
+ZTEST(radar_decision_table, test_long_durations_are_zero)
+{
+    uint32_t speed, limit;
+
+    dt_build(&dt_cases[0]);
+    zassert_equal(decision_lookup(&dt_table, UINT32_MAX, VEHICLE_CLASS_CAR, &speed, &limit),
+                  STATUS_NORMAL);
+    zassert_equal(speed, 0);
+    zassert_equal(decision_lookup(&dt_table, 0, VEHICLE_CLASS_BUS, &speed, &limit), STATUS_NORMAL);
+    zassert_equal(speed, 0);
+}
+
+ZTEST_SUITE(radar_decision_table, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,145 @@
+#include <zephyr/ztest.h>
+#include <math.h>
+#include "doppler.h"
+#include "doppler_synth.h"
+
+#define DOPPLER_T_RATE_HZ 20000U
+#define DOPPLER_T_CARRIER_MHZ 24125U
+#define DOPPLER_T_MIN_KMH 5U
+#define DOPPLER_T_MIN_SNR 10U
+
+static struct doppler doppler_t;
+static struct doppler_iq doppler_t_frame[DOPPLER_MAX_POINTS];
+
+/**
+ * @brief Measures one synthetic target on a fresh transform.
+ * @return The doppler_measure() result.
+ */
+static int doppler_t_measure(uint16_t points, double kmh, int16_t amplitude, int16_t dc,
+                             uint16_t noise, struct doppler_result *out)
+{
+    uint32_t state = 0x9E3779B9U;
+
+    zassert_ok(doppler_init(&doppler_t, points, DOPPLER_T_RATE_HZ, DOPPLER_T_CARRIER_MHZ,
+                            DOPPLER_T_MIN_KMH));
+    doppler_synth_frame(doppler_t_frame, points, doppler_synth_hz(kmh, DOPPLER_T_CARRIER_MHZ),
+                        DOPPLER_T_RATE_HZ, amplitude, dc, noise, &state);
+    return doppler_measure(&doppler_t, doppler_t_frame, DOPPLER_T_MIN_SNR, out);
+}
+
+ZTEST(radar_doppler, test_init)
+{
+    static const uint16_t bad[] = { 0, 8, 100, 2048 };
+
+    for (size_t i = 0; i < ARRAY_SIZE(bad); i++) {
+        zassert_equal(doppler_init(&doppler_t, bad[i], DOPPLER_T_RATE_HZ,
+                                   DOPPLER_T_CARRIER_MHZ, DOPPLER_T_MIN_KMH), -EINVAL,
+                      "%u points", bad[i]);
+    }
+    zassert_equal(doppler_init(&doppler_t, 256, 0, DOPPLER_T_CARRIER_MHZ, 5), -EINVAL);
+    zassert_equal(doppler_init(&doppler_t, 256, DOPPLER_T_RATE_HZ, 0, 5), -EINVAL);
+
+    /* 5 km/h is 223.6 Hz, bins of 19.5 Hz at 1024 points */
+    zassert_ok(doppler_init(&doppler_t, 1024, DOPPLER_T_RATE_HZ, DOPPLER_T_CARRIER_MHZ, 5));
+    zassert_equal(doppler_t.log2_points, 10);
+    zassert_equal(doppler_t.min_bin, 12);
+    zassert_ok(doppler_init(&doppler_t, 16, DOPPLER_T_RATE_HZ, DOPPLER_T_CARRIER_MHZ, 5));
+    zassert_equal(doppler_t.min_bin, 2, "never the bins beside DC");
+}
+
+ZTEST(radar_doppler, test_fft_matches_dft)
+{
+    const uint32_t n = 64;
+    uint32_t state = 12345;
+
+    zassert_ok(doppler_init(&doppler_t, n, DOPPLER_T_RATE_HZ, DOPPLER_T_CARRIER_MHZ, 5));
+    for (uint32_t i = 0; i < n; i++) {
+        doppler_t_frame[i].i = (int16_t)doppler_synth_noise(&state, 8000);
+        doppler_t_frame[i].q = (int16_t)doppler_synth_noise(&state, 8000);
+    }
+
+    struct doppler_iq in[64];
+
+    memcpy(in, doppler_t_frame, sizeof(in));
+    doppler_fft(&doppler_t, doppler_t_frame);
+
+    for (uint32_t k = 0; k < n; k++) {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            double a = -2.0 * M_PI * k * i / n;
+
+            re += in[i].i * cos(a) - in[i].q * sin(a);
+            im += in[i].i * sin(a) + in[i].q * cos(a);
+        }
+        zassert_within(doppler_t_frame[k].i, (int32_t)lround(re / n), 3, "bin %u", k);
+        zassert_within(doppler_t_frame[k].q, (int32_t)lround(im / n), 3, "bin %u", k);
+    }
+}
+
+ZTEST(radar_doppler, test_speeds)
+{
+    static const uint16_t sizes[] = { 256, 512, 1024 };
+    static const double kmh[] = { 10.0, 23.7, 50.0, 61.3, 80.0, 120.5, 160.0, 200.0 };
+    struct doppler_result r;
+
+    for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+        for (size_t v = 0; v < ARRAY_SIZE(kmh); v++) {
+            uint32_t ref = (uint32_t)lround(kmh[v] * 100.0);
+
+            zassert_ok(doppler_t_measure(sizes[s], kmh[v], 8000, 0, 0, &r));
+            zassert_true(r.approaching);
+            zassert_within(r.speed_ckmh, ref, 30, "%u points, %u ckm/h read %u",
+                           sizes[s], ref, r.speed_ckmh);
+        }
+    }
+}
+
+ZTEST(radar_doppler, test_receding)
+{
+    struct doppler_result r;
+
+    zassert_ok(doppler_t_measure(512, -72.0, 8000, 0, 0, &r));
+    zassert_false(r.approaching);
+    zassert_within(r.speed_ckmh, 7200, 30, "read %u", r.speed_ckmh);
+}
+
+ZTEST(radar_doppler, test_offset_and_noise)
+{
+    struct doppler_result r;
+
+    /* Mixer offset stays in the clutter bins; noise well under the tone */
+    zassert_ok(doppler_t_measure(512, 57.0, 3000, 4000, 1500, &r));
+    zassert_true(r.approaching);
+    zassert_within(r.speed_ckmh, 5700, 50, "read %u", r.speed_ckmh);
+    zassert_true(r.snr >= DOPPLER_T_MIN_SNR);
+
+    /* Full scale on both channels must not overflow the transform */
+    zassert_ok(doppler_t_measure(1024, 90.0, 32767, 0, 0, &r));
+    zassert_within(r.speed_ckmh, 9000, 30, "read %u", r.speed_ckmh);
+}
+
+ZTEST(radar_doppler, test_no_target)
+{
+    struct doppler_result r;
+
+    zassert_equal(doppler_t_measure(512, 60.0, 0, 100, 3000, &r), -ENODATA, "noise only");
+    zassert_equal(doppler_t_measure(512, 60.0, 0, 0, 0, &r), -ENODATA, "silence");
+
+    /* A strong target under the slowest speed leaks past the clutter edge */
+    zassert_equal(doppler_t_measure(512, 2.0, 8000, 0, 0, &r), -ENODATA, "too slow");
+}
+
+ZTEST(radar_doppler, test_fuse)
+{
+    zassert_equal(doppler_fuse_ckmh(5000, 0, 5, 50), 5000, "no radar");
+    zassert_equal(doppler_fuse_ckmh(0, 5123, 5, 50), 5123, "no loop speed");
+    zassert_equal(doppler_fuse_ckmh(5000, 5100, 5, 50), 5050);
+    zassert_equal(doppler_fuse_ckmh(5000, 5100, 5, 75), 5075);
+    zassert_equal(doppler_fuse_ckmh(5000, 5250, 5, 50), 5125, "at the limit");
+    zassert_equal(doppler_fuse_ckmh(5000, 5251, 5, 50), 5000, "another vehicle");
+    zassert_equal(doppler_fuse_ckmh(5000, 4700, 5, 50), 5000, "another vehicle");
+}
+
+ZTEST_SUITE(radar_doppler, NULL, NULL, NULL, NULL, NULL);
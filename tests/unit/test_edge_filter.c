@@ -0,0 +1,97 @@
+#include <zephyr/ztest.h>
+#include "edge_filter.h"
+
+/* Times below are in filter cycles: 100 minimum width, 1000 refractory */
+#define EF_MIN_PULSE 100U
+#define EF_REFRACTORY 1000U
+
+/**
+ * @brief Test clean pulses pass and report their rising edge
+ */
+ZTEST(radar_edge_filter, test_clean_pulses_accepted)
+{
+    struct edge_filter f;
+    edge_filter_init(&f, EF_MIN_PULSE, EF_REFRACTORY);
+
+    zassert_false(edge_filter_edge(&f, true, 5000));
+    zassert_true(edge_filter_edge(&f, false, 5300));
+    zassert_equal(f.rise_cyc, 5000, "Pulse start mismatch");
+
+    zassert_false(edge_filter_edge(&f, true, 6000));
+    zassert_true(edge_filter_edge(&f, false, 6100), "Minimum width is inclusive");
+    zassert_equal(f.stats.accepted, 2);
+    zassert_equal(f.stats.short_pulses + f.stats.refractory, 0);
+}
+
+/**
+ * @brief Test chatter around an axle pulse counts one axle
+ */
+ZTEST(radar_edge_filter, test_chatter_rejected)
+{
+    struct edge_filter f;
+    edge_filter_init(&f, EF_MIN_PULSE, EF_REFRACTORY);
+
+    /* Spike before the axle */
+    zassert_false(edge_filter_edge(&f, true, 1000));
+    zassert_false(edge_filter_edge(&f, false, 1020));
+    /* The axle */
+    zassert_false(edge_filter_edge(&f, true, 2000));
+    zassert_true(edge_filter_edge(&f, false, 2400));
+    /* Ringing after it, some of it wide enough to pass the width test */
+    zassert_false(edge_filter_edge(&f, true, 2450));
+    zassert_false(edge_filter_edge(&f, false, 2700));
+    zassert_false(edge_filter_edge(&f, true, 2800));
+    zassert_false(edge_filter_edge(&f, false, 2810));
+    /* A fall whose rise the ISR missed */
+    zassert_false(edge_filter_edge(&f, false, 2900));
+
+    zassert_equal(f.stats.accepted, 1);
+    zassert_equal(f.stats.short_pulses, 2);
+    zassert_equal(f.stats.refractory, 2);
+
+    /* The next axle, past the refractory period */
+    zassert_false(edge_filter_edge(&f, true, 3000));
+    zassert_true(edge_filter_edge(&f, false, 3200));
+}
+
+/**
+ * @brief Test a zero minimum width accepts on the rising edge
+ */
+ZTEST(radar_edge_filter, test_zero_width_accepts_on_rise)
+{
+    struct edge_filter f;
+    edge_filter_init(&f, 0, EF_REFRACTORY);
+
+    zassert_true(edge_filter_edge(&f, true, 100));
+    zassert_false(edge_filter_edge(&f, false, 101));
+    zassert_false(edge_filter_edge(&f, true, 500));
+    zassert_false(edge_filter_edge(&f, false, 501));
+    zassert_equal(f.stats.accepted, 1);
+    zassert_equal(f.stats.refractory, 1);
+    zassert_equal(f.stats.short_pulses, 0);
+}
+
+/**
+ * @brief Test pulses straddling the wrap of the 32-bit cycle counter
+ */
+ZTEST(radar_edge_filter, test_counter_wrap)
+{
+    struct edge_filter f;
+    edge_filter_init(&f, EF_MIN_PULSE, EF_REFRACTORY);
+
+    /* Wide pulse rising before the wrap and falling after it */
+    zassert_false(edge_filter_edge(&f, true, UINT32_MAX - 50U));
+    zassert_true(edge_filter_edge(&f, false, 200));
+    zassert_equal(f.rise_cyc, UINT32_MAX - 50U);
+    /* Ringing past the wrap is still within the refractory period */
+    zassert_false(edge_filter_edge(&f, true, 500));
+    zassert_false(edge_filter_edge(&f, false, 700));
+    zassert_equal(f.stats.refractory, 1);
+    /* Short pulse across the wrap */
+    edge_filter_init(&f, EF_MIN_PULSE, EF_REFRACTORY);
+    zassert_false(edge_filter_edge(&f, true, UINT32_MAX - 10U));
+    zassert_false(edge_filter_edge(&f, false, 20));
+    zassert_equal(f.stats.short_pulses, 1);
+}
+
+ZTEST_SUITE(radar_edge_filter, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,70 @@
+#include <zephyr/ztest.h>
+#include "flow_metrics.h"
+
+static void flow_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    flow_metrics_reset(0);
+}
+
+ZTEST(radar_flow_metrics, test_interval_metrics)
+{
+    struct flow_snapshot snap;
+
+    /* Three vehicles 2 s apart, each 200 ms over the start sensor */
+    zassert_ok(flow_metrics_vehicle(0, 1000, 1200));
+    zassert_ok(flow_metrics_vehicle(0, 3000, 3200));
+    zassert_ok(flow_metrics_vehicle(0, 5000, 5200));
+
+    zassert_ok(flow_metrics_snapshot(0, 10000, &snap));
+    zassert_equal(snap.start_ms, 0);
+    zassert_equal(snap.interval_ms, 10000U);
+    zassert_equal(snap.volume, 3U);
+    zassert_equal(snap.flow_veh_h, 1080U);
+    zassert_equal(snap.mean_headway_ms, 2000U);
+    zassert_equal(snap.mean_gap_ms, 1800U);
+    zassert_equal(snap.occupancy_permille, 60U);
+
+    /* The snapshot restarts the interval */
+    zassert_ok(flow_metrics_snapshot(0, 20000, &snap));
+    zassert_equal(snap.start_ms, 10000);
+    zassert_equal(snap.volume, 0U);
+    zassert_equal(snap.mean_headway_ms, 0U);
+}
+
+ZTEST(radar_flow_metrics, test_headway_spans_intervals)
+{
+    struct flow_snapshot snap;
+
+    zassert_ok(flow_metrics_vehicle(0, 9000, 9100));
+    zassert_ok(flow_metrics_snapshot(0, 10000, &snap));
+    zassert_equal(snap.mean_headway_ms, 0U, "first vehicle has no predecessor");
+
+    zassert_ok(flow_metrics_vehicle(0, 12000, 12100));
+    zassert_ok(flow_metrics_snapshot(0, 20000, &snap));
+    zassert_equal(snap.volume, 1U);
+    zassert_equal(snap.mean_headway_ms, 3000U);
+    zassert_equal(snap.mean_gap_ms, 2900U);
+}
+
+ZTEST(radar_flow_metrics, test_lanes_are_independent)
+{
+    struct flow_snapshot snap;
+
+    zassert_equal(flow_metrics_vehicle(CONFIG_RADAR_LANE_COUNT, 0, 10), -EINVAL);
+    zassert_equal(flow_metrics_vehicle(0, 100, 50), -EINVAL);
+    zassert_equal(flow_metrics_snapshot(CONFIG_RADAR_LANE_COUNT, 0, &snap), -EINVAL);
+
+    uint8_t last = CONFIG_RADAR_LANE_COUNT - 1;
+
+    zassert_ok(flow_metrics_vehicle(last, 1000, 1500));
+    zassert_ok(flow_metrics_snapshot(last, 1000, &snap));
+    zassert_equal(snap.volume, 1U);
+    zassert_equal(snap.occupancy_permille, 500U);
+    if (last > 0) {
+        zassert_ok(flow_metrics_snapshot(0, 1000, &snap));
+        zassert_equal(snap.volume, 0U);
+    }
+}
+
+ZTEST_SUITE(radar_flow_metrics, NULL, NULL, flow_before, NULL, NULL);
@@ -21,6 +21,7 @@ ZTEST(radar_fsm, test_start_start_end_finalize_light)
     zassert_equal(out.duration_ms, 400, "Duration mismatch");
     zassert_equal(out.axle_count, 2, "Axle count mismatch");
     zassert_equal(out.type, VEHICLE_LIGHT, "Type should be LIGHT");
+    zassert_equal(out.timestamp_last_axle, 1100, "Last axle time mismatch");
 }
 
 /**
@@ -103,6 +104,55 @@ ZTEST(radar_fsm, test_axle_window_scales_with_speed)
     zassert_true(slow_window > fast_window, "Window must grow when speed drops");
 }
 
+/**
+ * @brief Test the window closes once another axle would exceed the longest spacing
+ */
+ZTEST(radar_fsm, test_predictive_close_after_spacing)
+{
+    struct sensor_fsm fsm;
+    sensor_fsm_init(&fsm);
+    fsm.distance_mm = 5000;
+
+    /* Before the speed is known only the plain window applies */
+    sensor_fsm_handle_start(&fsm, 0);
+    sensor_fsm_handle_start(&fsm, 104);
+    zassert_equal(sensor_fsm_close_delay_ms(&fsm, 104), CONFIG_RADAR_AXLE_TIMEOUT_MS);
+
+    /* 5 m in 200 ms: 25 mm/ms */
+    zassert_true(sensor_fsm_handle_end(&fsm, 200));
+    int64_t spacing_ms = (CONFIG_RADAR_AXLE_MAX_SPACING_CM * 10 / 25) *
+                         (100 + CONFIG_RADAR_AXLE_CLOSE_MARGIN_PERCENT) / 100;
+    uint32_t expected = MIN(104 + spacing_ms - 200, sensor_fsm_get_axle_window_ms(&fsm));
+
+    zassert_equal(sensor_fsm_axle_deadline(&fsm), 104 + spacing_ms);
+    zassert_equal(sensor_fsm_close_delay_ms(&fsm, 200),
+                  IS_ENABLED(CONFIG_RADAR_AXLE_PREDICTIVE_CLOSE) ?
+                  expected : sensor_fsm_get_axle_window_ms(&fsm));
+}
+
+/**
+ * @brief Test the window closes at once past the longest vehicle
+ */
+ZTEST(radar_fsm, test_predictive_close_after_length)
+{
+    struct sensor_fsm fsm;
+    sensor_fsm_init(&fsm);
+    fsm.distance_mm = 5000;
+
+    sensor_fsm_handle_start(&fsm, 0);
+    zassert_true(sensor_fsm_handle_end(&fsm, 200));
+    int64_t length_ms = (CONFIG_RADAR_VEHICLE_MAX_LENGTH_CM * 10 / 25) *
+                        (100 + CONFIG_RADAR_AXLE_CLOSE_MARGIN_PERCENT) / 100;
+
+    /* An axle right before the length bound: the deadline is the bound */
+    sensor_fsm_handle_start(&fsm, length_ms - 10);
+    zassert_equal(sensor_fsm_axle_deadline(&fsm), length_ms);
+    if (IS_ENABLED(CONFIG_RADAR_AXLE_PREDICTIVE_CLOSE)) {
+        zassert_equal(sensor_fsm_close_delay_ms(&fsm, length_ms - 10), 10);
+        zassert_equal(sensor_fsm_close_delay_ms(&fsm, length_ms + 1), 0);
+    }
+}
+
 /**
  * @brief Test suite for radar FSM
  */
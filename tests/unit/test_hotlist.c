@@ -0,0 +1,122 @@
+#include <zephyr/ztest.h>
+#include <string.h>
+#include "common.h"
+#include "hotlist.h"
+
+#define HOTLIST_TEST_PLATES 600U
+
+static plate_id_t hot_ids[HOTLIST_TEST_PLATES];
+static uint8_t blob_a[HOTLIST_BLOB_MAX_SIZE(HOTLIST_TEST_PLATES)];
+static uint8_t blob_b[HOTLIST_BLOB_MAX_SIZE(HOTLIST_TEST_PLATES)];
+
+/**
+ * @brief Builds a distinct BR plate from an index ("AAA0A00" upward).
+ */
+static plate_id_t hot_plate(uint32_t i)
+{
+    char text[PLATE_TEXT_SIZE] = {
+        (char)('A' + (i / 26000U) % 26U), (char)('A' + (i / 1000U) % 26U),
+        (char)('A' + (i / 100U) % 10U),   (char)('0' + (i / 10U) % 10U),
+        (char)('A' + i % 10U),            '0',
+        (char)('0' + (i / 260000U) % 10U), '\0',
+    };
+    return plate_id_from_str(text);
+}
+
+/**
+ * @brief Builds a blob from plates [first, first + n) into buf.
+ */
+static size_t hot_build(uint32_t first, size_t n, uint32_t sequence, uint8_t *buf, size_t len)
+{
+    size_t out_len = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        hot_ids[i] = hot_plate(first + (uint32_t)i);
+    }
+    zassert_equal(hotlist_build(hot_ids, n, sequence, buf, len, &out_len), 0, "build failed");
+    return out_len;
+}
+
+ZTEST(radar_hotlist, test_lookup)
+{
+    size_t len = hot_build(0, HOTLIST_TEST_PLATES / 2U, 1, blob_a, sizeof(blob_a));
+
+    zassert_ok(hotlist_load(blob_a, len));
+    zassert_equal(hotlist_count(), HOTLIST_TEST_PLATES / 2U);
+
+    for (uint32_t i = 0; i < HOTLIST_TEST_PLATES; i++) {
+        bool expected = i < HOTLIST_TEST_PLATES / 2U;
+        zassert_equal(hotlist_contains(hot_plate(i)), expected, "plate %u", i);
+    }
+
+    /* Separators and case do not matter once the plate is a plate_id_t */
+    zassert_true(hotlist_contains(plate_id_from_str("aaa0a00")));
+    zassert_false(hotlist_contains(PLATE_ID_NONE));
+}
+
+ZTEST(radar_hotlist, test_duplicates_and_invalid_ids)
+{
+    plate_id_t ids[] = {
+        plate_id_from_str("XYZ9Z99"), PLATE_ID_NONE, plate_id_from_str("AB 123 CD"),
+        plate_id_from_str("xyz9z99"), plate_id_from_str("AB-123-CD"),
+    };
+    size_t len = 0;
+
+    zassert_ok(hotlist_build(ids, ARRAY_SIZE(ids), 7, blob_a, sizeof(blob_a), &len));
+    zassert_ok(hotlist_load(blob_a, len));
+    zassert_equal(hotlist_count(), 2U);
+    zassert_true(hotlist_contains(plate_id_from_str("XYZ9Z99")));
+    zassert_true(hotlist_contains(plate_id_from_str("AB123CD")));
+    zassert_false(hotlist_contains(plate_id_from_str("XYZ9Z98")));
+}
+
+ZTEST(radar_hotlist, test_reload_swaps_lists)
+{
+    size_t len_a = hot_build(0, 100, 1, blob_a, sizeof(blob_a));
+    size_t len_b = hot_build(100, 100, 2, blob_b, sizeof(blob_b));
+
+    zassert_ok(hotlist_load(blob_a, len_a));
+    zassert_true(hotlist_contains(hot_plate(5)));
+    zassert_false(hotlist_contains(hot_plate(105)));
+
+    zassert_ok(hotlist_load(blob_b, len_b));
+    zassert_false(hotlist_contains(hot_plate(5)));
+    zassert_true(hotlist_contains(hot_plate(105)));
+
+    /* blob_a is free again: reuse it for the next list */
+    len_a = hot_build(0, 10, 3, blob_a, sizeof(blob_a));
+    zassert_ok(hotlist_load(blob_a, len_a));
+    zassert_equal(hotlist_count(), 10U);
+}
+
+ZTEST(radar_hotlist, test_rejects_malformed_blobs)
+{
+    size_t len = hot_build(0, 50, 1, blob_a, sizeof(blob_a));
+    size_t small = 0;
+
+    zassert_ok(hotlist_load(blob_a, len));
+
+    zassert_equal(hotlist_build(hot_ids, 50, 1, blob_b, 32, &small), -ENOMEM);
+    zassert_equal(hotlist_load(blob_a, len - 1U), -EINVAL, "truncated blob accepted");
+    zassert_equal(hotlist_load(blob_a, 4), -EINVAL, "short header accepted");
+    zassert_equal(hotlist_load(NULL, len), -EINVAL);
+
+    memcpy(blob_b, blob_a, len);
+    blob_b[0] ^= 0xFFU;
+    zassert_equal(hotlist_load(blob_b, len), -EINVAL, "bad magic accepted");
+
+    /* Swap the last two packed plates: no longer strictly increasing */
+    memcpy(blob_b, blob_a, len);
+    uint8_t tmp[PLATE_ID_PACKED_SIZE];
+    uint8_t *last = blob_b + len - PLATE_ID_PACKED_SIZE;
+    memcpy(tmp, last, sizeof(tmp));
+    memcpy(last, last - PLATE_ID_PACKED_SIZE, sizeof(tmp));
+    memcpy(last - PLATE_ID_PACKED_SIZE, tmp, sizeof(tmp));
+    zassert_equal(hotlist_load(blob_b, len), -EINVAL, "unsorted blob accepted");
+
+    /* Failed loads keep the previous list */
+    zassert_equal(hotlist_count(), 50U);
+    zassert_true(hotlist_contains(hot_plate(49)));
+}
+
+ZTEST_SUITE(radar_hotlist, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,133 @@
+#include <zephyr/ztest.h>
+#include <string.h>
+#include "infraction_log.h"
+
+#define CHAIN_TEST_THREADS 2
+#define CHAIN_TEST_STACK 2048
+
+static infraction_record_t chain_buf[CONFIG_RADAR_INFRACTION_LOG_SIZE];
+K_THREAD_STACK_ARRAY_DEFINE(chain_test_stacks, CHAIN_TEST_THREADS, CHAIN_TEST_STACK);
+static struct k_thread chain_test_threads[CHAIN_TEST_THREADS];
+
+/**
+ * @brief Adds n records with varying contents.
+ */
+static void chain_add(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        infraction_record_t rec = {
+            .timestamp_ms = 1000 + i,
+            .type = (i & 1U) ? VEHICLE_HEAVY : VEHICLE_LIGHT,
+            .speed_kmh = 70U + i,
+            .limit_kmh = 60U,
+            .valid_read = (i % 3U) != 0U,
+            .plate = (i % 3U) != 0U ? plate_id_from_str("ABC1D23") + i : PLATE_ID_NONE,
+        };
+        infraction_log_add(&rec);
+    }
+}
+
+ZTEST(radar_infraction_chain, test_chain_verifies)
+{
+    struct infraction_log_checkpoint cp;
+    infraction_record_t newest;
+
+    chain_add(10);
+    infraction_log_chain_sync();
+
+    int n = infraction_log_verify_recent(chain_buf, ARRAY_SIZE(chain_buf), NULL);
+    zassert_true(n >= 10, "verify_recent returned %d", n);
+
+    /* The sync signs a checkpoint over the whole chain */
+    zassert_ok(infraction_log_get_checkpoint(&cp));
+    zassert_true(infraction_log_checkpoint_verify(&cp));
+    zassert_equal(infraction_log_get_recent(1, &newest), 1U);
+    zassert_equal(cp.count, newest.seq + 1U);
+    zassert_mem_equal(cp.digest, newest.digest, SHA256_DIGEST_SIZE);
+}
+
+ZTEST(radar_infraction_chain, test_tamper_detected)
+{
+    size_t bad = 0;
+
+    chain_add(8);
+    infraction_log_chain_sync();
+    int n = infraction_log_verify_recent(chain_buf, 8, NULL);
+    zassert_equal(n, 8);
+
+    /* Altered record: caught at that record */
+    chain_buf[5].speed_kmh -= 20U;
+    zassert_equal(infraction_log_chain_verify(chain_buf[0].digest, chain_buf + 1, 7, &bad),
+                  -EBADMSG);
+    zassert_equal(bad, 4U);
+    chain_buf[5].speed_kmh += 20U;
+    zassert_ok(infraction_log_chain_verify(chain_buf[0].digest, chain_buf + 1, 7, NULL));
+
+    /* Dropped record: the sequence gap is caught */
+    memmove(&chain_buf[3], &chain_buf[4], 4U * sizeof(chain_buf[0]));
+    zassert_equal(infraction_log_chain_verify(chain_buf[0].digest, chain_buf + 1, 6, &bad),
+                  -EBADMSG);
+    zassert_equal(bad, 2U);
+}
+
+ZTEST(radar_infraction_chain, test_overflow_keeps_chain)
+{
+    /* Far more records than the ring holds, without letting the worker catch up */
+    chain_add(3U * CONFIG_RADAR_INFRACTION_LOG_SIZE);
+    infraction_log_chain_sync();
+
+    zassert_equal(infraction_log_verify_recent(chain_buf, ARRAY_SIZE(chain_buf), NULL),
+                  CONFIG_RADAR_INFRACTION_LOG_SIZE);
+}
+
+/**
+ * @brief Adds records to a full ring, yielding between them.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void chain_test_adder(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (uint32_t i = 0; i < 2U * CONFIG_RADAR_INFRACTION_LOG_SIZE; i++) {
+        chain_add(1);
+        k_yield();
+    }
+}
+
+ZTEST(radar_infraction_chain, test_concurrent_overflow_keeps_chain)
+{
+    /* Adders racing to chain the record each is about to overwrite */
+    chain_add(CONFIG_RADAR_INFRACTION_LOG_SIZE);
+    for (int t = 0; t < CHAIN_TEST_THREADS; t++) {
+        k_thread_create(&chain_test_threads[t], chain_test_stacks[t], CHAIN_TEST_STACK,
+                        chain_test_adder, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+    }
+    for (int t = 0; t < CHAIN_TEST_THREADS; t++) {
+        zassert_ok(k_thread_join(&chain_test_threads[t], K_FOREVER));
+    }
+    infraction_log_chain_sync();
+
+    zassert_equal(infraction_log_verify_recent(chain_buf, ARRAY_SIZE(chain_buf), NULL),
+                  CONFIG_RADAR_INFRACTION_LOG_SIZE);
+}
+
+ZTEST(radar_infraction_chain, test_checkpoint_forgery)
+{
+    struct infraction_log_checkpoint cp;
+
+    chain_add(2);
+    infraction_log_chain_sync();
+    zassert_ok(infraction_log_get_checkpoint(&cp));
+
+    cp.count++;
+    zassert_false(infraction_log_checkpoint_verify(&cp), "forged count accepted");
+    cp.count--;
+    cp.digest[0] ^= 1U;
+    zassert_false(infraction_log_checkpoint_verify(&cp), "forged digest accepted");
+}
+
+ZTEST_SUITE(radar_infraction_chain, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,129 @@
+#include <zephyr/ztest.h>
+#include "lane_pool.h"
+
+BUILD_ASSERT(CONFIG_RADAR_LANE_COUNT > CONFIG_RADAR_ENFORCEMENT_WORKERS,
+             "the steal test needs two lanes on one worker");
+
+#define POOL_TEST_PER_LANE 100
+
+/* timestamp_start carries a per-lane sequence number, duration_ms a delay */
+static atomic_t pool_last_seq[CONFIG_RADAR_LANE_COUNT];
+static atomic_t pool_order_errors;
+
+/**
+ * @brief Pool handler checking that each lane is seen in submission order.
+ * @param s_data The measurement.
+ */
+static void pool_test_handler(const sensor_data_t *s_data)
+{
+    atomic_t *last = &pool_last_seq[s_data->lane];
+
+    if (s_data->timestamp_start != atomic_get(last) + 1) {
+        atomic_inc(&pool_order_errors);
+    }
+    if (s_data->duration_ms > 0U) {
+        k_msleep(s_data->duration_ms);
+    }
+    atomic_set(last, (atomic_val_t)s_data->timestamp_start);
+}
+
+/**
+ * @brief Submits one measurement, waiting while its lane is full.
+ * @param lane The lane.
+ * @param seq The per-lane sequence number.
+ * @param delay_ms Time the handler spends on it.
+ */
+static void pool_submit(uint8_t lane, int64_t seq, uint32_t delay_ms)
+{
+    sensor_data_t s_data = {
+        .timestamp_start = seq,
+        .duration_ms = delay_ms,
+        .lane = lane,
+    };
+    int ret;
+
+    while ((ret = lane_pool_submit(&s_data)) == -ENOBUFS) {
+        k_msleep(1);
+    }
+    zassert_ok(ret);
+}
+
+/**
+ * @brief Waits until the pool handled everything submitted.
+ */
+static void pool_wait_idle(void)
+{
+    for (int i = 0; i < 5000 && !lane_pool_idle(); i++) {
+        k_msleep(1);
+    }
+    zassert_true(lane_pool_idle(), "pool did not drain");
+}
+
+static void *pool_setup(void)
+{
+    zassert_ok(lane_pool_init(pool_test_handler));
+    zassert_equal(lane_pool_init(pool_test_handler), -EALREADY);
+    return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    for (int lane = 0; lane < CONFIG_RADAR_LANE_COUNT; lane++) {
+        atomic_clear(&pool_last_seq[lane]);
+    }
+    atomic_clear(&pool_order_errors);
+}
+
+ZTEST(radar_lane_pool, test_lane_order)
+{
+    struct lane_pool_stats before, after;
+
+    lane_pool_get_stats(&before);
+    for (int64_t seq = 1; seq <= POOL_TEST_PER_LANE; seq++) {
+        for (uint8_t lane = 0; lane < CONFIG_RADAR_LANE_COUNT; lane++) {
+            pool_submit(lane, seq, 0);
+        }
+    }
+    pool_wait_idle();
+    lane_pool_get_stats(&after);
+
+    zassert_equal(atomic_get(&pool_order_errors), 0);
+    zassert_equal(after.processed - before.processed,
+                  POOL_TEST_PER_LANE * CONFIG_RADAR_LANE_COUNT);
+    for (int lane = 0; lane < CONFIG_RADAR_LANE_COUNT; lane++) {
+        zassert_equal(atomic_get(&pool_last_seq[lane]), POOL_TEST_PER_LANE);
+    }
+}
+
+ZTEST(radar_lane_pool, test_steal_from_busy_home)
+{
+    /* Lanes 0 and WORKERS share worker 0; lane 0 keeps it busy */
+    const uint8_t slow = 0;
+    const uint8_t mate = CONFIG_RADAR_ENFORCEMENT_WORKERS;
+    struct lane_pool_stats before, after;
+
+    lane_pool_get_stats(&before);
+    for (int64_t seq = 1; seq <= 4; seq++) {
+        pool_submit(slow, seq, 20);
+    }
+    for (int64_t seq = 1; seq <= 4; seq++) {
+        pool_submit(mate, seq, 0);
+    }
+    pool_wait_idle();
+    lane_pool_get_stats(&after);
+
+    zassert_equal(atomic_get(&pool_order_errors), 0);
+    zassert_true(after.steals > before.steals, "busy home worker was not relieved");
+    zassert_equal(atomic_get(&pool_last_seq[slow]), 4);
+    zassert_equal(atomic_get(&pool_last_seq[mate]), 4);
+}
+
+ZTEST(radar_lane_pool, test_rejects_unknown_lane)
+{
+    sensor_data_t s_data = { .lane = CONFIG_RADAR_LANE_COUNT };
+
+    zassert_equal(lane_pool_submit(&s_data), -EINVAL);
+}
+
+ZTEST_SUITE(radar_lane_pool, NULL, pool_setup, pool_before, NULL, NULL);
@@ -1,4 +1,5 @@
 #include <zephyr/ztest.h>
+#include <string.h>
 #include "common.h"
 
 /**
@@ -69,6 +70,57 @@ ZTEST(radar_unit, test_plate_validation)
     zassert_true(validate_plate("abc1d23"), "Lowercase should be accepted (normalized to uppercase)");
 }
 
+/**
+ * @brief Test case for plate country identification
+ */
+ZTEST(radar_unit, test_plate_country)
+{
+    zassert_equal(validate_plate_country("ABC1D23"), PLATE_COUNTRY_BR, "Brasil");
+    zassert_equal(validate_plate_country("AB 123 CD"), PLATE_COUNTRY_AR, "Argentina");
+    zassert_equal(validate_plate_country("SAB-1234"), PLATE_COUNTRY_UY, "Uruguay");
+    zassert_equal(validate_plate_country("ABCD 123"), PLATE_COUNTRY_PY_CAR, "Paraguay car");
+    zassert_equal(validate_plate_country("123 abcd"), PLATE_COUNTRY_PY_MOTO, "Paraguay moto");
+    zassert_equal(validate_plate_country("AB_12345"), PLATE_COUNTRY_BO, "Bolivia");
+
+    zassert_equal(validate_plate_country(""), PLATE_COUNTRY_NONE, "Empty");
+    zassert_equal(validate_plate_country("UZ@48G FT"), PLATE_COUNTRY_NONE, "Symbol");
+    zassert_equal(validate_plate_country("ABC1D23\xC3"), PLATE_COUNTRY_NONE, "Non-ASCII");
+    zassert_equal(validate_plate_country("VF DSK47 OG"), PLATE_COUNTRY_NONE, "Too long");
+    zassert_equal(validate_plate_country("AB1D 23 4"), PLATE_COUNTRY_NONE, "No pattern");
+}
+
+/**
+ * @brief Test case for the integer plate identifier
+ */
+ZTEST(radar_unit, test_plate_id)
+{
+    char text[PLATE_TEXT_SIZE];
+
+    plate_id_t br = plate_id_from_str("ABC1D23");
+    zassert_true(plate_id_is_valid(br), "Valid plate should encode");
+    zassert_equal(plate_id_country(br), PLATE_COUNTRY_BR, "Country tag");
+    zassert_equal(plate_id_to_str(br, text, sizeof(text)), 0, "Decode failed");
+    zassert_true(strcmp(text, "ABC1D23") == 0, "Round trip mismatch");
+
+    /* Separators and case are canonicalized: one read, one identifier */
+    plate_id_t ar = plate_id_from_str("ab 123-cd");
+    zassert_equal(ar, plate_id_from_str("AB123CD"), "Canonical form mismatch");
+    zassert_equal(plate_id_hash(ar), plate_id_hash(plate_id_from_str("AB123CD")), "Hash");
+    zassert_equal(plate_id_to_str(ar, text, sizeof(text)), 0, "Decode failed");
+    zassert_true(strcmp(text, "AB123CD") == 0, "Canonical text mismatch");
+    zassert_not_equal(ar, br, "Distinct plates must differ");
+
+    /* Extremes of the radix-36 range */
+    plate_id_t py = plate_id_from_str("999ZZZZ");
+    zassert_equal(plate_id_to_str(py, text, sizeof(text)), 0, "Decode failed");
+    zassert_true(strcmp(text, "999ZZZZ") == 0, "Max digits mismatch");
+    zassert_true((py & PLATE_ID_VALUE_MASK) < 78364164096ULL, "Value exceeds 36^7");
+
+    zassert_equal(plate_id_from_str("A1B2C3D"), PLATE_ID_NONE, "Invalid plate");
+    zassert_equal(plate_id_to_str(PLATE_ID_NONE, text, sizeof(text)), -EINVAL, "None");
+    zassert_equal(plate_id_to_str(br, text, PLATE_TEXT_SIZE - 1), -ENOMEM, "Small buffer");
+}
+
 /**
  * @brief Test suite for radar unit
  */
@@ -0,0 +1,217 @@
+#include <zephyr/ztest.h>
+#include "loop_signature.h"
+#include "loop_synth.h"
+
+#define LS_SAMPLE_US 1000U
+#define LS_BASELINE 1200U
+#define LS_LEAD 200U /* Idle samples before the vehicle */
+#define LS_MAX_SAMPLES 4096U
+
+static uint16_t ls_buf[LS_MAX_SAMPLES];
+
+/* > Signatures collected by ls_collect() */
+struct ls_seen {
+    struct loop_signature sig[4];
+    uint32_t count;
+};
+
+/**
+ * @brief Detector callback: records the signature.
+ */
+static void ls_collect(const struct loop_signature *sig, void *arg)
+{
+    struct ls_seen *seen = arg;
+
+    if (seen->count < ARRAY_SIZE(seen->sig)) {
+        seen->sig[seen->count] = *sig;
+    }
+    seen->count++;
+}
+
+/**
+ * @brief Samples one vehicle crossing the loop, idle before and after.
+ * @return The number of samples written to ls_buf.
+ */
+static size_t ls_vehicle(const struct loop_synth_vehicle *v, uint32_t speed_mm_s)
+{
+    size_t n = LS_LEAD + loop_synth_span(v, speed_mm_s, LS_SAMPLE_US,
+                                         CONFIG_RADAR_LOOP_LENGTH_CM) +
+               2U * CONFIG_RADAR_LOOP_SIG_HOLD_SAMPLES;
+
+    zassert_true(n <= LS_MAX_SAMPLES);
+    loop_synth_samples(v, speed_mm_s, LS_SAMPLE_US, CONFIG_RADAR_LOOP_LENGTH_CM, LS_BASELINE,
+                       LS_LEAD, ls_buf, n);
+    return n;
+}
+
+/**
+ * @brief Feeds samples in blocks and returns the signatures seen.
+ */
+static void ls_feed(const uint16_t *samples, size_t n, size_t block, size_t stride,
+                    struct ls_seen *seen)
+{
+    struct loop_sig_detector det;
+
+    loop_signature_init(&det, CONFIG_RADAR_LOOP_SIG_ON_COUNTS,
+                        CONFIG_RADAR_LOOP_SIG_HOLD_SAMPLES);
+    *seen = (struct ls_seen){ 0 };
+    for (size_t i = 0; i < n; i += block) {
+        (void)loop_signature_feed(&det, &samples[i * stride], MIN(block, n - i), stride,
+                                  ls_collect, seen);
+    }
+}
+
+/**
+ * @brief Compares two signatures field by field.
+ */
+static bool ls_equal(const struct loop_signature *a, const struct loop_signature *b)
+{
+    return a->end_sample == b->end_sample && a->samples == b->samples && a->area == b->area &&
+           a->peak == b->peak && a->rise == b->rise && a->fall == b->fall;
+}
+
+ZTEST(radar_loop_signature, test_reference_vehicles)
+{
+    static const struct {
+        const struct loop_synth_vehicle *v;
+        vehicle_class_t vclass;
+    } cases[] = {
+        { &loop_synth_motorcycle, VEHICLE_CLASS_MOTORCYCLE },
+        { &loop_synth_car, VEHICLE_CLASS_CAR },
+        { &loop_synth_van, VEHICLE_CLASS_VAN },
+        { &loop_synth_bus, VEHICLE_CLASS_BUS },
+        { &loop_synth_truck, VEHICLE_CLASS_TRUCK_2 },
+    };
+    static const uint32_t kmh[] = { 20, 40, 60, 90, 140 };
+    struct ls_seen seen;
+
+    for (size_t c = 0; c < ARRAY_SIZE(cases); c++) {
+        for (size_t s = 0; s < ARRAY_SIZE(kmh); s++) {
+            uint32_t speed_mm_s = (kmh[s] * 1000000U) / 3600U;
+            size_t n = ls_vehicle(cases[c].v, speed_mm_s);
+
+            ls_feed(ls_buf, n, n, 1, &seen);
+            zassert_equal(seen.count, 1U, "vehicle %u at %u km/h: %u signatures",
+                          (unsigned int)c, kmh[s], seen.count);
+            zassert_equal(loop_signature_classify(&seen.sig[0], LS_SAMPLE_US, speed_mm_s),
+                          cases[c].vclass, "vehicle %u at %u km/h", (unsigned int)c, kmh[s]);
+        }
+    }
+}
+
+ZTEST(radar_loop_signature, test_features)
+{
+    uint32_t speed_mm_s = 16667; /* 60 km/h */
+    uint32_t span = loop_synth_span(&loop_synth_bus, speed_mm_s, LS_SAMPLE_US,
+                                    CONFIG_RADAR_LOOP_LENGTH_CM);
+    size_t n = ls_vehicle(&loop_synth_bus, speed_mm_s);
+    struct ls_seen seen;
+
+    ls_feed(ls_buf, n, n, 1, &seen);
+    zassert_equal(seen.count, 1U);
+    /* The thresholds cut into the ramps at both ends; the hold is not counted */
+    zassert_within(seen.sig[0].samples, span, 40U, "%u of %u", seen.sig[0].samples, span);
+    zassert_within(seen.sig[0].peak, loop_synth_bus.body_amp, 2U);
+    zassert_true(seen.sig[0].rise > 0U && seen.sig[0].fall > 0U);
+    zassert_true(seen.sig[0].end_sample > LS_LEAD);
+    zassert_true(seen.sig[0].end_sample < LS_LEAD + span);
+}
+
+ZTEST(radar_loop_signature, test_blocks_and_stride)
+{
+    static uint16_t interleaved[2 * LS_MAX_SAMPLES];
+    static const size_t blocks[] = { 1, 7, 64, 1000 };
+    uint32_t speed_mm_s = 11111; /* 40 km/h */
+    size_t n = ls_vehicle(&loop_synth_truck, speed_mm_s);
+    struct ls_seen whole;
+    struct ls_seen split;
+
+    ls_feed(ls_buf, n, n, 1, &whole);
+    zassert_equal(whole.count, 1U, "the trailer gap must not split the truck");
+
+    for (size_t b = 0; b < ARRAY_SIZE(blocks); b++) {
+        ls_feed(ls_buf, n, blocks[b], 1, &split);
+        zassert_equal(split.count, 1U);
+        zassert_true(ls_equal(&split.sig[0], &whole.sig[0]), "block of %u",
+                     (unsigned int)blocks[b]);
+    }
+
+    /* Second of two interleaved channels, as the ADC stores a sampling */
+    for (size_t i = 0; i < n; i++) {
+        interleaved[2U * i] = LS_BASELINE + 2000U;
+        interleaved[2U * i + 1U] = ls_buf[i];
+    }
+    ls_feed(&interleaved[1], n, 64, 2, &split);
+    zassert_equal(split.count, 1U);
+    zassert_true(ls_equal(&split.sig[0], &whole.sig[0]));
+}
+
+ZTEST(radar_loop_signature, test_baseline_drift_and_noise)
+{
+    uint32_t speed_mm_s = 16667;
+    size_t n = ls_vehicle(&loop_synth_car, speed_mm_s);
+    uint32_t lfsr = 0xACE1U;
+    struct ls_seen seen;
+
+    /* A slow temperature drift and a few counts of noise */
+    for (size_t i = 0; i < n; i++) {
+        lfsr = (lfsr >> 1) ^ ((lfsr & 1U) ? 0xB400U : 0U);
+        ls_buf[i] = ls_buf[i] + (uint16_t)(i / 64U) + (uint16_t)(lfsr & 7U);
+    }
+    ls_feed(ls_buf, n, 64, 1, &seen);
+    zassert_equal(seen.count, 1U);
+    zassert_equal(loop_signature_classify(&seen.sig[0], LS_SAMPLE_US, speed_mm_s),
+                  VEHICLE_CLASS_CAR);
+
+    /* Noise under the threshold never opens a vehicle */
+    for (size_t i = 0; i < LS_MAX_SAMPLES; i++) {
+        lfsr = (lfsr >> 1) ^ ((lfsr & 1U) ? 0xB400U : 0U);
+        ls_buf[i] = LS_BASELINE + (uint16_t)(lfsr % CONFIG_RADAR_LOOP_SIG_ON_COUNTS);
+    }
+    ls_feed(ls_buf, LS_MAX_SAMPLES, 64, 1, &seen);
+    zassert_equal(seen.count, 0U);
+}
+
+ZTEST(radar_loop_signature, test_back_to_back)
+{
+    uint32_t speed_mm_s = 22222; /* 80 km/h */
+    size_t n = ls_vehicle(&loop_synth_van, speed_mm_s);
+    struct ls_seen seen;
+
+    zassert_true(2U * n <= LS_MAX_SAMPLES);
+    memcpy(&ls_buf[n], ls_buf, n * sizeof(ls_buf[0]));
+    ls_feed(ls_buf, 2U * n, 64, 1, &seen);
+    zassert_equal(seen.count, 2U);
+    zassert_equal(seen.sig[1].end_sample - seen.sig[0].end_sample, n);
+    zassert_equal(loop_signature_classify(&seen.sig[1], LS_SAMPLE_US, speed_mm_s),
+                  VEHICLE_CLASS_VAN);
+}
+
+ZTEST(radar_loop_signature, test_unknown)
+{
+    struct loop_signature sig = { .samples = 500, .area = 100000, .peak = 400 };
+
+    zassert_equal(loop_signature_classify(&sig, LS_SAMPLE_US, 0), VEHICLE_CLASS_UNKNOWN);
+    sig.samples = 0;
+    zassert_equal(loop_signature_classify(&sig, LS_SAMPLE_US, 16667), VEHICLE_CLASS_UNKNOWN);
+}
+
+ZTEST(radar_loop_signature, test_fuse)
+{
+    /* The loop tells bodies apart, the axles count */
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_CAR, VEHICLE_CLASS_VAN), VEHICLE_CLASS_VAN);
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_CAR, VEHICLE_CLASS_BUS), VEHICLE_CLASS_CAR);
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_TRUCK_3, VEHICLE_CLASS_TRUCK_2),
+                  VEHICLE_CLASS_TRUCK_3);
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_CAR_TRAILER, VEHICLE_CLASS_VAN),
+                  VEHICLE_CLASS_CAR_TRAILER);
+    /* Missed axles take the loop class, a missed loop keeps the axle class */
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_UNKNOWN, VEHICLE_CLASS_MOTORCYCLE),
+                  VEHICLE_CLASS_MOTORCYCLE);
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_BUS, VEHICLE_CLASS_UNKNOWN),
+                  VEHICLE_CLASS_BUS);
+    zassert_equal(loop_signature_fuse(VEHICLE_CLASS_CAR, VEHICLE_CLASS_COUNT),
+                  VEHICLE_CLASS_CAR);
+}
+
+ZTEST_SUITE(radar_loop_signature, NULL, NULL, NULL, NULL, NULL);
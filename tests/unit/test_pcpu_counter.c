@@ -0,0 +1,72 @@
+#include <zephyr/ztest.h>
+#include "pcpu_counter.h"
+
+#define PCPU_TEST_THREADS 3
+#define PCPU_TEST_INCS 10000
+#define PCPU_TEST_STACK 1024
+
+static struct pcpu_counter pcpu_test_counter;
+K_THREAD_STACK_ARRAY_DEFINE(pcpu_test_stacks, PCPU_TEST_THREADS, PCPU_TEST_STACK);
+static struct k_thread pcpu_test_threads[PCPU_TEST_THREADS];
+
+static void pcpu_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    pcpu_counter_reset(&pcpu_test_counter);
+}
+
+ZTEST(radar_pcpu_counter, test_add_and_get)
+{
+    zassert_equal(pcpu_counter_get(&pcpu_test_counter), 0U);
+    pcpu_counter_inc(&pcpu_test_counter);
+    pcpu_counter_add(&pcpu_test_counter, 41U);
+    zassert_equal(pcpu_counter_get(&pcpu_test_counter), 42U);
+}
+
+ZTEST(radar_pcpu_counter, test_no_32bit_wrap)
+{
+    /* Past the point where a 32-bit counter wraps */
+    pcpu_counter_add(&pcpu_test_counter, UINT32_MAX);
+    pcpu_counter_add(&pcpu_test_counter, 2U);
+    zassert_equal(pcpu_counter_get(&pcpu_test_counter), (uint64_t)UINT32_MAX + 2U);
+
+    pcpu_counter_reset(&pcpu_test_counter);
+    zassert_equal(pcpu_counter_get(&pcpu_test_counter), 0U);
+}
+
+/**
+ * @brief Increments the shared test counter.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void pcpu_test_worker(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (int i = 0; i < PCPU_TEST_INCS; i++) {
+        pcpu_counter_inc(&pcpu_test_counter);
+        if ((i % 1000) == 0) {
+            k_yield();
+        }
+    }
+}
+
+ZTEST(radar_pcpu_counter, test_concurrent_increments)
+{
+    for (int t = 0; t < PCPU_TEST_THREADS; t++) {
+        k_thread_create(&pcpu_test_threads[t], pcpu_test_stacks[t], PCPU_TEST_STACK,
+                        pcpu_test_worker, NULL, NULL, NULL,
+                        K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+    }
+    for (int t = 0; t < PCPU_TEST_THREADS; t++) {
+        zassert_ok(k_thread_join(&pcpu_test_threads[t], K_FOREVER));
+    }
+
+    zassert_equal(pcpu_counter_get(&pcpu_test_counter),
+                  (uint64_t)PCPU_TEST_THREADS * PCPU_TEST_INCS);
+}
+
+ZTEST_SUITE(radar_pcpu_counter, NULL, NULL, pcpu_before, NULL, NULL);
@@ -0,0 +1,148 @@
+#include <zephyr/ztest.h>
+#include <string.h>
+#include "common.h"
+#include "plate_batch.h"
+
+#define FUZZ_BATCH   509U /* Odd on purpose: exercises the kernel tails */
+#define FUZZ_ROUNDS  64U
+
+static char fuzz_plates[FUZZ_BATCH][PLATE_STR_SIZE];
+static uint8_t fuzz_country[FUZZ_BATCH];
+static uint32_t fuzz_state = 0x1234567U;
+
+/**
+ * @brief Deterministic xorshift32 generator (reproducible failures).
+ */
+static uint32_t fuzz_next(void)
+{
+    fuzz_state ^= fuzz_state << 13;
+    fuzz_state ^= fuzz_state >> 17;
+    fuzz_state ^= fuzz_state << 5;
+    return fuzz_state;
+}
+
+/**
+ * @brief Fills a slot with a plate-like string: mostly well-formed plates of
+ * every Mercosul shape, with random case, separators, junk and lengths.
+ */
+static void fuzz_fill_slot(char *slot)
+{
+    static const char *const shapes[] = {
+        "LLLNLNN", "LLNNNLL", "LLLNNNN", "LLLLNNN", "NNNLLLL", "LLNNNNN", "LNLNLNL",
+    };
+    static const char junk[] = " -_@%&*!.\x80\xC3\xFF\x7F";
+    const char *shape = shapes[fuzz_next() % ARRAY_SIZE(shapes)];
+    size_t len = 0;
+
+    /* Garbage beyond the terminator must never affect the result */
+    for (size_t i = 0; i < PLATE_STR_SIZE; i++) {
+        slot[i] = (char)fuzz_next();
+    }
+
+    for (size_t i = 0; shape[i] != '\0' && len < PLATE_STR_SIZE - 1; i++) {
+        uint32_t r = fuzz_next();
+        char c = (shape[i] == 'L') ? (char)('A' + r % 26U) : (char)('0' + r % 10U);
+
+        if ((r >> 8) % 4U == 0U) {
+            c = (char)(c | 0x20); /* lowercase letters, digits unchanged */
+        }
+        if ((r >> 12) % 16U == 0U) {
+            c = junk[(r >> 16) % (sizeof(junk) - 1)];
+        }
+        slot[len++] = c;
+        if ((r >> 20) % 8U == 0U && len < PLATE_STR_SIZE - 1) {
+            slot[len++] = junk[(r >> 24) % 3U]; /* separator */
+        }
+    }
+
+    uint32_t r = fuzz_next();
+    if (r % 8U == 0U && len > 0) {
+        len -= 1U + (r >> 8) % len; /* truncate */
+    } else if (r % 8U == 1U) {
+        while (len < PLATE_STR_SIZE - 1) {
+            slot[len++] = (char)('0' + fuzz_next() % 10U); /* overlong */
+        }
+    }
+    slot[len] = '\0';
+}
+
+/**
+ * @brief Fuzz-style equivalence against validate_plate/validate_plate_country
+ */
+ZTEST(radar_plate_batch, test_batch_matches_scalar)
+{
+    size_t total_valid = 0;
+
+    TC_PRINT("validate_plates_batch kernel: %s\n", validate_plates_batch_kernel());
+
+    for (uint32_t round = 0; round < FUZZ_ROUNDS; round++) {
+        for (size_t i = 0; i < FUZZ_BATCH; i++) {
+            fuzz_fill_slot(fuzz_plates[i]);
+        }
+        /* Vary n so every tail length is exercised */
+        size_t n = FUZZ_BATCH - (round % 8U);
+        size_t valid = validate_plates_batch(fuzz_plates, n, fuzz_country);
+        size_t expected_valid = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            plate_country_t expected = validate_plate_country(fuzz_plates[i]);
+
+            zassert_equal(fuzz_country[i], expected, "Slot %u ('%s') mismatch", (unsigned)i,
+                          fuzz_plates[i]);
+            zassert_equal(fuzz_country[i] != PLATE_COUNTRY_NONE,
+                          validate_plate(fuzz_plates[i]), "validate_plate disagrees");
+            expected_valid += (expected != PLATE_COUNTRY_NONE);
+        }
+        zassert_equal(valid, expected_valid, "Valid count mismatch");
+        total_valid += valid;
+    }
+
+    zassert_true(total_valid > 0, "Fuzzer should produce valid plates");
+}
+
+/**
+ * @brief Known plates, an unterminated slot and empty input
+ */
+ZTEST(radar_plate_batch, test_batch_edge_cases)
+{
+    static const char plates[][PLATE_STR_SIZE] = {
+        "ABC1D23", "AB 123 CD", "abcd123", "123ABCD", "AB12345", "SAB1234",
+        "ABC1D2", "A1B2C3D", "ABC1D23 ", "",
+        { 'A', 'B', 'C', '1', 'D', '2', '3', 'X', 'Y', 'Z' }, /* no terminator */
+    };
+    static const uint8_t expected[] = {
+        PLATE_COUNTRY_BR, PLATE_COUNTRY_AR, PLATE_COUNTRY_PY_CAR, PLATE_COUNTRY_PY_MOTO,
+        PLATE_COUNTRY_BO, PLATE_COUNTRY_UY, PLATE_COUNTRY_NONE, PLATE_COUNTRY_NONE,
+        PLATE_COUNTRY_BR, PLATE_COUNTRY_NONE, PLATE_COUNTRY_NONE,
+    };
+    uint8_t out[ARRAY_SIZE(plates)];
+
+    BUILD_ASSERT(ARRAY_SIZE(plates) == ARRAY_SIZE(expected));
+
+    zassert_equal(validate_plates_batch(plates, ARRAY_SIZE(plates), out), 7, "Valid count");
+    zassert_mem_equal(out, expected, sizeof(expected), "Country mismatch");
+    zassert_equal(validate_plates_batch(plates, 0, out), 0, "Empty batch");
+}
+
+/**
+ * @brief The scenario builds the kernel it asks for
+ */
+ZTEST(radar_plate_batch, test_batch_kernel_selected)
+{
+#if defined(CONFIG_RADAR_PLATE_BATCH_AVX2)
+    const char *expected = "avx2";
+#elif defined(CONFIG_RADAR_PLATE_BATCH_SIMD) && defined(__SSE2__)
+    const char *expected = "sse2";
+#elif defined(CONFIG_RADAR_PLATE_BATCH_SIMD)
+    const char *expected = "swar";
+#else
+    const char *expected = "scalar";
+#endif
+
+    zassert_str_equal(validate_plates_batch_kernel(), expected, "Kernel");
+}
+
+/**
+ * @brief Test suite for batch plate validation
+ */
+ZTEST_SUITE(radar_plate_batch, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,144 @@
+#include <zephyr/ztest.h>
+#include "enforcement.h"
+#include "policy.h"
+
+#define POLICY_TEST_STACK 1024
+
+static const struct radar_policy_values policy_defaults = {
+    .limit_light_kmh = CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH,
+    .limit_heavy_kmh = CONFIG_RADAR_SPEED_LIMIT_HEAVY_KMH,
+    .warning_percent = CONFIG_RADAR_WARNING_THRESHOLD_PERCENT,
+    .distance_mm = CONFIG_RADAR_SENSOR_DISTANCE_MM,
+};
+
+K_THREAD_STACK_DEFINE(policy_test_stack, POLICY_TEST_STACK);
+static struct k_thread policy_test_thread;
+static struct radar_policy_values policy_test_next;
+
+static void policy_after(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    zassert_ok(policy_update(&policy_defaults));
+}
+
+ZTEST(radar_policy, test_kconfig_defaults)
+{
+    const struct radar_policy *policy = policy_acquire();
+
+    zassert_not_null(policy);
+    zassert_equal(policy->v.limit_light_kmh, CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH);
+    zassert_equal(policy->v.limit_heavy_kmh, CONFIG_RADAR_SPEED_LIMIT_HEAVY_KMH);
+    zassert_equal(policy->v.distance_mm, CONFIG_RADAR_SENSOR_DISTANCE_MM);
+    zassert_equal(policy_warning_kmh(policy, VEHICLE_CLASS_CAR),
+                  (CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH *
+                   CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100);
+    policy_release(policy);
+}
+
+ZTEST(radar_policy, test_update_applies_to_decision)
+{
+    struct radar_policy_values v = policy_defaults;
+    uint32_t limit;
+
+    /* Road works: light vehicles down to 40 km/h, warning at 80% */
+    v.limit_light_kmh = 40;
+    v.warning_percent = 80;
+    zassert_ok(policy_update(&v));
+
+    const struct radar_policy *policy = policy_acquire();
+    zassert_equal(policy_warning_kmh(policy, VEHICLE_CLASS_CAR), 32);
+    zassert_equal(enforcement_decide(policy, 41, VEHICLE_CLASS_CAR, &limit), STATUS_INFRACTION);
+    zassert_equal(limit, 40);
+    zassert_equal(enforcement_decide(policy, 32, VEHICLE_CLASS_CAR, &limit), STATUS_WARNING);
+    zassert_equal(enforcement_decide(policy, 31, VEHICLE_CLASS_CAR, &limit), STATUS_NORMAL);
+    /* Motorcycles take the light limit, unknown vehicles the heavy one */
+    zassert_equal(policy_limit_kmh(policy, VEHICLE_CLASS_MOTORCYCLE), 40);
+    zassert_equal(policy_limit_kmh(policy, VEHICLE_CLASS_UNKNOWN), v.limit_heavy_kmh);
+    zassert_equal(policy_limit_kmh(policy, VEHICLE_CLASS_COUNT), v.limit_heavy_kmh);
+    policy_release(policy);
+
+    struct radar_policy_values got;
+    policy_get(&got);
+    zassert_mem_equal(&got, &v, sizeof(v));
+}
+
+ZTEST(radar_policy, test_class_limit_overrides_type)
+{
+    struct radar_policy_values v = policy_defaults;
+    uint32_t limit;
+
+    /* Buses allowed faster than the other heavy vehicles */
+    v.class_limit_kmh[VEHICLE_CLASS_BUS] = 70;
+    zassert_ok(policy_update(&v));
+
+    const struct radar_policy *policy = policy_acquire();
+    zassert_equal(policy_limit_kmh(policy, VEHICLE_CLASS_BUS), 70);
+    zassert_equal(policy_warning_kmh(policy, VEHICLE_CLASS_BUS),
+                  (70U * CONFIG_RADAR_WARNING_THRESHOLD_PERCENT) / 100U);
+    zassert_equal(policy_limit_kmh(policy, VEHICLE_CLASS_TRUCK_3), v.limit_heavy_kmh);
+    zassert_equal(enforcement_decide(policy, 70, VEHICLE_CLASS_BUS, &limit), STATUS_WARNING);
+    zassert_equal(enforcement_decide(policy, 70, VEHICLE_CLASS_TRUCK_3, &limit),
+                  STATUS_INFRACTION);
+    zassert_equal(limit, v.limit_heavy_kmh);
+    policy_release(policy);
+}
+
+ZTEST(radar_policy, test_rejects_out_of_range)
+{
+    struct radar_policy_values v = policy_defaults;
+    struct radar_policy_values got;
+
+    v.limit_heavy_kmh = 0;
+    zassert_equal(policy_update(&v), -EINVAL);
+    v = policy_defaults;
+    v.warning_percent = 101;
+    zassert_equal(policy_update(&v), -EINVAL);
+    v = policy_defaults;
+    v.distance_mm = 0;
+    zassert_equal(policy_update(&v), -EINVAL);
+    v = policy_defaults;
+    v.class_limit_kmh[VEHICLE_CLASS_CAR] = 301;
+    zassert_equal(policy_update(&v), -EINVAL);
+
+    policy_get(&got);
+    zassert_mem_equal(&got, &policy_defaults, sizeof(got));
+}
+
+/**
+ * @brief Publishes policy_test_next from another thread.
+ * @param p1 Unused.
+ * @param p2 Unused.
+ * @param p3 Unused.
+ */
+static void policy_test_writer(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+    (void)policy_update(&policy_test_next);
+}
+
+ZTEST(radar_policy, test_pinned_policy_is_stable)
+{
+    const struct radar_policy *old = policy_acquire();
+
+    policy_test_next = policy_defaults;
+    policy_test_next.limit_light_kmh = 30;
+    k_thread_create(&policy_test_thread, policy_test_stack,
+                    K_THREAD_STACK_SIZEOF(policy_test_stack), policy_test_writer,
+                    NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+    k_msleep(20);
+
+    /* New readers see the new policy at once; the pinned one is untouched */
+    const struct radar_policy *cur = policy_acquire();
+    zassert_equal(cur->v.limit_light_kmh, 30);
+    policy_release(cur);
+    zassert_equal(old->v.limit_light_kmh, CONFIG_RADAR_SPEED_LIMIT_LIGHT_KMH);
+
+    /* The writer cannot reuse the old slot until it is released */
+    zassert_equal(k_thread_join(&policy_test_thread, K_NO_WAIT), -EBUSY);
+    policy_release(old);
+    zassert_ok(k_thread_join(&policy_test_thread, K_MSEC(100)));
+}
+
+ZTEST_SUITE(radar_policy, NULL, NULL, NULL, policy_after, NULL);
@@ -0,0 +1,111 @@
+#include <zephyr/ztest.h>
+#include "rrd.h"
+
+#define MIN_MS     (60 * 1000)
+#define QUARTER_MS (15 * MIN_MS)
+
+static void rrd_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    rrd_init(0);
+}
+
+ZTEST(radar_rrd, test_seconds)
+{
+    uint32_t out[8];
+    int64_t first_ms;
+
+    rrd_add(RRD_VEHICLE_LIGHT, 100, 1);
+    rrd_add(RRD_VEHICLE_LIGHT, 900, 2);
+    rrd_add(RRD_VEHICLE_HEAVY, 2500, 1);
+    rrd_add(RRD_VEHICLE_LIGHT, 3000, 5);
+
+    /* Second 3 is still open */
+    int n = rrd_query(RRD_TIER_SECOND, RRD_VEHICLE_LIGHT, 0, INT64_MAX, out, ARRAY_SIZE(out),
+                      &first_ms);
+    zassert_equal(n, 3);
+    zassert_equal(first_ms, 0);
+    zassert_equal(out[0], 3U);
+    zassert_equal(out[1], 0U);
+    zassert_equal(out[2], 0U);
+
+    n = rrd_query(RRD_TIER_SECOND, RRD_VEHICLE_HEAVY, 1, 3000, out, ARRAY_SIZE(out), &first_ms);
+    zassert_equal(n, 2);
+    zassert_equal(first_ms, 1000);
+    zassert_equal(out[1], 1U);
+
+    rrd_advance(4000);
+    n = rrd_query(RRD_TIER_SECOND, RRD_VEHICLE_LIGHT, 3000, 4000, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 1);
+    zassert_equal(out[0], 5U);
+    zassert_equal(rrd_query(RRD_TIER_COUNT, RRD_VEHICLE_LIGHT, 0, 1, out, 1, NULL), -EINVAL);
+}
+
+ZTEST(radar_rrd, test_rollup)
+{
+    uint32_t out[4];
+
+    /* 10 vehicles per minute for 30 minutes */
+    for (int64_t t = 0; t < 30 * MIN_MS; t += 6000) {
+        rrd_add(RRD_STATUS_NORMAL, t, 1);
+    }
+    rrd_advance(30 * MIN_MS);
+
+    int n = rrd_query(RRD_TIER_MINUTE, RRD_STATUS_NORMAL, 0, 3 * MIN_MS, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 3);
+    zassert_equal(out[0], 10U);
+    zassert_equal(out[2], 10U);
+
+    n = rrd_query(RRD_TIER_QUARTER, RRD_STATUS_NORMAL, 0, INT64_MAX, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 2);
+    zassert_equal(out[0], 150U);
+    zassert_equal(out[1], 150U);
+}
+
+ZTEST(radar_rrd, test_long_gap)
+{
+    uint32_t out[4];
+    int64_t later = (int64_t)(CONFIG_RADAR_RRD_SECONDS + 5) * 1000 + 2 * QUARTER_MS;
+    int64_t first_ms;
+
+    rrd_add(RRD_CAMERA_VALID, 500, 7);
+    rrd_add(RRD_CAMERA_VALID, later, 1);
+
+    /* The seconds ring forgot the first read; the coarser tiers kept it */
+    int n = rrd_query(RRD_TIER_SECOND, RRD_CAMERA_VALID, 0, 1000, out, ARRAY_SIZE(out), &first_ms);
+    zassert_equal(n, 0);
+    n = rrd_query(RRD_TIER_MINUTE, RRD_CAMERA_VALID, 0, MIN_MS, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 1);
+    zassert_equal(out[0], 7U);
+    n = rrd_query(RRD_TIER_QUARTER, RRD_CAMERA_VALID, 0, INT64_MAX, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 2);
+    zassert_equal(out[0], 7U);
+    zassert_equal(out[1], 0U, "skipped quarter is empty");
+
+    /* Skipped seconds read as zero */
+    n = rrd_query(RRD_TIER_SECOND, RRD_CAMERA_VALID, later - 3000, later, out, ARRAY_SIZE(out),
+                  NULL);
+    zassert_equal(n, 3);
+    zassert_equal(out[0] + out[1] + out[2], 0U);
+}
+
+ZTEST(radar_rrd, test_skipped_slot_reused)
+{
+    uint32_t out[2];
+    int64_t lap_ms = (int64_t)CONFIG_RADAR_RRD_SECONDS * 1000;
+
+    /* Second 0 and the second one lap later share a slot */
+    rrd_add(RRD_VEHICLE_HEAVY, 500, 4);
+    rrd_add(RRD_VEHICLE_HEAVY, 1500, 2);
+    rrd_add(RRD_VEHICLE_HEAVY, lap_ms + 1500, 1);
+
+    int n = rrd_query(RRD_TIER_SECOND, RRD_VEHICLE_HEAVY, lap_ms, lap_ms + 1000, out,
+                      ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 1);
+    zassert_equal(out[0], 0U, "skipped second shows the lap before");
+    n = rrd_query(RRD_TIER_SECOND, RRD_VEHICLE_HEAVY, 1000, 2000, out, ARRAY_SIZE(out), NULL);
+    zassert_equal(n, 1);
+    zassert_equal(out[0], 2U);
+}
+
+ZTEST_SUITE(radar_rrd, NULL, NULL, rrd_before, NULL, NULL);
@@ -0,0 +1,152 @@
+#include <zephyr/ztest.h>
+#include "common.h"
+#include "section.h"
+
+#define SECTION_TEST_MAX_TRAVEL_MS ((int64_t)CONFIG_RADAR_SECTION_MAX_TRAVEL_S * 1000)
+#define SECTION_TEST_T0 1000000
+
+/**
+ * @brief Builds a distinct BR plate from an index ("AAA0A00" upward).
+ */
+static plate_id_t section_plate(uint32_t i)
+{
+    char text[PLATE_TEXT_SIZE] = {
+        (char)('A' + (i / 26000U) % 26U), (char)('A' + (i / 1000U) % 26U),
+        (char)('A' + (i / 100U) % 10U),   (char)('0' + (i / 10U) % 10U),
+        (char)('A' + i % 10U),            '0',
+        (char)('0' + (i / 676000U) % 10U), '\0',
+    };
+    return plate_id_from_str(text);
+}
+
+static void section_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    section_init();
+}
+
+ZTEST(radar_section, test_match_and_average)
+{
+    plate_id_t plate = plate_id_from_str("ABC1D23");
+    int64_t entry_ms = 0;
+
+    zassert_ok(section_entry(plate, SECTION_TEST_T0));
+    zassert_equal(section_in_flight(), 1U);
+
+    /* 2000 m in 72 s is 100 km/h */
+    zassert_ok(section_exit(plate, SECTION_TEST_T0 + 72000, &entry_ms));
+    zassert_equal(entry_ms, SECTION_TEST_T0);
+    zassert_equal(section_average_kmh(entry_ms, SECTION_TEST_T0 + 72000),
+                  (uint32_t)CONFIG_RADAR_SECTION_LENGTH_M * 36U / 720U);
+    zassert_equal(section_in_flight(), 0U);
+
+    /* A second exit read finds nothing */
+    zassert_equal(section_exit(plate, SECTION_TEST_T0 + 73000, &entry_ms), -ENOENT);
+    zassert_equal(section_average_kmh(SECTION_TEST_T0, SECTION_TEST_T0), 0U);
+}
+
+ZTEST(radar_section, test_reentry_and_invalid)
+{
+    plate_id_t plate = plate_id_from_str("ABC1D23");
+    int64_t entry_ms = 0;
+
+    zassert_equal(section_entry(PLATE_ID_NONE, SECTION_TEST_T0), -EINVAL);
+    zassert_equal(section_exit(PLATE_ID_NONE, SECTION_TEST_T0, &entry_ms), -ENOENT);
+
+    /* The newest entry read wins */
+    zassert_ok(section_entry(plate, SECTION_TEST_T0));
+    zassert_ok(section_entry(plate, SECTION_TEST_T0 + 5000));
+    zassert_equal(section_in_flight(), 1U);
+    zassert_ok(section_exit(plate, SECTION_TEST_T0 + 60000, &entry_ms));
+    zassert_equal(entry_ms, SECTION_TEST_T0 + 5000);
+}
+
+ZTEST(radar_section, test_exit_time_checked)
+{
+    plate_id_t plate = plate_id_from_str("ABC1D23");
+    int64_t entry_ms = 0;
+
+    /* An exit read from before the entry leaves the entry in flight */
+    zassert_ok(section_entry(plate, SECTION_TEST_T0));
+    zassert_equal(section_exit(plate, SECTION_TEST_T0 - 1, &entry_ms), -ENOENT);
+    zassert_equal(section_in_flight(), 1U);
+
+    /* The maximum travel time is inclusive */
+    zassert_ok(section_exit(plate, SECTION_TEST_T0 + SECTION_TEST_MAX_TRAVEL_MS, &entry_ms));
+    zassert_equal(entry_ms, SECTION_TEST_T0);
+
+    /* Past it, the unswept entry read is refused and dropped */
+    entry_ms = 0;
+    zassert_ok(section_entry(plate, SECTION_TEST_T0));
+    zassert_equal(section_exit(plate, SECTION_TEST_T0 + SECTION_TEST_MAX_TRAVEL_MS + 1,
+                               &entry_ms), -ETIMEDOUT);
+    zassert_equal(entry_ms, 0);
+    zassert_equal(section_in_flight(), 0U);
+}
+
+ZTEST(radar_section, test_expiry)
+{
+    const uint32_t n = 16U; /* The smallest capacity allowed */
+    int64_t entry_ms;
+
+    /* One read per second: they expire in the order they entered */
+    for (uint32_t i = 0; i < n; i++) {
+        zassert_ok(section_entry(section_plate(i), SECTION_TEST_T0 + i * 1000));
+    }
+    zassert_equal(section_expire(SECTION_TEST_T0 + SECTION_TEST_MAX_TRAVEL_MS - 1), 0U);
+
+    size_t dropped = section_expire(SECTION_TEST_T0 + SECTION_TEST_MAX_TRAVEL_MS + 9999);
+    zassert_equal(dropped, 10U, "dropped %u", (unsigned int)dropped);
+    zassert_equal(section_in_flight(), n - 10U);
+    zassert_equal(section_exit(section_plate(9), SECTION_TEST_T0 + 20000, &entry_ms), -ENOENT);
+    zassert_ok(section_exit(section_plate(10), SECTION_TEST_T0 + 20000, &entry_ms));
+
+    /* Reads older than the sweep are refused */
+    zassert_equal(section_entry(section_plate(0), SECTION_TEST_T0), -ETIMEDOUT);
+
+    /* A long pause sweeps everything in one lap */
+    dropped = section_expire(SECTION_TEST_T0 + 100 * SECTION_TEST_MAX_TRAVEL_MS);
+    zassert_equal(dropped, n - 11U);
+    zassert_equal(section_in_flight(), 0U);
+}
+
+ZTEST(radar_section, test_expire_early_in_uptime)
+{
+    int64_t entry_ms;
+
+    /* The first sweep, less than one maximum travel time after boot */
+    zassert_ok(section_entry(section_plate(1), 500));
+    zassert_equal(section_expire(1000), 0U);
+    zassert_equal(section_in_flight(), 1U);
+
+    zassert_equal(section_expire(500 + SECTION_TEST_MAX_TRAVEL_MS), 1U);
+    zassert_equal(section_exit(section_plate(1), 2000, &entry_ms), -ENOENT);
+}
+
+ZTEST(radar_section, test_capacity_and_deletes)
+{
+    const uint32_t cap = CONFIG_RADAR_SECTION_CAPACITY;
+    int64_t entry_ms;
+
+    for (uint32_t i = 0; i < cap; i++) {
+        zassert_ok(section_entry(section_plate(i), SECTION_TEST_T0 + i), "entry %u", i);
+    }
+    zassert_equal(section_entry(section_plate(cap), SECTION_TEST_T0), -ENOSPC);
+
+    /* Deleting every other plate must keep the rest reachable */
+    for (uint32_t i = 0; i < cap; i += 2U) {
+        zassert_ok(section_exit(section_plate(i), SECTION_TEST_T0 + cap, &entry_ms), "exit %u", i);
+    }
+    for (uint32_t i = 0; i < cap; i++) {
+        int ret = section_exit(section_plate(i), SECTION_TEST_T0 + cap, &entry_ms);
+
+        zassert_equal(ret, (i % 2U) ? 0 : -ENOENT, "plate %u", i);
+        if (ret == 0) {
+            zassert_equal(entry_ms, SECTION_TEST_T0 + i);
+        }
+    }
+    zassert_equal(section_in_flight(), 0U);
+    zassert_ok(section_entry(section_plate(cap), SECTION_TEST_T0));
+}
+
+ZTEST_SUITE(radar_section, NULL, NULL, section_before, NULL, NULL);
@@ -0,0 +1,89 @@
+#include <zephyr/ztest.h>
+#include <string.h>
+#include "sha256.h"
+
+/**
+ * @brief Hashes a string and compares the digest with its hex form.
+ */
+static void check_digest(const uint8_t digest[SHA256_DIGEST_SIZE], const char *hex)
+{
+    char out[2U * SHA256_DIGEST_SIZE + 1U];
+
+    for (size_t i = 0; i < SHA256_DIGEST_SIZE; i++) {
+        snprintk(out + 2U * i, 3, "%02x", digest[i]);
+    }
+    zassert_str_equal(out, hex, "digest mismatch (kernel %s)", sha256_kernel());
+}
+
+ZTEST(radar_sha256, test_known_vectors)
+{
+    static const struct {
+        const char *msg;
+        const char *hex;
+    } vectors[] = {
+        {"", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+        {"abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+        {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+         "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+        /* Camera capture: the hash covers the plate text as delivered */
+        {"EGG3D02", "0d6b4d62516fe9eeb9ce56c57a6559e21e02436d542af9aef03f322d32d408ed"},
+    };
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    for (size_t i = 0; i < ARRAY_SIZE(vectors); i++) {
+        sha256(vectors[i].msg, strlen(vectors[i].msg), digest);
+        check_digest(digest, vectors[i].hex);
+    }
+}
+
+ZTEST(radar_sha256, test_streaming_million_a)
+{
+    static const uint8_t chunk[125] = {[0 ... 124] = 'a'};
+    struct sha256_ctx ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    /* 125-byte chunks straddle block boundaries at every offset */
+    sha256_init(&ctx);
+    for (int i = 0; i < 8000; i++) {
+        sha256_update(&ctx, chunk, sizeof(chunk));
+    }
+    sha256_final(&ctx, digest);
+    check_digest(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+ZTEST(radar_sha256, test_padding_boundaries)
+{
+    static uint8_t buf[130];
+    uint8_t one_shot[SHA256_DIGEST_SIZE];
+    uint8_t split[SHA256_DIGEST_SIZE];
+
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = (uint8_t)(i * 131U + 7U);
+    }
+
+    /* Lengths around 55/56/64 bytes exercise the one- and two-block padding */
+    for (size_t len = 0; len <= sizeof(buf); len++) {
+        struct sha256_ctx ctx;
+
+        sha256(buf, len, one_shot);
+        sha256_init(&ctx);
+        sha256_update(&ctx, buf, len / 3U);
+        sha256_update(&ctx, buf + len / 3U, len - len / 3U);
+        sha256_final(&ctx, split);
+        zassert_mem_equal(one_shot, split, SHA256_DIGEST_SIZE, "len %u", (unsigned int)len);
+    }
+}
+
+ZTEST(radar_sha256, test_verify)
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    sha256("ABC1D23", 7, digest);
+    zassert_true(sha256_verify("ABC1D23", 7, digest));
+    zassert_false(sha256_verify("ABC1D24", 7, digest));
+
+    digest[SHA256_DIGEST_SIZE - 1U] ^= 1U;
+    zassert_false(sha256_verify("ABC1D23", 7, digest));
+}
+
+ZTEST_SUITE(radar_sha256, NULL, NULL, NULL, NULL, NULL);
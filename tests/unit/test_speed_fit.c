@@ -0,0 +1,223 @@
+#include <zephyr/ztest.h>
+#include <math.h>
+#include "speed_fit.h"
+
+static struct speed_fit_model sf_model;
+
+/* Four loops over 5 m, unevenly spaced */
+static const uint32_t sf_loops4[] = { 0, 1500, 3000, 5000 };
+
+/**
+ * @brief Crossing times of a vehicle under constant acceleration.
+ * @param pos Loop positions in mm.
+ * @param loops Number of loops.
+ * @param kmh Speed over the first loop.
+ * @param accel Acceleration in m/s^2.
+ * @param t0 Time of the first crossing, in us.
+ * @param t Receives the crossing times.
+ */
+static void sf_times(const uint32_t *pos, size_t loops, double kmh, double accel,
+                     uint32_t t0, uint32_t *t)
+{
+    double v0 = kmh / 3.6;
+
+    for (size_t i = 0; i < loops; i++) {
+        double x = pos[i] / 1000.0;
+        double s = (accel == 0.0) ? x / v0 : (sqrt(v0 * v0 + 2.0 * accel * x) - v0) / accel;
+
+        t[i] = t0 + (uint32_t)lround(s * 1e6);
+    }
+}
+
+/**
+ * @brief Speed of the same vehicle at a position, in 0.01 km/h.
+ */
+static uint32_t sf_speed_at(double kmh, double accel, double x_mm)
+{
+    double v0 = kmh / 3.6;
+
+    return (uint32_t)lround(sqrt(v0 * v0 + 2.0 * accel * x_mm / 1000.0) * 360.0);
+}
+
+ZTEST(radar_speed_fit, test_constant_speed)
+{
+    static const double speeds[] = { 10.0, 42.0, 80.0, 140.0, 250.0 };
+    uint32_t t[ARRAY_SIZE(sf_loops4)];
+    struct speed_fit fit;
+
+    zassert_ok(speed_fit_model_init(&sf_model, sf_loops4, ARRAY_SIZE(sf_loops4)));
+    for (size_t i = 0; i < ARRAY_SIZE(speeds); i++) {
+        sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), speeds[i], 0.0, 1000, t);
+        zassert_ok(speed_fit_run(&sf_model, t, &fit), "%d km/h", (int)speeds[i]);
+        zassert_within(fit.speed_ckmh, (uint32_t)(speeds[i] * 100.0), 5,
+                       "%d km/h: %u", (int)speeds[i], fit.speed_ckmh);
+        /* 1 us rounding of the times bounds what can be told from rest */
+        zassert_within(fit.accel_mm_s2, 0, 60, "%d km/h: %d mm/s^2", (int)speeds[i],
+                       fit.accel_mm_s2);
+        zassert_true(fit.max_residual_us <= 1U);
+        zassert_true(fit.confidence >= 99U);
+    }
+}
+
+ZTEST(radar_speed_fit, test_acceleration)
+{
+    /* Pulling away, and braking hard */
+    static const struct {
+        double kmh;
+        double accel;
+    } cases[] = { { 30.0, 2.5 }, { 70.0, 1.0 }, { 90.0, -6.0 }, { 50.0, -8.0 } };
+    uint32_t t[ARRAY_SIZE(sf_loops4)];
+    struct speed_fit fit;
+
+    zassert_ok(speed_fit_model_init(&sf_model, sf_loops4, ARRAY_SIZE(sf_loops4)));
+    for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+        sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), cases[i].kmh, cases[i].accel, 5000, t);
+        zassert_ok(speed_fit_run(&sf_model, t, &fit), "case %zu", i);
+        /* The speed at the centroid, 2375 mm in; the quadratic leaves out
+         * higher-order terms, which show at low speed and hard braking
+         */
+        zassert_within(fit.speed_ckmh, sf_speed_at(cases[i].kmh, cases[i].accel, 2375.0), 50,
+                       "case %zu: %u", i, fit.speed_ckmh);
+        zassert_within(fit.accel_mm_s2, (int32_t)(cases[i].accel * 1000.0),
+                       (int32_t)(fabs(cases[i].accel) * 50.0) + 60,
+                       "case %zu: %d mm/s^2", i, fit.accel_mm_s2);
+    }
+}
+
+ZTEST(radar_speed_fit, test_three_loops_exact)
+{
+    static const uint32_t loops3[] = { 0, 2000, 5000 };
+    uint32_t t[ARRAY_SIZE(loops3)];
+    struct speed_fit fit;
+
+    zassert_ok(speed_fit_model_init(&sf_model, loops3, ARRAY_SIZE(loops3)));
+    sf_times(loops3, ARRAY_SIZE(loops3), 60.0, 2.0, 0, t);
+    zassert_ok(speed_fit_run(&sf_model, t, &fit));
+    zassert_within(fit.accel_mm_s2, 2000, 100, "%d mm/s^2", fit.accel_mm_s2);
+    /* No redundancy: nothing to check the readings against */
+    zassert_equal(fit.rms_us, 0);
+    zassert_equal(fit.confidence, 0);
+}
+
+ZTEST(radar_speed_fit, test_inconsistent_loop_rejected)
+{
+    static const uint32_t loops8[] = { 0, 700, 1400, 2100, 2800, 3500, 4200, 4900 };
+    uint32_t t[ARRAY_SIZE(loops8)];
+    struct speed_fit fit = { .speed_ckmh = 12345 };
+
+    zassert_ok(speed_fit_model_init(&sf_model, loops8, ARRAY_SIZE(loops8)));
+    sf_times(loops8, ARRAY_SIZE(loops8), 100.0, 0.0, 0, t);
+
+    /* Jitter within the residual limit lowers the confidence only */
+    t[3] += CONFIG_RADAR_SPEED_FIT_MAX_RESIDUAL_US / 4U;
+    zassert_ok(speed_fit_run(&sf_model, t, &fit));
+    zassert_true(fit.confidence < 99U, "confidence %u", fit.confidence);
+    zassert_true(fit.max_residual_us > 0U);
+
+    /* A late loop, e.g. triggered by the trailer of the vehicle ahead */
+    t[3] += 4U * CONFIG_RADAR_SPEED_FIT_MAX_RESIDUAL_US;
+    fit.speed_ckmh = 12345;
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -ERANGE);
+    zassert_equal(fit.speed_ckmh, 12345, "output written on error");
+}
+
+ZTEST(radar_speed_fit, test_implausible_rejected)
+{
+    uint32_t t[ARRAY_SIZE(sf_loops4)];
+    struct speed_fit fit;
+
+    zassert_ok(speed_fit_model_init(&sf_model, sf_loops4, ARRAY_SIZE(sf_loops4)));
+
+    /* Faster than any vehicle */
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), SPEED_FIT_MAX_KMH + 20.0, 0.0, 0, t);
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -ERANGE);
+
+    /* Twice the deceleration a vehicle can reach */
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), 90.0,
+             -2.0 * CONFIG_RADAR_SPEED_FIT_MAX_ACCEL_MM_S2 / 1000.0, 0, t);
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -ERANGE);
+
+    /* Loops crossed out of order */
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), 60.0, 0.0, 0, t);
+    t[2] = t[1];
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -EINVAL);
+    t[2] = t[1] - 1U;
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -EINVAL);
+
+    /* Crossing the array slower than SPEED_FIT_MAX_SPAN_US */
+    t[0] = 0;
+    t[1] = 1000;
+    t[2] = 2000;
+    t[3] = SPEED_FIT_MAX_SPAN_US;
+    zassert_equal(speed_fit_run(&sf_model, t, &fit), -EINVAL);
+}
+
+ZTEST(radar_speed_fit, test_times_wrap)
+{
+    uint32_t t[ARRAY_SIZE(sf_loops4)];
+    uint32_t t_wrapped[ARRAY_SIZE(sf_loops4)];
+    struct speed_fit fit;
+    struct speed_fit fit_wrapped;
+
+    zassert_ok(speed_fit_model_init(&sf_model, sf_loops4, ARRAY_SIZE(sf_loops4)));
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), 72.0, 1.5, 0, t);
+    for (size_t i = 0; i < ARRAY_SIZE(t); i++) {
+        t_wrapped[i] = t[i] + (UINT32_MAX - 100000U);
+    }
+    zassert_ok(speed_fit_run(&sf_model, t, &fit));
+    zassert_ok(speed_fit_run(&sf_model, t_wrapped, &fit_wrapped));
+    zassert_equal(fit.speed_ckmh, fit_wrapped.speed_ckmh);
+    zassert_equal(fit.accel_mm_s2, fit_wrapped.accel_mm_s2);
+    zassert_equal(fit.max_residual_us, fit_wrapped.max_residual_us);
+}
+
+ZTEST(radar_speed_fit, test_cycle_timestamps)
+{
+    uint32_t t[ARRAY_SIZE(sf_loops4)];
+    uint32_t cyc[ARRAY_SIZE(sf_loops4)];
+    uint32_t t_cyc[ARRAY_SIZE(sf_loops4)];
+    struct speed_fit fit;
+
+    zassert_ok(speed_fit_model_init(&sf_model, sf_loops4, ARRAY_SIZE(sf_loops4)));
+
+    /* Crossings timed on the cycle counter as it wraps */
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), 96.0, -2.0, 0, t);
+    for (size_t i = 0; i < ARRAY_SIZE(t); i++) {
+        cyc[i] = (UINT32_MAX - 1000U) + (uint32_t)k_us_to_cyc_ceil64(t[i]);
+    }
+    speed_fit_cycles_to_us(cyc, ARRAY_SIZE(cyc), t_cyc);
+    for (size_t i = 0; i < ARRAY_SIZE(t); i++) {
+        zassert_within(t_cyc[i], t[i], 1, "loop %u: %u us", (unsigned int)i, t_cyc[i]);
+    }
+
+    /* The counter of this board, as the ISRs read it: 140 km/h, 4 m/s^2 */
+    sf_times(sf_loops4, ARRAY_SIZE(sf_loops4), 140.0, 4.0, 0, t);
+    cyc[0] = k_cycle_get_32();
+    for (size_t i = 1; i < ARRAY_SIZE(t); i++) {
+        k_busy_wait(t[i] - t[i - 1U]);
+        cyc[i] = k_cycle_get_32();
+    }
+    speed_fit_cycles_to_us(cyc, ARRAY_SIZE(cyc), t_cyc);
+    zassert_ok(speed_fit_run(&sf_model, t_cyc, &fit), "times %u %u %u us", t_cyc[1],
+               t_cyc[2], t_cyc[3]);
+    zassert_within(fit.speed_ckmh, sf_speed_at(140.0, 4.0, 2375.0), 100, "%u", fit.speed_ckmh);
+}
+
+ZTEST(radar_speed_fit, test_model_rejects_bad_arrays)
+{
+    static const uint32_t two[] = { 0, 5000 };
+    static const uint32_t repeated[] = { 0, 2000, 2000, 5000 };
+    static const uint32_t too_far[] = { 0, 2000, SPEED_FIT_MAX_POSITION_MM + 1U };
+    uint32_t many[SPEED_FIT_MAX_LOOPS + 1];
+
+    for (size_t i = 0; i < ARRAY_SIZE(many); i++) {
+        many[i] = 100U * i;
+    }
+    zassert_equal(speed_fit_model_init(&sf_model, two, ARRAY_SIZE(two)), -EINVAL);
+    zassert_equal(speed_fit_model_init(&sf_model, repeated, ARRAY_SIZE(repeated)), -EINVAL);
+    zassert_equal(speed_fit_model_init(&sf_model, too_far, ARRAY_SIZE(too_far)), -EINVAL);
+    zassert_equal(speed_fit_model_init(&sf_model, many, ARRAY_SIZE(many)), -EINVAL);
+    zassert_ok(speed_fit_model_init(&sf_model, many, SPEED_FIT_MAX_LOOPS));
+}
+
+ZTEST_SUITE(radar_speed_fit, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,137 @@
+#include <zephyr/ztest.h>
+#include <stdlib.h>
+#include "speed_stats.h"
+
+#define STATS_INTERVAL_MS ((int64_t)CONFIG_RADAR_SPEED_STATS_INTERVAL_S * 1000)
+#define STATS_T0 5000
+
+static void stats_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    speed_stats_init(STATS_T0);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+ZTEST(radar_speed_stats, test_mean_variance_histogram)
+{
+    struct speed_stats_summary sum;
+
+    zassert_ok(speed_stats_add(0, 40, STATS_T0));
+    zassert_ok(speed_stats_add(0, 50, STATS_T0));
+    zassert_ok(speed_stats_add(0, 60, STATS_T0));
+    zassert_ok(speed_stats_add(0, 400, STATS_T0));
+    zassert_equal(speed_stats_add(CONFIG_RADAR_LANE_COUNT, 50, STATS_T0), -EINVAL);
+
+    zassert_ok(speed_stats_current(0, &sum));
+    zassert_equal(sum.count, 4U);
+    zassert_equal(sum.min_kmh, 40U);
+    zassert_equal(sum.max_kmh, 400U);
+    zassert_within(sum.mean_kmh, 137.5f, 0.01f);
+    /* Sample standard deviation of {40, 50, 60, 400} */
+    zassert_within(sum.stddev_kmh, 175.188f, 0.01f);
+    zassert_equal(sum.hist[4], 1U);
+    zassert_equal(sum.hist[5], 1U);
+    zassert_equal(sum.hist[6], 1U);
+    zassert_equal(sum.hist[SPEED_STATS_BUCKETS - 1U], 1U, "overflow bucket");
+
+    /* Fewer than five samples: exact nearest rank */
+    zassert_within(sum.p85_kmh, 400.0f, 0.01f);
+}
+
+ZTEST(radar_speed_stats, test_p85_accuracy)
+{
+    static uint32_t speeds[2000];
+    uint32_t seed = 12345U;
+    struct speed_stats_summary sum;
+
+    /* Two overlapping speed populations, like light and heavy traffic */
+    for (size_t i = 0; i < ARRAY_SIZE(speeds); i++) {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t r = (seed >> 8) % 40U;
+        speeds[i] = (i % 3U == 0U) ? 30U + r : 45U + r;
+        zassert_ok(speed_stats_add(1 % CONFIG_RADAR_LANE_COUNT, speeds[i], STATS_T0));
+    }
+
+    qsort(speeds, ARRAY_SIZE(speeds), sizeof(speeds[0]), cmp_u32);
+    float exact = (float)speeds[(ARRAY_SIZE(speeds) * 85U) / 100U - 1U];
+
+    zassert_ok(speed_stats_current(1 % CONFIG_RADAR_LANE_COUNT, &sum));
+    zassert_within(sum.p85_kmh, exact, 2.0f, "p85 %d vs %d", (int)sum.p85_kmh, (int)exact);
+}
+
+ZTEST(radar_speed_stats, test_rollover_and_query)
+{
+    struct speed_stats_summary out[4];
+    struct speed_stats_summary sum;
+
+    zassert_ok(speed_stats_add(0, 50, STATS_T0 + 1));
+    zassert_ok(speed_stats_add(0, 70, STATS_T0 + 2));
+    /* Lands in the third interval and closes the first two */
+    zassert_ok(speed_stats_add(0, 90, STATS_T0 + 2 * STATS_INTERVAL_MS));
+
+    zassert_ok(speed_stats_current(0, &sum));
+    zassert_equal(sum.count, 1U);
+    zassert_equal(sum.start_ms, STATS_T0 + 2 * STATS_INTERVAL_MS);
+
+    size_t n = speed_stats_query(0, 0, INT64_MAX, out, ARRAY_SIZE(out));
+    zassert_equal(n, 2U);
+    zassert_equal(out[0].start_ms, STATS_T0);
+    zassert_equal(out[0].count, 2U);
+    zassert_within(out[0].mean_kmh, 60.0f, 0.01f);
+    zassert_equal(out[1].count, 0U, "empty intervals are kept");
+
+    /* Only intervals starting inside the range */
+    n = speed_stats_query(0, STATS_T0 + 1, INT64_MAX, out, ARRAY_SIZE(out));
+    zassert_equal(n, 1U);
+    zassert_equal(out[0].start_ms, STATS_T0 + STATS_INTERVAL_MS);
+    zassert_equal(speed_stats_query(0, STATS_T0, STATS_T0, out, ARRAY_SIZE(out)), 0U);
+}
+
+ZTEST(radar_speed_stats, test_long_gap_keeps_recent_history)
+{
+    struct speed_stats_summary out[2];
+    int64_t later = STATS_T0 + (int64_t)(CONFIG_RADAR_SPEED_STATS_HISTORY + 10) * STATS_INTERVAL_MS;
+
+    zassert_ok(speed_stats_add(0, 50, STATS_T0));
+    speed_stats_advance(later);
+
+    /* The busy interval fell out of the ring; the newest ones remain */
+    zassert_equal(speed_stats_query(0, STATS_T0, STATS_T0 + 1, out, ARRAY_SIZE(out)), 0U);
+    size_t n = speed_stats_query(0, later - STATS_INTERVAL_MS, INT64_MAX, out, ARRAY_SIZE(out));
+    zassert_equal(n, 1U);
+    zassert_equal(out[0].start_ms, later - STATS_INTERVAL_MS);
+}
+
+ZTEST(radar_speed_stats, test_skipped_rows_read_empty)
+{
+    struct speed_stats_summary out[2];
+    int64_t lap_ms = (int64_t)CONFIG_RADAR_SPEED_STATS_HISTORY * STATS_INTERVAL_MS;
+
+    /* Intervals one lap later reuse these rows without traffic of their own */
+    zassert_ok(speed_stats_add(1, 50, STATS_T0));
+    zassert_ok(speed_stats_add(1, 70, STATS_T0 + STATS_INTERVAL_MS));
+    zassert_ok(speed_stats_add(1, 90, STATS_T0 + lap_ms + 2 * STATS_INTERVAL_MS));
+    speed_stats_advance(STATS_T0 + lap_ms + 3 * STATS_INTERVAL_MS);
+
+    size_t n = speed_stats_query(1, STATS_T0 + lap_ms, STATS_T0 + lap_ms + 2 * STATS_INTERVAL_MS,
+                                 out, ARRAY_SIZE(out));
+    zassert_equal(n, 2U);
+    for (size_t i = 0; i < n; i++) {
+        zassert_equal(out[i].start_ms, STATS_T0 + lap_ms + (int64_t)i * STATS_INTERVAL_MS);
+        zassert_equal(out[i].lane, 1U);
+        zassert_equal(out[i].count, 0U, "interval %u shows the lap before", (unsigned int)i);
+    }
+    n = speed_stats_query(1, STATS_T0 + lap_ms + 2 * STATS_INTERVAL_MS, INT64_MAX, out,
+                          ARRAY_SIZE(out));
+    zassert_equal(n, 1U);
+    zassert_equal(out[0].max_kmh, 90U);
+}
+
+ZTEST_SUITE(radar_speed_stats, NULL, NULL, stats_before, NULL, NULL);
@@ -0,0 +1,103 @@
+#include <zephyr/ztest.h>
+#include "timer_wheel.h"
+
+#define TW_ENTRIES 4
+
+static struct timer_wheel tw_wheel;
+static struct timer_wheel_entry tw_entries[TW_ENTRIES];
+/* Tick at which each entry expired, 0 if it did not */
+static uint32_t tw_expired_at[TW_ENTRIES];
+
+/**
+ * @brief Records the expiry of a test entry.
+ */
+static void tw_expire(struct timer_wheel_entry *entry, void *arg)
+{
+    ARG_UNUSED(arg);
+    tw_expired_at[entry - tw_entries] = tw_wheel.now;
+}
+
+/**
+ * @brief Advances the test wheel.
+ * @param ticks Ticks to advance.
+ */
+static void tw_advance(uint32_t ticks)
+{
+    for (uint32_t i = 0; i < ticks; i++) {
+        (void)timer_wheel_tick(&tw_wheel, tw_expire, NULL);
+    }
+}
+
+static void tw_before(void *fixture)
+{
+    ARG_UNUSED(fixture);
+    timer_wheel_init(&tw_wheel);
+    for (size_t i = 0; i < TW_ENTRIES; i++) {
+        timer_wheel_entry_init(&tw_entries[i]);
+        tw_expired_at[i] = 0;
+    }
+}
+
+ZTEST(radar_timer_wheel, test_expires_on_its_tick)
+{
+    timer_wheel_schedule(&tw_wheel, &tw_entries[0], 3);
+    timer_wheel_schedule(&tw_wheel, &tw_entries[1], 0);
+    zassert_equal(tw_wheel.pending, 2);
+
+    tw_advance(1);
+    zassert_equal(tw_expired_at[1], 1, "0 ticks expires on the next tick");
+    zassert_false(timer_wheel_is_pending(&tw_entries[1]));
+    zassert_equal(tw_expired_at[0], 0);
+
+    tw_advance(2);
+    zassert_equal(tw_expired_at[0], 3);
+    zassert_equal(tw_wheel.pending, 0);
+}
+
+ZTEST(radar_timer_wheel, test_refresh_and_cancel)
+{
+    timer_wheel_schedule(&tw_wheel, &tw_entries[0], 5);
+    timer_wheel_schedule(&tw_wheel, &tw_entries[1], 5);
+    tw_advance(4);
+
+    /* A refresh moves the deadline without adding an entry */
+    timer_wheel_schedule(&tw_wheel, &tw_entries[0], 5);
+    zassert_equal(tw_wheel.pending, 2);
+    timer_wheel_cancel(&tw_wheel, &tw_entries[1]);
+    timer_wheel_cancel(&tw_wheel, &tw_entries[1]);
+    zassert_equal(tw_wheel.pending, 1);
+
+    tw_advance(5);
+    zassert_equal(tw_expired_at[0], 9);
+    zassert_equal(tw_expired_at[1], 0, "cancelled entry expired");
+}
+
+ZTEST(radar_timer_wheel, test_deadlines_past_one_turn)
+{
+    /* Same slot, different turns of the wheel */
+    timer_wheel_schedule(&tw_wheel, &tw_entries[0], 2);
+    timer_wheel_schedule(&tw_wheel, &tw_entries[1], 2 + TIMER_WHEEL_SLOTS);
+    timer_wheel_schedule(&tw_wheel, &tw_entries[2], 2 + 3 * TIMER_WHEEL_SLOTS);
+
+    tw_advance(2);
+    zassert_equal(tw_expired_at[0], 2);
+    zassert_true(timer_wheel_is_pending(&tw_entries[1]));
+    tw_advance(TIMER_WHEEL_SLOTS);
+    zassert_equal(tw_expired_at[1], 2 + TIMER_WHEEL_SLOTS);
+    tw_advance(2 * TIMER_WHEEL_SLOTS);
+    zassert_equal(tw_expired_at[2], 2 + 3 * TIMER_WHEEL_SLOTS);
+}
+
+ZTEST(radar_timer_wheel, test_tick_counter_wraps)
+{
+    tw_wheel.now = UINT32_MAX - 1U;
+    timer_wheel_schedule(&tw_wheel, &tw_entries[0], 4);
+
+    tw_advance(3);
+    zassert_true(timer_wheel_is_pending(&tw_entries[0]), "expired early across the wrap");
+    tw_advance(1);
+    zassert_false(timer_wheel_is_pending(&tw_entries[0]));
+    zassert_equal(tw_expired_at[0], 2);
+}
+
+ZTEST_SUITE(radar_timer_wheel, NULL, NULL, tw_before, NULL, NULL);
@@ -0,0 +1,195 @@
+#include <zephyr/ztest.h>
+#include "wim.h"
+#include "wim_synth.h"
+#include "block_ring.h"
+
+#define WIM_T_SAMPLE_US 200U
+#define WIM_T_BASELINE 200U
+#define WIM_T_LEAD 100U
+#define WIM_T_MAX_SAMPLES 40000U
+
+static uint16_t wim_t_buf[WIM_T_MAX_SAMPLES];
+
+/* > Axles weighed by wim_t_collect() */
+struct wim_t_seen {
+    uint32_t speed_mm_s;
+    uint16_t kg[WIM_SYNTH_MAX_AXLES];
+    uint64_t end[WIM_SYNTH_MAX_AXLES];
+    uint32_t count;
+};
+
+/**
+ * @brief Detector callback: weighs the axle.
+ */
+static void wim_t_collect(const struct wim_axle *axle, void *arg)
+{
+    struct wim_t_seen *seen = arg;
+
+    if (seen->count < ARRAY_SIZE(seen->kg)) {
+        seen->kg[seen->count] = wim_axle_kg(axle, WIM_T_SAMPLE_US, seen->speed_mm_s,
+                                            WIM_SYNTH_G_PER_COUNT_MM);
+        seen->end[seen->count] = axle->end_sample;
+    }
+    seen->count++;
+}
+
+/**
+ * @brief Samples one vehicle crossing the strip, idle before and after.
+ * @return The number of samples written to wim_t_buf.
+ */
+static size_t wim_t_vehicle(const struct wim_synth_vehicle *v, uint32_t speed_mm_s)
+{
+    size_t n = WIM_T_LEAD + wim_synth_span(v, speed_mm_s, WIM_T_SAMPLE_US) +
+               2U * CONFIG_RADAR_WIM_HOLD_SAMPLES;
+
+    zassert_true(n <= WIM_T_MAX_SAMPLES);
+    wim_synth_samples(v, speed_mm_s, WIM_T_SAMPLE_US, WIM_T_BASELINE, WIM_T_LEAD, wim_t_buf, n);
+    return n;
+}
+
+/**
+ * @brief Feeds samples in blocks and weighs the axles seen.
+ */
+static void wim_t_feed(const uint16_t *samples, size_t n, size_t block, size_t stride,
+                       uint32_t speed_mm_s, struct wim_t_seen *seen)
+{
+    struct wim_detector det;
+
+    wim_init(&det, CONFIG_RADAR_WIM_ON_COUNTS, CONFIG_RADAR_WIM_HOLD_SAMPLES);
+    *seen = (struct wim_t_seen){ .speed_mm_s = speed_mm_s };
+    for (size_t i = 0; i < n; i += block) {
+        (void)wim_feed(&det, &samples[i * stride], MIN(block, n - i), stride, wim_t_collect,
+                       seen);
+    }
+}
+
+ZTEST(radar_wim, test_axle_loads)
+{
+    static const struct wim_synth_vehicle *const vehicles[] = {
+        &wim_synth_car, &wim_synth_truck_3, &wim_synth_truck_5_overload,
+    };
+    static const uint32_t kmh[] = { 10, 30, 60, 90, 140 };
+    struct wim_t_seen seen;
+
+    for (size_t v = 0; v < ARRAY_SIZE(vehicles); v++) {
+        for (size_t s = 0; s < ARRAY_SIZE(kmh); s++) {
+            uint32_t speed_mm_s = (kmh[s] * 1000000U) / 3600U;
+            size_t n = wim_t_vehicle(vehicles[v], speed_mm_s);
+
+            wim_t_feed(wim_t_buf, n, n, 1, speed_mm_s, &seen);
+            zassert_equal(seen.count, vehicles[v]->axles, "vehicle %u at %u km/h",
+                          (unsigned int)v, kmh[s]);
+            for (uint32_t a = 0; a < seen.count; a++) {
+                uint32_t ref = vehicles[v]->load_kg[a];
+
+                /* 3% on light axles: the thresholds cut into their low ramps */
+                zassert_within(seen.kg[a], ref, (ref < 1000U) ? ref * 3U / 100U : ref / 100U,
+                               "vehicle %u at %u km/h, axle %u: %u kg", (unsigned int)v,
+                               kmh[s], a, seen.kg[a]);
+            }
+        }
+    }
+}
+
+ZTEST(radar_wim, test_blocks_and_stride)
+{
+    static uint16_t interleaved[2 * WIM_T_MAX_SAMPLES / 4];
+    static const size_t blocks[] = { 1, 16, 128, 1000 };
+    uint32_t speed_mm_s = 16667;
+    size_t n = wim_t_vehicle(&wim_synth_truck_3, speed_mm_s);
+    struct wim_t_seen whole;
+    struct wim_t_seen split;
+
+    zassert_true(2U * n <= ARRAY_SIZE(interleaved));
+    wim_t_feed(wim_t_buf, n, n, 1, speed_mm_s, &whole);
+    zassert_equal(whole.count, 3U);
+    for (size_t b = 0; b < ARRAY_SIZE(blocks); b++) {
+        wim_t_feed(wim_t_buf, n, blocks[b], 1, speed_mm_s, &split);
+        zassert_equal(split.count, 3U);
+        zassert_mem_equal(split.kg, whole.kg, sizeof(whole.kg), "block of %u",
+                          (unsigned int)blocks[b]);
+        zassert_mem_equal(split.end, whole.end, sizeof(whole.end));
+    }
+
+    /* First of two interleaved strips, the other one idle */
+    for (size_t i = 0; i < n; i++) {
+        interleaved[2U * i] = wim_t_buf[i];
+        interleaved[2U * i + 1U] = WIM_T_BASELINE;
+    }
+    wim_t_feed(interleaved, n, 128, 2, speed_mm_s, &split);
+    zassert_equal(split.count, 3U);
+    zassert_mem_equal(split.kg, whole.kg, sizeof(whole.kg));
+}
+
+ZTEST(radar_wim, test_baseline_drift_and_noise)
+{
+    uint32_t speed_mm_s = 22222; /* 80 km/h */
+    size_t n = wim_t_vehicle(&wim_synth_truck_5_overload, speed_mm_s);
+    uint32_t lfsr = 0xACE1U;
+    struct wim_t_seen seen;
+
+    /* Piezo drift of a count every 20 ms, and a few counts of noise */
+    for (size_t i = 0; i < n; i++) {
+        lfsr = (lfsr >> 1) ^ ((lfsr & 1U) ? 0xB400U : 0U);
+        wim_t_buf[i] = wim_t_buf[i] + (uint16_t)(i / 100U) + (uint16_t)(lfsr & 7U);
+    }
+    wim_t_feed(wim_t_buf, n, 128, 1, speed_mm_s, &seen);
+    zassert_equal(seen.count, 5U);
+    for (uint32_t a = 0; a < seen.count; a++) {
+        zassert_within(seen.kg[a], wim_synth_truck_5_overload.load_kg[a],
+                       wim_synth_truck_5_overload.load_kg[a] / 50U, "axle %u: %u kg", a,
+                       seen.kg[a]);
+    }
+
+    /* Noise under the threshold never opens an axle */
+    for (size_t i = 0; i < WIM_T_MAX_SAMPLES; i++) {
+        lfsr = (lfsr >> 1) ^ ((lfsr & 1U) ? 0xB400U : 0U);
+        wim_t_buf[i] = WIM_T_BASELINE + (uint16_t)(lfsr % CONFIG_RADAR_WIM_ON_COUNTS);
+    }
+    wim_t_feed(wim_t_buf, WIM_T_MAX_SAMPLES, 128, 1, speed_mm_s, &seen);
+    zassert_equal(seen.count, 0U);
+}
+
+ZTEST(radar_wim, test_axle_kg)
+{
+    struct wim_axle axle = { .samples = 100, .area = 100000 };
+
+    /* 1e5 count.samples x 200 us x 10 m/s = 2e5 count.mm, at 20 g each */
+    zassert_equal(wim_axle_kg(&axle, 200, 10000, 20), 4000);
+    zassert_equal(wim_axle_kg(&axle, 200, 0, 20), 0);
+    axle.area = UINT32_MAX;
+    zassert_equal(wim_axle_kg(&axle, 1000, 50000, 20), UINT16_MAX, "saturates");
+}
+
+ZTEST(radar_wim, test_block_ring)
+{
+    static uint16_t storage[4 * 8];
+    struct block_ring ring;
+
+    block_ring_init(&ring, storage, 8, 4);
+    zassert_is_null(block_ring_peek(&ring));
+
+    /* Blocks are handed out in place, in order, until the ring is full */
+    for (uint16_t b = 0; b < 4U; b++) {
+        uint16_t *block = block_ring_claim(&ring);
+
+        zassert_equal_ptr(block, &storage[b * 8U]);
+        block[0] = b;
+        block_ring_commit(&ring);
+    }
+    zassert_is_null(block_ring_claim(&ring), "ring full");
+
+    for (uint16_t b = 0; b < 2U; b++) {
+        const uint16_t *block = block_ring_peek(&ring);
+
+        zassert_equal(block[0], b);
+        block_ring_release(&ring);
+    }
+
+    /* Freed blocks are reused once the consumer released them */
+    zassert_equal_ptr(block_ring_claim(&ring), &storage[0]);
+    block_ring_commit(&ring);
+    zassert_equal(block_ring_peek(&ring)[0], 2U);
+}
+
+ZTEST_SUITE(radar_wim, NULL, NULL, NULL, NULL, NULL);